@@ -40,6 +40,13 @@ UFlareResourceCatalog::UFlareResourceCatalog(const class FObjectInitializer& PCI
 	Resources.Sort(SortByResourceType);
 	ConsumerResources.Sort(SortByResourceType);
 	MaintenanceResources.Sort(SortByResourceType);
+
+	// Index resources
+	for (int32 Index = 0; Index < Resources.Num(); Index++)
+	{
+		ResourceIndices.Add(&Resources[Index]->Data, Index);
+		ResourceIdentifierIndices.Add(Resources[Index]->Data.Identifier, Index);
+	}
 }
 
 
@@ -49,15 +56,10 @@ UFlareResourceCatalog::UFlareResourceCatalog(const class FObjectInitializer& PCI
 
 FFlareResourceDescription* UFlareResourceCatalog::Get(FName Identifier) const
 {
-	auto FindByName = [=](const UFlareResourceCatalogEntry* Candidate)
-	{
-		return Candidate->Data.Identifier == Identifier;
-	};
-
-	UFlareResourceCatalogEntry* const* Entry = Resources.FindByPredicate(FindByName);
-	if (Entry && *Entry)
+	const int32* Index = ResourceIdentifierIndices.Find(Identifier);
+	if (Index && Resources[*Index])
 	{
-		return &((*Entry)->Data);
+		return &(Resources[*Index]->Data);
 	}
 
 	return NULL;
@@ -39,12 +39,27 @@ public:
 	/** Get a resource from identifier */
 	UFlareResourceCatalogEntry* GetEntry(FFlareResourceDescription*) const;
 
+	/** Get the index of a resource in the resource list, or INDEX_NONE */
+	int32 GetResourceIndex(const FFlareResourceDescription* Resource) const
+	{
+		const int32* Index = ResourceIndices.Find(Resource);
+		return Index ? *Index : INDEX_NONE;
+	}
+
 	/** Get all resources */
 	TArray<UFlareResourceCatalogEntry*>& GetResourceList()
 	{
 		return Resources;
 	}
 
+protected:
+
+	/** Resource list index, by description */
+	TMap<const FFlareResourceDescription*, int32> ResourceIndices;
+
+	/** Resource list index, by identifier */
+	TMap<FName, int32> ResourceIdentifierIndices;
+
 };
 
 inline static bool SortByResourceType(const UFlareResourceCatalogEntry& ResourceA, const UFlareResourceCatalogEntry& ResourceB)
@@ -7,6 +7,7 @@
 #include "../Data/FlareResourceCatalog.h"
 
 #include "../Game/FlareGame.h"
+#include "../Game/FlareFleet.h"
 #include "../Quests/FlareQuestManager.h"
 
 #include "../Spacecrafts/FlareSimulatedSpacecraft.h"
@@ -110,6 +111,8 @@ void UFlareCargoBay::Load(UFlareSimulatedSpacecraft* ParentSpacecraft, TArray<FF
 
 		CargoBay.Add(Cargo);
 	}
+
+	NotifyCargoChanged();
 }
 
 
@@ -183,6 +186,8 @@ bool UFlareCargoBay::HasResources(FFlareResourceDescription* Resource, int32 Qua
 
 int32 UFlareCargoBay::TakeResources(FFlareResourceDescription* Resource, int32 Quantity, UFlareCompany* Client)
 {
+	NotifyCargoChanged();
+
 	int32 QuantityToTake = Quantity;
 
 
@@ -267,6 +272,8 @@ int32 UFlareCargoBay::TakeResources(FFlareResourceDescription* Resource, int32 Q
 
 void UFlareCargoBay::DumpCargo(FFlareCargo* Cargo)
 {
+	NotifyCargoChanged();
+
 	Cargo->Quantity = 0;
 	if (Cargo->Lock == EFlareResourceLock::NoLock)
 	{
@@ -276,6 +283,8 @@ void UFlareCargoBay::DumpCargo(FFlareCargo* Cargo)
 
 int32 UFlareCargoBay::GiveResources(FFlareResourceDescription* Resource, int32 Quantity, UFlareCompany* Client)
 {
+	NotifyCargoChanged();
+
 	int32 QuantityToGive = Quantity;
 
 	if (QuantityToGive == 0)
@@ -530,6 +539,8 @@ FFlareCargo* UFlareCargoBay::GetSlot(int32 Index)
 
 bool UFlareCargoBay::LockSlot(FFlareResourceDescription* Resource, EFlareResourceLock::Type LockType, bool ManualLock)
 {
+	NotifyCargoChanged();
+
 	if(LockType == EFlareResourceLock::NoLock)
 	{
 		return false;
@@ -574,6 +585,8 @@ bool UFlareCargoBay::LockSlot(FFlareResourceDescription* Resource, EFlareResourc
 
 void UFlareCargoBay::HideUnlockedSlots()
 {
+	NotifyCargoChanged();
+
 	for(FFlareCargo& Cargo : CargoBay)
 	{
 		if(Cargo.Lock == EFlareResourceLock::NoLock)
@@ -586,6 +599,8 @@ void UFlareCargoBay::HideUnlockedSlots()
 
 void UFlareCargoBay::UnlockAll(bool IgnoreManualLock)
 {
+	NotifyCargoChanged();
+
 	for (int CargoIndex = 0; CargoIndex < CargoBay.Num() ; CargoIndex++)
 	{
 		FFlareCargo& Cargo = CargoBay[CargoIndex];
@@ -610,6 +625,8 @@ void UFlareCargoBay::UnlockAll(bool IgnoreManualLock)
 
 void UFlareCargoBay::SetSlotRestriction(int32 SlotIndex, EFlareResourceRestriction::Type RestrictionType)
 {
+	NotifyCargoChanged();
+
 	if(SlotIndex >= CargoBay.Num())
 	{
 		FLOGV("Invalid index %d for set slot restriction (cargo bay size: %d)", SlotIndex, CargoBay.Num());
@@ -673,6 +690,15 @@ bool UFlareCargoBay::WantBuy(FFlareResourceDescription* Resource, UFlareCompany*
 	return false;
 }
 
+void UFlareCargoBay::NotifyCargoChanged()
+{
+	UFlareFleet* Fleet = Parent->GetCurrentFleet();
+	if (Fleet)
+	{
+		Fleet->InvalidateCargoCache();
+	}
+}
+
 bool UFlareCargoBay::CheckRestriction(const FFlareCargo* Cargo, UFlareCompany* Client) const
 {
 	// Check restrictions
@@ -125,6 +125,9 @@ public:
 
 	bool CheckRestriction(const FFlareCargo* Cargo, UFlareCompany* Client) const;
 
+	/** Notify the parent fleet that its cargo totals are outdated */
+	void NotifyCargoChanged();
+
 	static bool SortBySlotType(const FSortableCargoInfo& A, const FSortableCargoInfo& B);
 
 };
@@ -159,8 +159,7 @@ void UFlareFactory::StartShipBuilding(FFlareShipyardOrderSave& Order)
 {
 	if (FactoryData.TargetShipCompany == NAME_None && Order.Company != NAME_None)
 	{
-		FactoryData.TargetShipClass = Order.ShipClass;
-		FactoryData.TargetShipCompany = Order.Company;
+		SetTargetShip(Order.ShipClass, Order.Company);
 		FactoryData.ProductedDuration = 0;
 
 		Parent->GetCompany()->GiveMoney(Order.AdvancePayment, FFlareTransactionLogEntry::LogShipOrderAdvance(GetParent(), Order.Company, Order.ShipClass));
@@ -169,6 +168,20 @@ void UFlareFactory::StartShipBuilding(FFlareShipyardOrderSave& Order)
 	TryBeginProduction();
 }
 
+void UFlareFactory::SetTargetShip(FName ShipClass, FName ShipCompany)
+{
+	bool ClassChanged = (FactoryData.TargetShipClass != ShipClass);
+
+	FactoryData.TargetShipClass = ShipClass;
+	FactoryData.TargetShipCompany = ShipCompany;
+
+	// Cycle inputs and outputs follow the target ship, trade candidates are indexed on them
+	if (ClassChanged && Parent->GetCurrentSector())
+	{
+		Parent->GetCurrentSector()->InvalidateTradeStationIndex();
+	}
+}
+
 void UFlareFactory::Pause()
 {
 	FactoryData.Active = false;
@@ -436,8 +449,7 @@ void UFlareFactory::CancelProduction()
 	}
 
 	FactoryData.ProductedDuration = 0;
-	FactoryData.TargetShipClass = NAME_None;
-	FactoryData.TargetShipCompany = NAME_None;
+	SetTargetShip(NAME_None, NAME_None);
 
 	if (IsShipyard())
 	{
@@ -583,8 +595,7 @@ void UFlareFactory::PerformCreateShipAction(const FFlareFactoryAction* Action)
 		}
 	}
 
-	FactoryData.TargetShipClass = NAME_None;
-	FactoryData.TargetShipCompany = NAME_None;
+	SetTargetShip(NAME_None, NAME_None);
 
 	// No more ship to produce
 	Stop();
@@ -83,6 +83,9 @@ public:
 
 protected:
 
+	/** Set the ship class built by this shipyard, the cycle data changes with it */
+	void SetTargetShip(FName ShipClass, FName ShipCompany);
+
 	/*----------------------------------------------------
 	   Protected data
 	----------------------------------------------------*/
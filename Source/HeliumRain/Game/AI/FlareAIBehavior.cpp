@@ -7,6 +7,7 @@
 #include "../FlareGame.h"
 #include "../FlareCompany.h"
 #include "../FlareScenarioTools.h"
+#include "FlareCompanyAI.h"
 
 #include "../../Quests/FlareQuest.h"
 #include "../../Player/FlarePlayerController.h"
@@ -62,9 +63,18 @@ void UFlareAIBehavior::Simulate()
 	SCOPE_CYCLE_COUNTER(STAT_FlareAIBehavior_Simulate);
 
 	// See how the player is doing
-	TArray<UFlareCompany*> SortedCompany = Game->GetGameWorld()->GetCompanies();
-	SortedCompany.Sort(&CompanyValueComparator);
-	int32 PlayerCompanyIndex = SortedCompany.IndexOfByKey(GetGame()->GetPC()->GetCompany());
+	int32 PlayerCompanyIndex;
+	const AIDaySnapshot* Snapshot = Game->GetGameWorld()->GetAIDaySnapshot();
+	if (Snapshot)
+	{
+		PlayerCompanyIndex = Snapshot->CompanyRanking.IndexOfByKey(GetGame()->GetPC()->GetCompany());
+	}
+	else
+	{
+		TArray<UFlareCompany*> SortedCompany = Game->GetGameWorld()->GetCompanies();
+		SortedCompany.Sort(&CompanyValueComparator);
+		PlayerCompanyIndex = SortedCompany.IndexOfByKey(GetGame()->GetPC()->GetCompany());
+	}
 	int32 PlayerArmy = GetGame()->GetPC()->GetCompany()->GetCompanyValue().ArmyCurrentCombatPoints;
 
 	// Pirates hate you
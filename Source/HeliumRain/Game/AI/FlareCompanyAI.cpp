@@ -117,7 +117,15 @@ void UFlareCompanyAI::Simulate()
 		CheckBattleResolution();
 		UpdateDiplomacy();
 
-		WorldStats = WorldHelper::ComputeWorldResourceStats(Game, true);
+		const AIDaySnapshot* Snapshot = Game->GetGameWorld()->GetAIDaySnapshot();
+		if (Snapshot)
+		{
+			WorldStats = Snapshot->WorldStats;
+		}
+		else
+		{
+			WorldStats = WorldHelper::ComputeWorldResourceStats(Game, true);
+		}
 		Shipyards = FindShipyards();
 
 		// Compute input and output ressource equation (ex: 100 + 10/ day)
@@ -666,67 +674,92 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool Technology,
 		}
 	}
 
-	// Loop on sector list
-	for (int32 SectorIndex = 0; SectorIndex < Company->GetKnownSectors().Num(); SectorIndex++)
+	// Count the company stations of each kind once
+	struct StationKindStats
 	{
-		UFlareSimulatedSector* Sector = Company->GetKnownSectors()[SectorIndex];
+		int32 Count = 0;
+		int32 UpgradableCount = 0;
+		int32 MinLevel = MAX_int32;
+	};
+	TMap<FFlareSpacecraftDescription*, StationKindStats> StationKinds;
+	for(UFlareSimulatedSpacecraft* StationCandidate : Company->GetCompanyStations())
+	{
+		StationKindStats& Stats = StationKinds.FindOrAdd(StationCandidate->GetDescription());
+		Stats.Count++;
+		Stats.MinLevel = FMath::Min(Stats.MinLevel, StationCandidate->GetLevel());
+		if (StationCandidate->GetLevel() < StationCandidate->GetDescription()->MaxLevel)
+		{
+			Stats.UpgradableCount++;
+		}
+	}
 
-		// Loop on catalog
-		for (int32 StationIndex = 0; StationIndex < StationCatalog.Num(); StationIndex++)
+	// List the station types the company may build anywhere
+	TArray<FFlareSpacecraftDescription*> StationCandidates;
+	for (int32 StationIndex = 0; StationIndex < StationCatalog.Num(); StationIndex++)
+	{
+		FFlareSpacecraftDescription* StationDescription = &StationCatalog[StationIndex]->Data;
+
+		if (StationDescription->IsSubstation)
 		{
-			FFlareSpacecraftDescription* StationDescription = &StationCatalog[StationIndex]->Data;
+			// Never try to build substations
+			continue;
+		}
 
-			if (StationDescription->IsSubstation)
-			{
-				// Never try to build substations
-				continue;
-			}
+		if (!Company->IsTechnologyUnlockedStation(StationDescription))
+		{
+			continue;
+		}
 
-			if (!Company->IsTechnologyUnlockedStation(StationDescription))
-			{
-				continue;
-			}
+		StationKindStats* Stats = StationKinds.Find(StationDescription);
+		if(Stats && Stats->UpgradableCount >= 2)
+		{
+			// Prefer update if possible
+			continue;
+		}
 
-			// Check sector limitations
-			TArray<FText> Reasons;
-			if (!Sector->CanBuildStation(StationDescription, Company, Reasons, true))
-			{
-				continue;
-			}
+		StationCandidates.Add(StationDescription);
+	}
 
+	// Loop on sector list
+	for (int32 SectorIndex = 0; SectorIndex < Company->GetKnownSectors().Num(); SectorIndex++)
+	{
+		UFlareSimulatedSector* Sector = Company->GetKnownSectors()[SectorIndex];
 
-			int32 UpdatableStationCountForThisKind = 0;
-			for(UFlareSimulatedSpacecraft* StationCandidate : Company->GetCompanyStations())
-			{
-				if(StationDescription == StationCandidate->GetDescription() && StationCandidate->GetLevel() < StationDescription->MaxLevel)
-				{
-					UpdatableStationCountForThisKind++;
-				}
-			}
+		// Check sector limitations once for all station types
+		TArray<FText> SectorReasons;
+		bool CanBuildInSector = Sector->CanBuildStationInSector(Company, SectorReasons);
+
+		int32 StorageStationCount = -1;
+		int32 SectorStationCount = 0;
 
-			if(UpdatableStationCountForThisKind >= 2)
+		// Loop on catalog
+		for (int32 StationIndex = 0; CanBuildInSector && StationIndex < StationCandidates.Num(); StationIndex++)
+		{
+			FFlareSpacecraftDescription* StationDescription = StationCandidates[StationIndex];
+
+			// Check station limitations
+			TArray<FText> Reasons;
+			if (!Sector->CanBuildStationDescription(StationDescription, Company, Reasons, true))
 			{
-				// Prefer update if possible
 				continue;
 			}
 
-
 			if(StationDescription->Capabilities.Contains(EFlareSpacecraftCapability::Storage))
 			{
-				int32 StorageStationCount = 0;
-				int32 StationCount = 0;
-				// TODO
-
-				for(UFlareSimulatedSpacecraft* Station : Sector->GetSectorStations())
+				if (StorageStationCount < 0)
 				{
-					if(Station->HasCapability(EFlareSpacecraftCapability::Storage))
+					StorageStationCount = 0;
+					for(UFlareSimulatedSpacecraft* Station : Sector->GetSectorStations())
 					{
-						StorageStationCount++;
+						if(Station->HasCapability(EFlareSpacecraftCapability::Storage))
+						{
+							StorageStationCount++;
+						}
+						SectorStationCount++;
 					}
-					StationCount++;
 				}
 
-				if(StorageStationCount < 1 && StationCount > AI_MAX_STATION_PER_SECTOR/2)
+				if(StorageStationCount < 1 && SectorStationCount > AI_MAX_STATION_PER_SECTOR/2)
 				{
 					UpdateBestScore(1e18f, Sector, StationDescription, NULL, &BestScore, &BestStationDescription, &BestStation, &BestSector);
 					break;
@@ -774,27 +807,15 @@ void UFlareCompanyAI::ProcessBudgetStation(int64 BudgetAmount, bool Technology,
 				continue;
 			}
 
-			int32 StationCountForThisKind = 0;
-			int32 StationWithLowerLevelInSectorForThisKind = 0;
-			for(UFlareSimulatedSpacecraft* StationCandidate : Company->GetCompanyStations())
-			{
-				if(Station->GetDescription() == StationCandidate->GetDescription())
-				{
-					StationCountForThisKind++;
+			const StationKindStats& Stats = StationKinds[Station->GetDescription()];
 
-					if(StationCandidate->GetLevel() < Station->GetLevel())
-					{
-						StationWithLowerLevelInSectorForThisKind++;
-					}
-				}
-			}
-
-			if(StationWithLowerLevelInSectorForThisKind > 0)
+			if(Stats.MinLevel < Station->GetLevel())
 			{
+				// Upgrade the lower level stations of this kind first
 				continue;
 			}
 
-			if (StationCountForThisKind < 2)
+			if (Stats.Count < 2)
 			{
 				// Don't upgrade the only station the company have to avoid deadlock
 				continue;
@@ -1515,16 +1536,51 @@ TArray<DefenseSector> UFlareCompanyAI::SortSectorsByDistance(UFlareSimulatedSect
 	return SectorsToSort;
 }
 
+void AIDaySnapshot::Generate(AFlareGame* Game)
+{
+	WorldStats = WorldHelper::ComputeWorldResourceStats(Game, true);
+
+	// Find shipyards
+	Shipyards.Empty();
+	for (UFlareSimulatedSector* Sector : Game->GetGameWorld()->GetSectors())
+	{
+		for (UFlareSimulatedSpacecraft* Station : Sector->GetSectorStations())
+		{
+			for (UFlareFactory* Factory : Station->GetFactories())
+			{
+				if (Factory->IsShipyard())
+				{
+					Shipyards.FindOrAdd(Sector).Add(Station);
+					break;
+				}
+			}
+		}
+	}
+
+	// Rank companies
+	CompanyRanking = Game->GetGameWorld()->GetCompanies();
+	CompanyRanking.Sort([](const UFlareCompany& A, const UFlareCompany& B)
+	{
+		return A.GetCompanyValue().TotalValue < B.GetCompanyValue().TotalValue;
+	});
+}
+
 void AIWarContext::Generate()
 {
 	float AttackThresholdSum = 0;
 	float AttackThresholdCount = 0;
 
+	TSet<UFlareSimulatedSector*> KnownSectorSet;
 	for (UFlareCompany* Ally :  Allies)
 	{
 		for(UFlareSimulatedSector* Sector: Ally->GetKnownSectors())
 		{
-			KnownSectors.AddUnique(Sector);
+			bool AlreadyKnown = false;
+			KnownSectorSet.Add(Sector, &AlreadyKnown);
+			if (!AlreadyKnown)
+			{
+				KnownSectors.Add(Sector);
+			}
 		}
 
 		Ally->GetAI()->GetBehavior()->Load(Ally);
@@ -2827,6 +2883,29 @@ TArray<UFlareSimulatedSpacecraft*> UFlareCompanyAI::FindShipyards()
 {
 	TArray<UFlareSimulatedSpacecraft*> ShipyardList;
 
+	// Use the shared world shipyard list if available
+	const AIDaySnapshot* Snapshot = Game->GetGameWorld()->GetAIDaySnapshot();
+	if (Snapshot)
+	{
+		// Keep the known sector order, callers pick the first suitable shipyard
+		for (UFlareSimulatedSector* Sector : Company->GetKnownSectors())
+		{
+			const TArray<UFlareSimulatedSpacecraft*>* SectorShipyards = Snapshot->Shipyards.Find(Sector);
+			if (SectorShipyards)
+			{
+				for (UFlareSimulatedSpacecraft* Station : *SectorShipyards)
+				{
+					if (Company->GetWarState(Station->GetCompany()) != EFlareHostility::Hostile)
+					{
+						ShipyardList.Add(Station);
+					}
+				}
+			}
+		}
+
+		return ShipyardList;
+	}
+
 	// Find shipyard
 	for (int32 SectorIndex = 0; SectorIndex < Company->GetKnownSectors().Num(); SectorIndex++)
 	{
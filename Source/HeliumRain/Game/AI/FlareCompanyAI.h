@@ -15,6 +15,21 @@ struct FFlareDiplomacyStats
 
 };
 
+/** World aggregates shared by all company AIs, built once per day */
+struct AIDaySnapshot
+{
+	/** World resource flows, storage included */
+	TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> WorldStats;
+
+	/** Stations with a shipyard, by sector */
+	TMap<UFlareSimulatedSector*, TArray<UFlareSimulatedSpacecraft*>> Shipyards;
+
+	/** Companies sorted by increasing value */
+	TArray<UFlareCompany*> CompanyRanking;
+
+	void Generate(AFlareGame* Game);
+};
+
 struct AIWarContext
 {
 	TArray<UFlareCompany*> Allies;
@@ -7,6 +7,7 @@
 
 #include "StaticMeshResources.h"
 
+#define ASTEROID_COLLISION_SIZE 20000.0f
 
 /*----------------------------------------------------
 	Constructor
@@ -90,7 +91,7 @@ void AFlareAsteroid::SetupAsteroidMesh(AFlareGame* Game, UStaticMeshComponent* C
 	// Actor scale
 	Component->SetWorldScale3D(FVector(1, 1, 1));
 	float CollisionSize = Component->GetCollisionShape().GetExtent().Size();
-	FVector ScaleFactor = Component->GetOwner()->GetActorScale3D() * Data.Scale * (20000.0f / CollisionSize);
+	FVector ScaleFactor = Component->GetOwner()->GetActorScale3D() * Data.Scale * (ASTEROID_COLLISION_SIZE / CollisionSize);
 	Component->SetWorldScale3D(ScaleFactor);
 	
 	// Mass scale
@@ -109,6 +110,12 @@ void AFlareAsteroid::SetupAsteroidMesh(AFlareGame* Game, UStaticMeshComponent* C
 	AsteroidMaterial->SetScalarParameterValue("IceMask", IsIcy);
 }
 
+float AFlareAsteroid::GetEstimatedSize(const FFlareAsteroidSave& Data)
+{
+	// Meshes are normalized to the same collision size, only the save scale remains
+	return FMath::Max(ASTEROID_COLLISION_SIZE * Data.Scale.GetAbsMax(), 1.0f);
+}
+
 FFlareAsteroidSave* AFlareAsteroid::Save()
 {
 	// Physical data
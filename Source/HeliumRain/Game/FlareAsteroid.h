@@ -39,6 +39,9 @@ public:
 	/** Setup an asteroid mesh */
 	static void SetupAsteroidMesh(AFlareGame* Game, UStaticMeshComponent* Component, const FFlareAsteroidSave& Data, bool IsIcy);
 
+	/** Estimate the collision size of an asteroid that is not spawned yet */
+	static float GetEstimatedSize(const FFlareAsteroidSave& Data);
+
 	virtual void NotifyHit(class UPrimitiveComponent* MyComp, class AActor* Other, class UPrimitiveComponent* OtherComp, bool bSelfMoved,
 		FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit) override;
 
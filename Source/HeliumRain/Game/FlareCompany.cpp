@@ -24,6 +24,9 @@
 
 #define LOCTEXT_NAMESPACE "FlareCompany"
 
+// Days of detailed transaction log kept, older entries only remain in the yearly totals
+#define TRANSACTION_LOG_RETENTION_DAYS 60
+
 
 /*----------------------------------------------------
 	Constructor
@@ -100,6 +103,16 @@ void UFlareCompany::Load(const FFlareCompanySave& Data)
 		LoadFleet(CompanyData.Fleets[i]);
 	}
 
+	// Build transaction totals for older saves, then drop expired entries
+	if (CompanyData.TransactionSummaries.Num() == 0)
+	{
+		for (const FFlareTransactionLogEntry& Entry : CompanyData.TransactionLog)
+		{
+			AddTransactionToSummary(Entry);
+		}
+	}
+	TrimTransactionLog(Cast<UFlareWorld>(GetOuter())->GetDate());
+
 	// Load emblem
 	SetupEmblem();
 
@@ -317,6 +330,16 @@ void UFlareCompany::SetHostilityTo(UFlareCompany* TargetCompany, bool Hostile)
 	if (TargetCompany && TargetCompany != this)
 	{
 		bool WasHostile = CompanyData.HostileCompanies.Contains(TargetCompany->GetIdentifier());
+
+		// Hostility changes the battle state of every shared sector
+		if (Hostile != WasHostile && Game->GetGameWorld())
+		{
+			for (UFlareSimulatedSector* Sector : Game->GetGameWorld()->GetSectors())
+			{
+				Sector->InvalidateBattleState();
+			}
+		}
+
 		if (Hostile && !WasHostile)
 		{
 			CompanyData.HostileCompanies.AddUnique(TargetCompany->GetIdentifier());
@@ -700,6 +723,130 @@ void UFlareCompany::VisitSector(UFlareSimulatedSector* Sector)
 	}
 }
 
+void UFlareCompany::LogTransaction(const FFlareTransactionLogEntry& Entry)
+{
+	TrimTransactionLog(Entry.Date);
+	CompanyData.TransactionLog.Push(Entry);
+	AddTransactionToSummary(Entry);
+}
+
+void UFlareCompany::AddTransactionToSummary(const FFlareTransactionLogEntry& Entry)
+{
+	int64 Year = UFlareGameTools::GetYearFromDate(Entry.Date);
+
+	// Entries are chronological, the year is almost always the last one
+	FFlareTransactionLogSummary* Summary = NULL;
+	for (int32 Index = CompanyData.TransactionSummaries.Num() - 1; Index >= 0; Index--)
+	{
+		if (CompanyData.TransactionSummaries[Index].Year == Year)
+		{
+			Summary = &CompanyData.TransactionSummaries[Index];
+			break;
+		}
+	}
+
+	if (!Summary)
+	{
+		Summary = &CompanyData.TransactionSummaries[CompanyData.TransactionSummaries.AddDefaulted()];
+		Summary->Year = Year;
+	}
+
+	if (Summary->Amounts.Num() < EFlareTransactionLogEntry::TYPE_COUNT)
+	{
+		Summary->Amounts.SetNumZeroed(EFlareTransactionLogEntry::TYPE_COUNT);
+	}
+	Summary->Amounts[Entry.Type] += Entry.Amount;
+}
+
+void UFlareCompany::TrimTransactionLog(int64 Date)
+{
+	// Entries are chronological, find the first one to keep
+	int64 OldestDate = Date - TRANSACTION_LOG_RETENTION_DAYS;
+	int32 ExpiredCount = 0;
+	while (ExpiredCount < CompanyData.TransactionLog.Num() && CompanyData.TransactionLog[ExpiredCount].Date < OldestDate)
+	{
+		ExpiredCount++;
+	}
+
+	if (ExpiredCount > 0)
+	{
+		CompanyData.TransactionLog.RemoveAt(0, ExpiredCount);
+	}
+}
+
+const FFlareTransactionLogSummary* UFlareCompany::GetTransactionSummary(int64 Year) const
+{
+	for (const FFlareTransactionLogSummary& Summary : CompanyData.TransactionSummaries)
+	{
+		if (Summary.Year == Year)
+		{
+			return &Summary;
+		}
+	}
+	return NULL;
+}
+
+int32 UFlareCompany::CheckTransactionSummaries(const TArray<FFlareTransactionLogSummary>& Summaries, int32& CheckedYears) const
+{
+	// Only years starting inside the retention period still have all their entries
+	int64 OldestDate = Cast<UFlareWorld>(GetOuter())->GetDate() - TRANSACTION_LOG_RETENTION_DAYS;
+	int64 FirstCompleteYear = UFlareGameTools::START_YEAR;
+	if (OldestDate > 0)
+	{
+		FirstCompleteYear = UFlareGameTools::GetYearFromDate(OldestDate + UFlareGameTools::DAYS_IN_YEAR - 1);
+	}
+
+	// Rebuild the totals from the log
+	TMap<int64, TArray<int64>> RebuiltAmounts;
+	for (const FFlareTransactionLogEntry& Entry : CompanyData.TransactionLog)
+	{
+		int64 Year = UFlareGameTools::GetYearFromDate(Entry.Date);
+		if (Year >= FirstCompleteYear)
+		{
+			TArray<int64>& Amounts = RebuiltAmounts.FindOrAdd(Year);
+			Amounts.SetNumZeroed(EFlareTransactionLogEntry::TYPE_COUNT);
+			Amounts[Entry.Type] += Entry.Amount;
+		}
+	}
+
+	// Compare with the summaries
+	int32 Mismatches = 0;
+	CheckedYears = 0;
+	for (const FFlareTransactionLogSummary& Summary : Summaries)
+	{
+		if (Summary.Year < FirstCompleteYear)
+		{
+			continue;
+		}
+
+		const TArray<int64>* Amounts = RebuiltAmounts.Find(Summary.Year);
+		for (int32 Type = 0; Type < EFlareTransactionLogEntry::TYPE_COUNT; Type++)
+		{
+			int64 LogAmount = Amounts ? (*Amounts)[Type] : 0;
+			int64 SummaryAmount = (Type < Summary.Amounts.Num()) ? Summary.Amounts[Type] : 0;
+			if (LogAmount != SummaryAmount)
+			{
+				FLOGV("UFlareCompany::CheckTransactionSummaries : %s year %lld type %d, summary %lld, log %lld",
+					*GetCompanyName().ToString(), Summary.Year, Type, SummaryAmount, LogAmount);
+				Mismatches++;
+			}
+		}
+
+		RebuiltAmounts.Remove(Summary.Year);
+		CheckedYears++;
+	}
+
+	// Logged years without a summary
+	for (auto& Pair : RebuiltAmounts)
+	{
+		FLOGV("UFlareCompany::CheckTransactionSummaries : %s year %lld has log entries but no summary", *GetCompanyName().ToString(), Pair.Key);
+		Mismatches++;
+		CheckedYears++;
+	}
+
+	return Mismatches;
+}
+
 bool UFlareCompany::TakeMoney(int64 Amount, bool AllowDepts, FFlareTransactionLogEntry TransactionContext)
 {
 	if (Amount < 0 || (Amount > CompanyData.Money && !AllowDepts))
@@ -721,7 +868,7 @@ bool UFlareCompany::TakeMoney(int64 Amount, bool AllowDepts, FFlareTransactionLo
 		{
 			TransactionContext.Amount = -Amount;
 			TransactionContext.Date = GetGame()->GetGameWorld()->GetDate();
-			CompanyData.TransactionLog.Push(TransactionContext);
+			LogTransaction(TransactionContext);
 		}
 
 		InvalidateCompanyValueCache();
@@ -750,7 +897,7 @@ void UFlareCompany::GiveMoney(int64 Amount, FFlareTransactionLogEntry Transactio
 	{
 		TransactionContext.Amount = Amount;
 		TransactionContext.Date = GetGame()->GetGameWorld()->GetDate();
-		CompanyData.TransactionLog.Push(TransactionContext);
+		LogTransaction(TransactionContext);
 	}
 
 	InvalidateCompanyValueCache();
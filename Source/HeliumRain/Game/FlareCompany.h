@@ -196,6 +196,15 @@ public:
 
 protected:
 
+	/** Record a player transaction in the log and the yearly totals */
+	void LogTransaction(const FFlareTransactionLogEntry& Entry);
+
+	/** Add a transaction to the yearly totals */
+	void AddTransactionToSummary(const FFlareTransactionLogEntry& Entry);
+
+	/** Drop detailed entries older than the retention period */
+	void TrimTransactionLog(int64 Date);
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -468,6 +477,17 @@ public:
 		return CompanyData.TransactionLog;
 	}
 
+	/** Get the transaction totals for a year, or NULL if nothing was logged */
+	const FFlareTransactionLogSummary* GetTransactionSummary(int64 Year) const;
+
+	TArray<FFlareTransactionLogSummary> const& GetTransactionSummaries() const
+	{
+		return CompanyData.TransactionSummaries;
+	}
+
+	/** Rebuild the totals of the years still fully in the log, and count the amounts that differ in Summaries */
+	int32 CheckTransactionSummaries(const TArray<FFlareTransactionLogSummary>& Summaries, int32& CheckedYears) const;
+
 	float GetRetaliation() const
 	{
 		return CompanyData.Retaliation;
@@ -21,6 +21,7 @@
 
 UFlareFleet::UFlareFleet(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, FleetCargoCacheValid(false)
 {
 }
 
@@ -145,19 +146,8 @@ uint32 UFlareFleet::GetTradingShipCount() const
 
 int32 UFlareFleet::GetTransportCapacity()
 {
-	int32 CompanyCapacity = 0;
-
-	for(UFlareSimulatedSpacecraft* Ship : FleetShips)
-	{
-		if(Ship->GetDamageSystem()->IsStranded())
-		{
-			continue;
-		}
-
-		CompanyCapacity += Ship->GetActiveCargoBay()->GetCapacity();
-	}
-
-	return CompanyCapacity;
+	UpdateCargoCache();
+	return TransportCapacityCache;
 }
 
 uint32 UFlareFleet::GetShipCount() const
@@ -249,24 +239,41 @@ FText UFlareFleet::GetStatusInfo() const
 
 int32 UFlareFleet::GetFleetCapacity() const
 {
-	int32 CargoCapacity = 0;
-
-	for (int ShipIndex = 0; ShipIndex < FleetShips.Num(); ShipIndex++)
-	{
-		CargoCapacity += FleetShips[ShipIndex]->GetActiveCargoBay()->GetCapacity();
-	}
-	return CargoCapacity;
+	UpdateCargoCache();
+	return FleetCapacityCache;
 }
 
 int32 UFlareFleet::GetFleetFreeCargoSpace() const
 {
-	int32 FreeCargoSpace = 0;
+	UpdateCargoCache();
+	return FleetFreeCargoSpaceCache;
+}
 
-	for (int ShipIndex = 0; ShipIndex < FleetShips.Num(); ShipIndex++)
+void UFlareFleet::UpdateCargoCache() const
+{
+	if (FleetCargoCacheValid)
 	{
-		FreeCargoSpace += FleetShips[ShipIndex]->GetActiveCargoBay()->GetFreeCargoSpace();
+		return;
 	}
-	return FreeCargoSpace;
+
+	FleetCapacityCache = 0;
+	FleetFreeCargoSpaceCache = 0;
+	TransportCapacityCache = 0;
+	FleetResourceQuantityCache.Reset();
+
+	for (UFlareSimulatedSpacecraft* Ship : FleetShips)
+	{
+		int32 Capacity = Ship->GetActiveCargoBay()->GetCapacity();
+		FleetCapacityCache += Capacity;
+		FleetFreeCargoSpaceCache += Ship->GetActiveCargoBay()->GetFreeCargoSpace();
+
+		if (!Ship->GetDamageSystem()->IsStranded())
+		{
+			TransportCapacityCache += Capacity;
+		}
+	}
+
+	FleetCargoCacheValid = true;
 }
 
 int32 UFlareFleet::GetCombatPoints(bool ReduceByDamage) const
@@ -397,6 +404,7 @@ void UFlareFleet::AddShip(UFlareSimulatedSpacecraft* Ship)
 	FleetData.ShipImmatriculations.Add(Ship->GetImmatriculation());
 	FleetShips.AddUnique(Ship);
 	Ship->SetCurrentFleet(this);
+	InvalidateCargoCache();
 
 	if (FleetCompany == GetGame()->GetPC()->GetCompany() && GetGame()->GetQuestManager())
 	{
@@ -415,6 +423,7 @@ void UFlareFleet::RemoveShip(UFlareSimulatedSpacecraft* Ship, bool destroyed)
 	FleetData.ShipImmatriculations.Remove(Ship->GetImmatriculation());
 	FleetShips.Remove(Ship);
 	Ship->SetCurrentFleet(NULL);
+	InvalidateCargoCache();
 
 	if (!destroyed)
 	{
@@ -440,6 +449,7 @@ void UFlareFleet::Disband()
 	{
 		FleetShips[ShipIndex]->SetCurrentFleet(NULL);
 	}
+	InvalidateCargoCache();
 
 	if (GetCurrentTradeRoute())
 	{
@@ -529,6 +539,7 @@ void UFlareFleet::InitShipList()
 	{
 		IsShipListLoaded = true;
 		FleetShips.Empty();
+		InvalidateCargoCache();
 		for (int ShipIndex = 0; ShipIndex < FleetData.ShipImmatriculations.Num(); ShipIndex++)
 		{
 			UFlareSimulatedSpacecraft* Ship = FleetCompany->FindSpacecraft(FleetData.ShipImmatriculations[ShipIndex]);
@@ -585,11 +596,22 @@ TArray<UFlareSimulatedSpacecraft*>& UFlareFleet::GetShips()
 
 int32 UFlareFleet::GetFleetResourceQuantity(FFlareResourceDescription* Resource)
 {
+	InitShipList();
+	UpdateCargoCache();
+
+	int32* CachedQuantity = FleetResourceQuantityCache.Find(Resource);
+	if (CachedQuantity)
+	{
+		return *CachedQuantity;
+	}
+
 	int32 Quantity = 0;
-	for(UFlareSimulatedSpacecraft* Ship : GetShips())
+	for(UFlareSimulatedSpacecraft* Ship : FleetShips)
 	{
 		Quantity += Ship->GetActiveCargoBay()->GetResourceQuantity(Resource, Ship->GetCompany());
 	}
+
+	FleetResourceQuantityCache.Add(Resource, Quantity);
 	return Quantity;
 }
 
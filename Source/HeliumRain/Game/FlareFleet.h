@@ -146,8 +146,17 @@ public:
 
 	int32 GetRefillDuration() const;
 
+	/** Invalidate the cargo totals after a change in ships, cargo or damage */
+	void InvalidateCargoCache()
+	{
+		FleetCargoCacheValid = false;
+	}
+
 protected:
 
+	/** Compute the cargo totals if needed */
+	void UpdateCargoCache() const;
+
 	TArray<UFlareSimulatedSpacecraft*>     FleetShips;
 
 	UFlareCompany*			               FleetCompany;
@@ -158,6 +167,13 @@ protected:
 	UFlareTravel*                          CurrentTravel;
 	UFlareTradeRoute*                      CurrentTradeRoute;
 
+	// Cargo totals cache
+	mutable bool                           FleetCargoCacheValid;
+	mutable int32                          FleetCapacityCache;
+	mutable int32                          FleetFreeCargoSpaceCache;
+	mutable int32                          TransportCapacityCache;
+	mutable TMap<FFlareResourceDescription*, int32> FleetResourceQuantityCache;
+
 
 public:
 
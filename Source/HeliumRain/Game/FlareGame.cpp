@@ -56,6 +56,7 @@ AFlareGame::AFlareGame(const class FObjectInitializer& PCIP)
 	: Super(PCIP)
 	, CurrentImmatriculationIndex(0)
 	, CurrentIdentifierIndex(0)
+	, SpacecraftNameBatch(false)
 	, LoadedOrCreated(false)
 	, SaveSlotCount(3)
 	, CurrentStreamingLevelIndex(0)
@@ -438,6 +439,8 @@ void AFlareGame::Tick(float DeltaSeconds)
 
 	if (GetActiveSector() != NULL)
 	{
+		GetActiveSector()->TickLoading();
+
 		for (int CompanyIndex = 0; CompanyIndex < GetGameWorld()->GetCompanies().Num(); CompanyIndex++)
 		{
 			GetGameWorld()->GetCompanies()[CompanyIndex]->TickAI();
@@ -563,7 +566,6 @@ UFlareSaveGame* AFlareGame::ReadSaveSlot(int32 Index)
 	FString SaveFile = GetSaveFileName(Index);
 	UFlareSaveGame* Save = NULL;
 
-	// Prototype load
 	if (SaveGameSystem->DoesSaveGameExist(SaveFile))
 	{
 		FLOG("AFlareGame::ReadSaveSlot : using JSON");
@@ -572,7 +574,7 @@ UFlareSaveGame* AFlareGame::ReadSaveSlot(int32 Index)
 	
 	if (Save == NULL && UGameplayStatics::DoesSaveGameExist(SaveFile, 0))
 	{
-		// Try legacy load
+		// Try legacy load, bundles read their former reflected layout
 		FLOG("AFlareGame::ReadSaveSlot : using legacy");
 		Save = Cast<UFlareSaveGame>(UGameplayStatics::LoadGameFromSlot(SaveFile, 0));
 	}
@@ -1268,6 +1270,35 @@ FString AFlareGame::ConvertToRoman(uint32 val)
 	return Roman;
 }
 
+/** Break up a name to transform "<name>-<type>-<number>" into "<name>-<number>" */
+static FString GetSpacecraftBaseName(UFlareSimulatedSpacecraft* Spacecraft)
+{
+	TArray<FString> NickNameParts;
+	Spacecraft->GetNickName().ToString().ParseIntoArray(NickNameParts, TEXT("-"));
+	FString BaseName;
+
+	if (NickNameParts.Num())
+	{
+		BaseName = NickNameParts[0];
+
+		// Extract index suffix from the candidate
+		if (Spacecraft->IsStation() && NickNameParts.Num() == 3)
+		{
+			BaseName += "-" + NickNameParts.Last();
+		}
+		else if (!Spacecraft->IsStation() && NickNameParts.Num() == 2)
+		{
+			BaseName += "-" + NickNameParts.Last();
+		}
+	}
+	else
+	{
+		BaseName = Spacecraft->GetNickName().ToString();
+	}
+
+	return BaseName;
+}
+
 FText AFlareGame::PickSpacecraftName(UFlareCompany* OwnerCompany, bool IsStation, FString BaseSuffix)
 {
 	if (CapitalShipNameList.Num() == 0 || StationNameList.Num() == 0)
@@ -1281,15 +1312,36 @@ FText AFlareGame::PickSpacecraftName(UFlareCompany* OwnerCompany, bool IsStation
 
 	// TODO : only take a name that no other company uses
 
+	// List used names once, or once per batch
+	TSet<FString> LocalUsedNames;
+	TSet<FString>& UsedNames = SpacecraftNameBatch ? UsedSpacecraftNames : LocalUsedNames;
+	if (!SpacecraftNameBatch || UsedNames.Num() == 0)
+	{
+		for (int i = 0; i < GetGameWorld()->GetCompanies().Num(); i++)
+		{
+			UFlareCompany* Company = GetGameWorld()->GetCompanies()[i];
+
+			for (auto& Candidate : Company->GetCompanyStations())
+			{
+				UsedNames.Add(GetSpacecraftBaseName(Candidate));
+			}
+			for (auto& Candidate : Company->GetCompanyChildStations())
+			{
+				UsedNames.Add(GetSpacecraftBaseName(Candidate));
+			}
+			for (auto& Candidate : Company->GetCompanyShips())
+			{
+				UsedNames.Add(GetSpacecraftBaseName(Candidate));
+			}
+		}
+	}
+
 	// Check unicity
-	bool Unique = false;
 	int32 NameIncrement = 1;
 	FString Suffix;
 	FString CandidateName;
 	do
 	{
-		Unique = true;
-
 		// Generate suffix text
 		if (NameIncrement > 1)
 		{
@@ -1302,69 +1354,32 @@ FText AFlareGame::PickSpacecraftName(UFlareCompany* OwnerCompany, bool IsStation
 		}
 		CandidateName = BaseName.ToString() + Suffix;
 
-		// Browse all existing ships the check if the name is unique
-		for (int i = 0; i < GetGameWorld()->GetCompanies().Num(); i++)
-		{
-			// List stations
-			TArray<UFlareSimulatedSpacecraft*> CandidateShips;
-			for (auto& Candidate : GetGameWorld()->GetCompanies()[i]->GetCompanyStations())
-			{
-				CandidateShips.Add(Candidate);
-			}
-			for (auto& Candidate : GetGameWorld()->GetCompanies()[i]->GetCompanyChildStations())
-			{
-				CandidateShips.Add(Candidate);
-			}
-			for (auto& Candidate : GetGameWorld()->GetCompanies()[i]->GetCompanyShips())
-			{
-				CandidateShips.Add(Candidate);
-			}
-
-			// Check unicity
-			for (auto& OtherSpacecraft : CandidateShips)
-			{
-				// Break up other name to transform "<name>-<type><number>" into "<name>-number>"
-				TArray<FString> NickNameParts;
-				OtherSpacecraft->GetNickName().ToString().ParseIntoArray(NickNameParts, TEXT("-"));
-				FString OtherName;
-
-				if (NickNameParts.Num())
-				{
-					OtherName = NickNameParts[0];
-
-					// Extract index suffix from the candidate
-					if (OtherSpacecraft->IsStation() && NickNameParts.Num() == 3)
-					{
-						OtherName += "-" + NickNameParts.Last();
-					}
-					else if (!OtherSpacecraft->IsStation() && NickNameParts.Num() == 2)
-					{
-						OtherName += "-" + NickNameParts.Last();
-					}
-				
-				}
-				else
-				{
-					OtherName = OtherSpacecraft->GetNickName().ToString();
-				}
-
-				if (OtherName == CandidateName)
-				{
-					Unique = false;
-					break;
-				}
-			}
-		}
-
 		NameIncrement++;
 
-	} while(!Unique);
+	} while(UsedNames.Contains(CandidateName));
+
+	if (SpacecraftNameBatch)
+	{
+		UsedNames.Add(CandidateName);
+	}
 
 	// Got it !
 	CandidateName = BaseName.ToString() + BaseSuffix + Suffix;
 	return FText::FromString(CandidateName);
 }
 
+void AFlareGame::StartSpacecraftNameBatch()
+{
+	SpacecraftNameBatch = true;
+	UsedSpacecraftNames.Empty();
+}
+
+void AFlareGame::EndSpacecraftNameBatch()
+{
+	SpacecraftNameBatch = false;
+	UsedSpacecraftNames.Empty();
+}
+
 void AFlareGame::InitSpacecraftNameDatabase()
 {
 	StationNameList.Empty();
@@ -183,6 +183,12 @@ public:
 	/** Get a spacecraft name */
 	FText PickSpacecraftName(UFlareCompany* Owner, bool IsStation, FString BaseSuffix);
 
+	/** Keep the list of used spacecraft names while creating many spacecrafts at once */
+	void StartSpacecraftNameBatch();
+
+	/** Stop caching used spacecraft names */
+	void EndSpacecraftNameBatch();
+
 
 protected:
 
@@ -300,6 +306,10 @@ protected:
 	TArray<FText>                              CapitalShipNameList;
 	TArray<FText>                              StationNameList;
 
+	// Used names during a spacecraft creation batch
+	bool                                       SpacecraftNameBatch;
+	TSet<FString>                              UsedSpacecraftNames;
+
 	FName                                      DefaultWeaponIdentifier;
 	FName                                      DefaultTurretIdentifier;
 
@@ -470,6 +480,11 @@ public:
 		return ScenarioTools;
 	}
 
+	UFlareSaveGameSystem* GetSaveGameSystem() const
+	{
+		return SaveGameSystem;
+	}
+
 	bool IsLoadingLevel() const
 	{
 		return IsLoadingStreamingLevel;
@@ -6,6 +6,10 @@
 #include "FlareCompany.h"
 #include "FlarePlanetarium.h"
 #include "FlareSectorHelper.h"
+#include "FlareScenarioTools.h"
+#include "Log/FlareLogWriter.h"
+#include "FlareSaveGame.h"
+#include "Save/FlareSaveGameSystem.h"
 
 #include "../Data/FlareFactoryCatalogEntry.h"
 #include "../Data/FlareResourceCatalog.h"
@@ -481,6 +485,16 @@ void UFlareGameTools::CompleteQuestStep()
 	}
 }
 
+void UFlareGameTools::SetQuestTickInterval(float Interval)
+{
+	GetGame()->GetQuestManager()->SetThrottledTickInterval(Interval);
+}
+
+void UFlareGameTools::SetCombatLog(bool Enabled)
+{
+	FFlareLogWriter::SetTargetEnabled(EFlareLogTarget::Combat, Enabled);
+}
+
 
 /*----------------------------------------------------
 	World tools
@@ -534,6 +548,132 @@ void UFlareGameTools::Simulate()
 	GetGame()->ActivateCurrentSector();
 }
 
+void UFlareGameTools::SimulateDays(int32 DayCount)
+{
+	if (!GetGameWorld())
+	{
+		FLOG("AFlareGame::SimulateDays failed: no loaded world");
+		return;
+	}
+
+	if (GetActiveSector())
+	{
+		FLOG("AFlareGame::SimulateDays failed: a sector is active");
+		return;
+	}
+
+	double StartTs = FPlatformTime::Seconds();
+	FString Report = TEXT("Date,Total,Battles,AITrading,CompanyAI,Factories,People,TradeRoutes,Travels,Prices,Quests,Other,")
+		TEXT("CompanyCount,SpacecraftCount,StationCount,FleetCount,TravelCount,TradeRouteCount,FactoryCount\n");
+
+	GetGame()->DeactivateSector();
+	for (int32 DayIndex = 0; DayIndex < DayCount; DayIndex++)
+	{
+		GetGameWorld()->Simulate();
+
+		const FFlareWorldSimulationStats& Stats = GetGameWorld()->GetLastSimulationStats();
+		Report += FString::Printf(TEXT("%lld,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%d,%d,%d,%d,%d,%d,%d\n"),
+			Stats.Date, Stats.Total, Stats.Battles, Stats.AITrading, Stats.CompanyAI, Stats.Factories, Stats.People,
+			Stats.TradeRoutes, Stats.Travels, Stats.Prices, Stats.Quests, Stats.Other,
+			Stats.CompanyCount, Stats.SpacecraftCount, Stats.StationCount, Stats.FleetCount, Stats.TravelCount, Stats.TradeRouteCount, Stats.FactoryCount);
+	}
+	GetGame()->ActivateCurrentSector();
+
+	double Duration = FPlatformTime::Seconds() - StartTs;
+	FLOGV("AFlareGame::SimulateDays : simulated %d days in %fs (%f days/s)", DayCount, Duration, DayCount / FMath::Max(Duration, 0.001));
+
+	// Write the per-phase report
+	FString FileName = FString::Printf(TEXT("%s/SimulationReport.csv"), *FPaths::ProjectSavedDir());
+	if (FFileHelper::SaveStringToFile(Report, *FileName))
+	{
+		FLOGV("AFlareGame::SimulateDays : report written to %s", *FileName);
+	}
+}
+
+void UFlareGameTools::BenchmarkQuestEvents(int32 EventCount)
+{
+	int64 Checksum = 0;
+	double StartTs = FPlatformTime::Seconds();
+
+	for (int32 EventIndex = 0; EventIndex < EventCount; EventIndex++)
+	{
+		// Same shape as the income event sent on each player transaction
+		FFlareBundle Bundle = FFlareBundle().PutTag("gain-money").PutInt32("amount", EventIndex);
+
+		// Typical condition checks
+		if (Bundle.HasTag("gain-money") && !Bundle.HasTag("pay-money"))
+		{
+			Checksum += Bundle.GetInt32("amount");
+		}
+		if (Bundle.HasName("sector"))
+		{
+			Checksum++;
+		}
+	}
+
+	double Duration = FPlatformTime::Seconds() - StartTs;
+	FLOGV("UFlareGameTools::BenchmarkQuestEvents : %d events in %fs (%f ns/event, checksum %lld)",
+		EventCount, Duration, 1e9 * Duration / FMath::Max(EventCount, 1), Checksum);
+}
+
+void UFlareGameTools::BenchmarkWorldGeneration(int32 WorldCount, int32 Seed)
+{
+	if (GetGame()->IsLoadedOrCreated())
+	{
+		FLOG("UFlareGameTools::BenchmarkWorldGeneration failed: must be run from the main menu");
+		return;
+	}
+
+	FFlareCompanyDescription CompanyData = *GetPC()->GetCompanyDescription();
+	double TotalDuration = 0;
+	uint32 ReferenceHash = 0;
+	bool Deterministic = true;
+
+	for (int32 WorldIndex = 0; WorldIndex < WorldCount; WorldIndex++)
+	{
+		FMath::RandInit(Seed);
+		FMath::SRandInit(Seed);
+
+		double StartTs = FPlatformTime::Seconds();
+		GetGame()->CreateGame(CompanyData, 0, 0, false);
+		double Duration = FPlatformTime::Seconds() - StartTs;
+
+		uint32 Hash = GetGame()->GetScenarioTools()->ComputeWorldHash();
+		if (WorldIndex == 0)
+		{
+			ReferenceHash = Hash;
+		}
+		else if (Hash != ReferenceHash)
+		{
+			Deterministic = false;
+		}
+
+		FLOGV("UFlareGameTools::BenchmarkWorldGeneration : world %d generated in %fs, hash %08x", WorldIndex, Duration, Hash);
+		TotalDuration += Duration;
+
+		GetGame()->UnloadGame();
+	}
+
+	FLOGV("UFlareGameTools::BenchmarkWorldGeneration : %d worlds in %fs (%fs/world), seed %d, %s",
+		WorldCount, TotalDuration, TotalDuration / FMath::Max(WorldCount, 1), Seed,
+		Deterministic ? TEXT("deterministic") : TEXT("NOT deterministic"));
+}
+
+void UFlareGameTools::CheckPlanetarium(int32 YearCount)
+{
+	if (!GetGameWorld())
+	{
+		FLOG("UFlareGameTools::CheckPlanetarium failed: no loaded world");
+		return;
+	}
+
+	double StartTs = FPlatformTime::Seconds();
+	double MaxError = GetGameWorld()->GetPlanerarium()->CheckBodyLocations(0, YearCount * SECONDS_IN_YEAR, SECONDS_IN_HOUR + 1);
+	double Duration = FPlatformTime::Seconds() - StartTs;
+
+	FLOGV("UFlareGameTools::CheckPlanetarium : %d years checked in %fs, max error %f", YearCount, Duration, MaxError);
+}
+
 void UFlareGameTools::SetPlanatariumTimeMultiplier(float Multiplier)
 {
 	GetGame()->GetPlanetarium()->SetTimeMultiplier(Multiplier);
@@ -1784,6 +1924,156 @@ void UFlareGameTools::CreateMeteoriteGroup(FName SectorIdentifier, float PowerRa
 	GetGame()->ActivateCurrentSector();
 }
 
+void UFlareGameTools::CheckComponentTrees(int32 HitCount)
+{
+	if (!GetActiveSector())
+	{
+		FLOG("AFlareGame::CheckComponentTrees failed: no active sector");
+		return;
+	}
+
+	int32 SpacecraftCount = 0;
+	int32 Mismatches = 0;
+	for (AFlareSpacecraft* Spacecraft : GetActiveSector()->GetSpacecrafts())
+	{
+		if (Spacecraft->GetDamageSystem()->HasComponentTree())
+		{
+			Mismatches += Spacecraft->GetDamageSystem()->CheckComponentTree(HitCount);
+			SpacecraftCount++;
+		}
+	}
+
+	FLOGV("UFlareGameTools::CheckComponentTrees : %d spacecrafts checked with %d hits each, %d mismatches", SpacecraftCount, HitCount, Mismatches);
+}
+
+void UFlareGameTools::CheckDockIndexes(int32 ShipCount, int32 Iterations)
+{
+	if (!GetActiveSector())
+	{
+		FLOG("AFlareGame::CheckDockIndexes failed: no active sector");
+		return;
+	}
+
+	// Pick the ships that will churn the docks
+	TArray<AFlareSpacecraft*> Ships;
+	for (AFlareSpacecraft* Spacecraft : GetActiveSector()->GetSpacecrafts())
+	{
+		if (!Spacecraft->IsStation() && Ships.Num() < ShipCount)
+		{
+			Ships.Add(Spacecraft);
+		}
+	}
+
+	int32 StationCount = 0;
+	int32 Mismatches = 0;
+	double StartTs = FPlatformTime::Seconds();
+	for (AFlareSpacecraft* Spacecraft : GetActiveSector()->GetSpacecrafts())
+	{
+		if (Spacecraft->IsStation() && Spacecraft->GetDockingSystem()->GetDockCount() > 0)
+		{
+			Mismatches += Spacecraft->GetDockingSystem()->CheckDockIndex(Ships, Iterations);
+			StationCount++;
+		}
+	}
+	double Duration = FPlatformTime::Seconds() - StartTs;
+
+	FLOGV("UFlareGameTools::CheckDockIndexes : %d stations checked with %d ships and %d iterations each in %fs, %d mismatches",
+		StationCount, Ships.Num(), Iterations, Duration, Mismatches);
+}
+
+void UFlareGameTools::CheckEngineEnvelopes(int32 AxisCount)
+{
+	if (!GetActiveSector())
+	{
+		FLOG("AFlareGame::CheckEngineEnvelopes failed: no active sector");
+		return;
+	}
+
+	int32 ShipCount = 0;
+	float MaxError = 0;
+	for (AFlareSpacecraft* Spacecraft : GetActiveSector()->GetSpacecrafts())
+	{
+		if (!Spacecraft->IsStation())
+		{
+			MaxError = FMath::Max(MaxError, Spacecraft->GetNavigationSystem()->CheckEngineEnvelope(AxisCount));
+			ShipCount++;
+		}
+	}
+
+	FLOGV("UFlareGameTools::CheckEngineEnvelopes : %d ships checked with %d axes each, max relative error %f", ShipCount, AxisCount, MaxError);
+}
+
+void UFlareGameTools::CheckPlayerThreats(int32 FrameCount)
+{
+	if (!GetActiveSector() || !GetPC()->GetShipPawn())
+	{
+		FLOG("AFlareGame::CheckPlayerThreats failed: no active sector or player ship");
+		return;
+	}
+
+	FLOGV("UFlareGameTools::CheckPlayerThreats : checking the next %d frames", FrameCount);
+	GetPC()->StartThreatStatusCheck(FrameCount);
+}
+
+void UFlareGameTools::CompareSaveReaders(int32 SaveSlot)
+{
+	FString SaveName = GetGame()->GetSaveFileName(SaveSlot);
+	int32 Mismatches = GetGame()->GetSaveGameSystem()->CompareSaveReaders(SaveName);
+
+	if (Mismatches < 0)
+	{
+		FLOGV("AFlareGame::CompareSaveReaders failed: cannot read save slot %d", SaveSlot);
+	}
+	else
+	{
+		FLOGV("UFlareGameTools::CompareSaveReaders : save slot %d, %d mismatches", SaveSlot, Mismatches);
+	}
+}
+
+void UFlareGameTools::CheckTransactionSummaries()
+{
+	if (!GetGameWorld())
+	{
+		FLOG("AFlareGame::CheckTransactionSummaries failed: no loaded world");
+		return;
+	}
+
+	UFlareCompany* Company = GetPC()->GetCompany();
+	const TArray<FFlareTransactionLogSummary>& Summaries = Company->GetTransactionSummaries();
+
+	// Incremental totals against the log
+	int32 CheckedYears = 0;
+	int32 Mismatches = Company->CheckTransactionSummaries(Summaries, CheckedYears);
+	FLOGV("UFlareGameTools::CheckTransactionSummaries : %d summaries, %d years rebuilt from %d log entries, %d mismatches",
+		Summaries.Num(), CheckedYears, Company->GetTransactionLog().Num(), Mismatches);
+
+	// Write the company and read it back
+	UFlareSaveGame* Save = NewObject<UFlareSaveGame>(this, UFlareSaveGame::StaticClass());
+	Save->WorldData.CompanyData.Add(*Company->Save());
+	UFlareSaveGame* LoadedSave = GetGame()->GetSaveGameSystem()->RoundTripGame(Save);
+	if (!LoadedSave || LoadedSave->WorldData.CompanyData.Num() != 1)
+	{
+		FLOG("AFlareGame::CheckTransactionSummaries failed: cannot read back the saved company");
+		return;
+	}
+
+	// Every year must survive, including the ones no longer in the log
+	const TArray<FFlareTransactionLogSummary>& LoadedSummaries = LoadedSave->WorldData.CompanyData[0].TransactionSummaries;
+	int32 RoundTripMismatches = FMath::Abs(LoadedSummaries.Num() - Summaries.Num());
+	for (int32 Index = 0; Index < Summaries.Num() && Index < LoadedSummaries.Num(); Index++)
+	{
+		if (LoadedSummaries[Index].Year != Summaries[Index].Year || LoadedSummaries[Index].Amounts != Summaries[Index].Amounts)
+		{
+			FLOGV("UFlareGameTools::CheckTransactionSummaries : year %lld changed after the save round trip", Summaries[Index].Year);
+			RoundTripMismatches++;
+		}
+	}
+
+	int32 LoadedMismatches = Company->CheckTransactionSummaries(LoadedSummaries, CheckedYears);
+	FLOGV("UFlareGameTools::CheckTransactionSummaries : after the save round trip, %d changed summaries, %d mismatches with the log",
+		RoundTripMismatches, LoadedMismatches);
+}
+
 void UFlareGameTools::PrintCompanyList()
 {
 	if (!GetGameWorld())
@@ -59,6 +59,14 @@ public:
 	UFUNCTION(exec)
 	void CompleteQuestStep();
 
+	/** Set the period of throttled quest condition checks while flying */
+	UFUNCTION(exec)
+	void SetQuestTickInterval(float Interval);
+
+	/** Enable or disable the combat log file */
+	UFUNCTION(exec)
+	void SetCombatLog(bool Enabled);
+
 	UFUNCTION(exec)
 	void SetCulture(FName CultureName);
 
@@ -84,6 +92,22 @@ public:
 	UFUNCTION(exec)
 	void Simulate();
 
+	/** Simulate several days and write a per-phase timing report */
+	UFUNCTION(exec)
+	void SimulateDays(int32 DayCount);
+
+	/** Time the creation and lookup of quest event bundles */
+	UFUNCTION(exec)
+	void BenchmarkQuestEvents(int32 EventCount);
+
+	/** Generate several new worlds from the same seed, report timing and check that content matches */
+	UFUNCTION(exec)
+	void BenchmarkWorldGeneration(int32 WorldCount, int32 Seed);
+
+	/** Compare the planetarium location cache with the recursive computation */
+	UFUNCTION(exec)
+	void CheckPlanetarium(int32 YearCount);
+
 	/** Configure time multiplier for active sector planetarium */
 	UFUNCTION(exec)
 	void SetPlanatariumTimeMultiplier(float Multiplier);
@@ -276,6 +300,30 @@ public:
 	UFUNCTION(exec)
 	void CreateMeteoriteGroup(FName TargetSector, float PowerRatio);
 
+	/** Compare the component hierarchies of all spacecrafts with a full scan for random hits */
+	UFUNCTION(exec)
+	void CheckComponentTrees(int32 HitCount);
+
+	/** Run random docking requests and releases for up to ShipCount ships on all stations, and compare the dock indexes with a full scan */
+	UFUNCTION(exec)
+	void CheckDockIndexes(int32 ShipCount, int32 Iterations);
+
+	/** Compare the cached engine envelopes of all ships with a full engine scan along random axes */
+	UFUNCTION(exec)
+	void CheckEngineEnvelopes(int32 AxisCount);
+
+	/** Compare the player threat assessment with a full scan of the sector for the next frames */
+	UFUNCTION(exec)
+	void CheckPlayerThreats(int32 FrameCount);
+
+	/** Load a save slot with the stream and document save readers and compare the results field by field */
+	UFUNCTION(exec)
+	void CompareSaveReaders(int32 SaveSlot);
+
+	/** Check the player transaction totals against the retained log, before and after a save round trip */
+	UFUNCTION(exec)
+	void CheckTransactionSummaries();
+
 	/*----------------------------------------------------
 		Helper
 	----------------------------------------------------*/
@@ -216,74 +216,50 @@ bool FFlareBundle::HasPtr(FName Key) const
 
 float FFlareBundle::GetFloat(FName Key, float Default) const
 {
-	if(FloatValues.Contains(Key))
-	{
-		return FloatValues[Key];
-	}
-	return Default;
+	const float* Value = FloatValues.Find(Key);
+	return Value ? *Value : Default;
 }
 
 int32 FFlareBundle::GetInt32(FName Key, int32 Default) const
 {
-	if(Int32Values.Contains(Key))
-	{
-		return Int32Values[Key];
-	}
-	return Default;
+	const int32* Value = Int32Values.Find(Key);
+	return Value ? *Value : Default;
 }
 
 FTransform FFlareBundle::GetTransform(FName Key, const FTransform Default) const
 {
-	if(TransformValues.Contains(Key))
-	{
-		return TransformValues[Key];
-	}
-	return Default;
+	const FTransform* Value = TransformValues.Find(Key);
+	return Value ? *Value : Default;
 }
 
 TArray<FVector> FFlareBundle::GetVectorArray(FName Key) const
 {
-	if(VectorArrayValues.Contains(Key))
-	{
-		return VectorArrayValues[Key].Entries;
-	}
-	return TArray<FVector>();
+	const FVectorArray* Value = VectorArrayValues.Find(Key);
+	return Value ? Value->Entries : TArray<FVector>();
 }
 
 FName FFlareBundle::GetName(FName Key) const
 {
-	if(NameValues.Contains(Key))
-	{
-		return NameValues[Key];
-	}
-	return "";
+	const FName* Value = NameValues.Find(Key);
+	return Value ? *Value : NAME_None;
 }
 
 TArray<FName> FFlareBundle::GetNameArray(FName Key) const
 {
-	if(NameArrayValues.Contains(Key))
-	{
-		return NameArrayValues[Key].Entries;
-	}
-	return TArray<FName>();
+	const FNameArray* Value = NameArrayValues.Find(Key);
+	return Value ? Value->Entries : TArray<FName>();
 }
 
 FString FFlareBundle::GetString(FName Key) const
 {
-	if (StringValues.Contains(Key))
-	{
-		return StringValues[Key];
-	}
-	return "";
+	const FString* Value = StringValues.Find(Key);
+	return Value ? *Value : FString();
 }
 
 void* FFlareBundle::GetPtr(FName Key) const
 {
-	if (PtrValues.Contains(Key))
-	{
-		return PtrValues[Key].Entry;
-	}
-	return NULL;
+	const FPtr* Value = PtrValues.Find(Key);
+	return Value ? Value->Entry : NULL;
 }
 
 FFlareBundle& FFlareBundle::PutFloat(FName Key, float Value)
@@ -360,6 +336,87 @@ void FFlareBundle::Clear()
 	PtrValues.Empty();
 }
 
+bool FFlareBundle::Identical(const FFlareBundle* Other, uint32 PortFlags) const
+{
+	auto Equal = [](const auto& A, const auto& B)
+	{
+		return A == B;
+	};
+
+	if (Tags.Num() != Other->Tags.Num())
+	{
+		return false;
+	}
+	for (FName Tag : Tags)
+	{
+		if (!Other->Tags.Contains(Tag))
+		{
+			return false;
+		}
+	}
+
+	return FloatValues.Identical(Other->FloatValues, Equal)
+		&& Int32Values.Identical(Other->Int32Values, Equal)
+		&& TransformValues.Identical(Other->TransformValues, [](const FTransform& A, const FTransform& B) { return A.Equals(B, 0.f); })
+		&& VectorArrayValues.Identical(Other->VectorArrayValues, [](const FVectorArray& A, const FVectorArray& B) { return A.Entries == B.Entries; })
+		&& NameArrayValues.Identical(Other->NameArrayValues, [](const FNameArray& A, const FNameArray& B) { return A.Entries == B.Entries; })
+		&& NameValues.Identical(Other->NameValues, Equal)
+		&& StringValues.Identical(Other->StringValues, Equal)
+		&& PtrValues.Identical(Other->PtrValues, [](const FPtr& A, const FPtr& B) { return A.Entry == B.Entry; });
+}
+
+/** Copy the values of a bundle map to the other layout */
+template<typename SourceType, typename TargetType>
+static void CopyBundleValues(const SourceType& Source, TargetType& Target)
+{
+	for (const auto& Entry : Source)
+	{
+		Target.Add(Entry.Key, Entry.Value);
+	}
+}
+
+bool FFlareBundle::Serialize(FArchive& Ar)
+{
+	FFlareLegacyBundle Legacy;
+
+	if (Ar.IsSaving())
+	{
+		CopyBundleValues(FloatValues, Legacy.FloatValues);
+		CopyBundleValues(Int32Values, Legacy.Int32Values);
+		CopyBundleValues(TransformValues, Legacy.TransformValues);
+		CopyBundleValues(VectorArrayValues, Legacy.VectorArrayValues);
+		CopyBundleValues(NameArrayValues, Legacy.NameArrayValues);
+		CopyBundleValues(NameValues, Legacy.NameValues);
+		CopyBundleValues(StringValues, Legacy.StringValues);
+		CopyBundleValues(PtrValues, Legacy.PtrValues);
+		Legacy.Tags.Append(Tags.GetData(), Tags.Num());
+	}
+
+	// Tagged or binary as the archive requires, like the former reflected maps
+	FFlareLegacyBundle::StaticStruct()->SerializeItem(Ar, &Legacy, NULL);
+
+	if (Ar.IsLoading())
+	{
+		Clear();
+		CopyBundleValues(Legacy.FloatValues, FloatValues);
+		CopyBundleValues(Legacy.Int32Values, Int32Values);
+		CopyBundleValues(Legacy.TransformValues, TransformValues);
+		CopyBundleValues(Legacy.VectorArrayValues, VectorArrayValues);
+		CopyBundleValues(Legacy.NameArrayValues, NameArrayValues);
+		CopyBundleValues(Legacy.NameValues, NameValues);
+		CopyBundleValues(Legacy.StringValues, StringValues);
+		Tags.Append(Legacy.Tags.GetData(), Legacy.Tags.Num());
+
+		// Pointers are not saved, only their keys are kept
+		for (const auto& Entry : Legacy.PtrValues)
+		{
+			PutPtr(Entry.Key, NULL);
+		}
+	}
+
+	return true;
+}
+
 DamageCause::DamageCause():
 	Spacecraft(NULL),
 	Company(NULL),
@@ -302,6 +302,20 @@ struct FFlareTransactionLogEntry
 	FText GetComment(AFlareGame* Game) const;
 };
 
+/** Transaction totals by type for one year, kept after the detailed entries expire */
+USTRUCT()
+struct FFlareTransactionLogSummary
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(EditAnywhere, Category = Save)
+	int64 Year;
+
+	/** Total amount for each EFlareTransactionLogEntry type */
+	UPROPERTY(EditAnywhere, Category = Save)
+	TArray<int64> Amounts;
+};
+
 /** Game save data */
 USTRUCT()
 struct FFlareCompanySave
@@ -398,10 +412,14 @@ struct FFlareCompanySave
 	UPROPERTY(EditAnywhere, Category = Save)
 	TArray<FName> CaptureOrders;
 
-	/** List of company transactions */
+	/** List of recent company transactions */
 	UPROPERTY(EditAnywhere, Category = Save)
 	TArray<FFlareTransactionLogEntry> TransactionLog;
 
+	/** Yearly transaction totals */
+	UPROPERTY(EditAnywhere, Category = Save)
+	TArray<FFlareTransactionLogSummary> TransactionSummaries;
+
 	/** Quantity of damage deal to others companies */
 	UPROPERTY(EditAnywhere, Category = Save)
 	float Retaliation;
@@ -577,9 +595,9 @@ struct FPtr
 	void* Entry;
 };
 
-/** Generic storage system */
+/** Former reflected bundle layout, still used to read and write bundles in binary saves */
 USTRUCT()
-struct FFlareBundle
+struct FFlareLegacyBundle
 {
 	GENERATED_USTRUCT_BODY()
 
@@ -609,6 +627,116 @@ struct FFlareBundle
 
 	UPROPERTY(EditAnywhere, Category = Save)
 	TMap<FName, FPtr> PtrValues;
+};
+
+/** Small keyed list stored contiguously, with inline room for the first entries */
+template<typename ValueType, typename AllocatorType = FDefaultAllocator>
+struct TFlareBundleMap
+{
+	struct FEntry
+	{
+		FName Key;
+		ValueType Value;
+	};
+
+	TArray<FEntry, AllocatorType> Entries;
+
+	const ValueType* Find(FName Key) const
+	{
+		for (const FEntry& Entry : Entries)
+		{
+			if (Entry.Key == Key)
+			{
+				return &Entry.Value;
+			}
+		}
+		return NULL;
+	}
+
+	ValueType* Find(FName Key)
+	{
+		return const_cast<ValueType*>(static_cast<const TFlareBundleMap*>(this)->Find(Key));
+	}
+
+	bool Contains(FName Key) const
+	{
+		return Find(Key) != NULL;
+	}
+
+	/** Add a value, replacing the existing one for this key */
+	void Add(FName Key, const ValueType& Value)
+	{
+		ValueType* Existing = Find(Key);
+		if (Existing)
+		{
+			*Existing = Value;
+		}
+		else
+		{
+			Entries.Add(FEntry{ Key, Value });
+		}
+	}
+
+	int32 Num() const
+	{
+		return Entries.Num();
+	}
+
+	/** Check that both lists hold the same keys with equal values, in any order */
+	template<typename CompareType>
+	bool Identical(const TFlareBundleMap& Other, CompareType Compare) const
+	{
+		if (Entries.Num() != Other.Entries.Num())
+		{
+			return false;
+		}
+
+		for (const FEntry& Entry : Entries)
+		{
+			const ValueType* OtherValue = Other.Find(Entry.Key);
+			if (!OtherValue || !Compare(Entry.Value, *OtherValue))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void Empty()
+	{
+		Entries.Reset();
+	}
+
+	FORCEINLINE auto begin() -> decltype(Entries.begin()) { return Entries.begin(); }
+	FORCEINLINE auto end() -> decltype(Entries.end()) { return Entries.end(); }
+	FORCEINLINE auto begin() const -> decltype(Entries.begin()) { return Entries.begin(); }
+	FORCEINLINE auto end() const -> decltype(Entries.end()) { return Entries.end(); }
+};
+
+/** Generic storage system. Values are kept in small typed lists rather than hash maps,
+ *  so that short-lived event bundles holding a few keys don't allocate. */
+USTRUCT()
+struct FFlareBundle
+{
+	GENERATED_USTRUCT_BODY()
+
+	TFlareBundleMap<float, TInlineAllocator<2>> FloatValues;
+
+	TFlareBundleMap<int32, TInlineAllocator<4>> Int32Values;
+
+	TFlareBundleMap<FTransform> TransformValues;
+
+	TFlareBundleMap<FVectorArray> VectorArrayValues;
+
+	TFlareBundleMap<FNameArray> NameArrayValues;
+
+	TFlareBundleMap<FName, TInlineAllocator<4>> NameValues;
+
+	TFlareBundleMap<FString> StringValues;
+
+	TArray<FName, TInlineAllocator<4>> Tags;
+
+	TFlareBundleMap<FPtr, TInlineAllocator<2>> PtrValues;
 
 	bool HasFloat(FName Key) const;
 	bool HasInt32(FName Key) const;
@@ -641,6 +769,22 @@ struct FFlareBundle
 	FFlareBundle& PutPtr(FName Key, void* Value);
 
 	void Clear();
+
+	/** Compare the stored values, as the value lists are not reflected */
+	bool Identical(const FFlareBundle* Other, uint32 PortFlags) const;
+
+	/** Serialize the values through the legacy reflected layout, for binary saves */
+	bool Serialize(FArchive& Ar);
+};
+
+template<>
+struct TStructOpsTypeTraits<FFlareBundle> : public TStructOpsTypeTraitsBase2<FFlareBundle>
+{
+	enum
+	{
+		WithIdentical = true,
+		WithSerializer = true,
+	};
 };
 
 struct DamageCause
@@ -11,6 +11,12 @@
 
 //#define PLANETARIUM_DEBUG
 
+DECLARE_CYCLE_STAT(TEXT("FlarePlanetarium Tick"), STAT_FlarePlanetarium_Tick, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlarePlanetarium UpdateBodies"), STAT_FlarePlanetarium_UpdateBodies, STATGROUP_Flare);
+
+// Celestial body update period at normal time speed, in s
+#define PLANETARIUM_BODY_UPDATE_PERIOD 0.25f
+
 
 /*----------------------------------------------------
 	Constructor
@@ -23,6 +29,12 @@ AFlarePlanetarium::AFlarePlanetarium(const class FObjectInitializer& PCIP)
 	TimeMultiplier = 1.0;
 	SkipNightTimeRange = 0;
 	Ready = false;
+	Sky = NULL;
+	Light = NULL;
+	TimeSinceBodyUpdate = 0;
+	BodyUpdatePeriod = PLANETARIUM_BODY_UPDATE_PERIOD;
+	BodyUpdateRequested = true;
+	SnapBodyDisplay = true;
 }
 
 void AFlarePlanetarium::BeginPlay()
@@ -36,6 +48,8 @@ void AFlarePlanetarium::BeginPlay()
 		UStaticMeshComponent* PlanetCandidate = Cast<UStaticMeshComponent>(Components[ComponentIndex]);
 		if (PlanetCandidate)
 		{
+			BodyComponents.Add(FName(*PlanetCandidate->GetName()), PlanetCandidate);
+
 			// Apply a new dynamic material to planets so that we can control shading parameters
 			UMaterialInstanceConstant* BasePlanetMaterial = Cast<UMaterialInstanceConstant>(PlanetCandidate->GetMaterial(0));
 			if (BasePlanetMaterial)
@@ -57,9 +71,12 @@ void AFlarePlanetarium::BeginPlay()
 
 void AFlarePlanetarium::Tick(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_FlarePlanetarium_Tick);
+
 	Super::Tick(DeltaSeconds);
 
 	SmoothTime += DeltaSeconds * TimeMultiplier;
+	TimeSinceBodyUpdate += DeltaSeconds;
 
 	if (GetGame())
 	{
@@ -84,33 +101,30 @@ void AFlarePlanetarium::Tick(float DeltaSeconds)
 				PreviousSector = CurrentSector;
 			}
 
-			if (Sky == NULL)
+			if (ResolvedSector.Get() != GetGame()->GetActiveSector())
 			{
-				for (TActorIterator<AActor> ActorItr(GetWorld()); ActorItr; ++ActorItr)
-				{
-					if ((*ActorItr)->GetName().StartsWith("Skybox"))
-					{
-						FLOG("AFlarePlanetarium::Tick : found the sky");
-						Sky = *ActorItr;
-						break;
-					}
-				}
+				ResolveSkyAndLight();
+				ResolvedSector = GetGame()->GetActiveSector();
+				BodyUpdateRequested = true;
+				SnapBodyDisplay = true;
 			}
 
-			if (Light == NULL)
+			// Orbital motion is slow, only recompute bodies a few times per second at normal speed
+			BodyUpdatePeriod = PLANETARIUM_BODY_UPDATE_PERIOD / FMath::Max(TimeMultiplier, 1.0f);
+			if (!Ready || LightWasAdjusted || SkipNightTimeRange > 0 || TimeSinceBodyUpdate >= BodyUpdatePeriod)
 			{
-				TArray<UActorComponent*> Components = GetComponentsByClass(UDirectionalLightComponent::StaticClass());
-				for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
-				{
-					UDirectionalLightComponent* LightCandidate = Cast<UDirectionalLightComponent>(Components[ComponentIndex]);
-					if (LightCandidate)
-					{
-						Light = LightCandidate;
-						break;
-					}
-				}
+				BodyUpdateRequested = true;
 			}
 
+			if (!BodyUpdateRequested)
+			{
+				UpdateCelestialBodyDisplay();
+				return;
+			}
+
+			SCOPE_CYCLE_COUNTER(STAT_FlarePlanetarium_UpdateBodies);
+			BodyUpdateRequested = false;
+			SnapBodyDisplay = SnapBodyDisplay || !Ready || LightWasAdjusted;
 			Ready = true;
 
 			do
@@ -170,10 +184,6 @@ void AFlarePlanetarium::Tick(float DeltaSeconds)
 						Sky->SetActorRotation(FRotator(-AngleOffset, 0 , 0));
 						//FLOGV("Sky %s rotation= %s",*Sky->GetName(),  *Sky->GetActorRotation().ToString());
 					}
-					else
-					{
-						FLOG("AFlarePlanetarium::Tick : no sky found");
-					}
 
 					//FLOGV("SunOcclusion %f", SunOcclusion);
 					if (Light)
@@ -189,10 +199,6 @@ void AFlarePlanetarium::Tick(float DeltaSeconds)
 
 						Light->SetIntensity(Intensity);
 					}
-					else
-					{
-						FLOG("AFlarePlanetarium::Tick : no sunlight found");
-					}
 				}
 				else
 				{
@@ -213,10 +219,102 @@ void AFlarePlanetarium::Tick(float DeltaSeconds)
 					Cast<ASkyLight>(SkylightCandidates[0])->GetLightComponent()->RecaptureSky();
 				}
 			}
+
+			TimeSinceBodyUpdate = 0;
+			UpdateCelestialBodyDisplay();
+			SnapBodyDisplay = false;
 		}
 	}
 }
 
+void AFlarePlanetarium::ResolveSkyAndLight()
+{
+	// Keep the results, found or not, until the next sector activation
+	if (Sky == NULL || Sky->IsPendingKill())
+	{
+		Sky = NULL;
+		for (TActorIterator<AActor> ActorItr(GetWorld()); ActorItr; ++ActorItr)
+		{
+			if ((*ActorItr)->GetName().StartsWith("Skybox"))
+			{
+				FLOG("AFlarePlanetarium::ResolveSkyAndLight : found the sky");
+				Sky = *ActorItr;
+				break;
+			}
+		}
+
+		if (Sky == NULL)
+		{
+			FLOG("AFlarePlanetarium::ResolveSkyAndLight : no sky found");
+		}
+	}
+
+	if (Light == NULL)
+	{
+		TArray<UActorComponent*> Components = GetComponentsByClass(UDirectionalLightComponent::StaticClass());
+		for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+		{
+			UDirectionalLightComponent* LightCandidate = Cast<UDirectionalLightComponent>(Components[ComponentIndex]);
+			if (LightCandidate)
+			{
+				Light = LightCandidate;
+				break;
+			}
+		}
+
+		if (Light == NULL)
+		{
+			FLOG("AFlarePlanetarium::ResolveSkyAndLight : no sunlight found");
+		}
+	}
+}
+
+void AFlarePlanetarium::SetCelestialBodyDisplay(UStaticMeshComponent* BodyComponent, const FTransform& Target)
+{
+	for (CelestialBodyDisplay& Display : BodyDisplays)
+	{
+		if (Display.BodyComponent == BodyComponent)
+		{
+			// Start from the currently displayed transform
+			float Alpha = FMath::Clamp(TimeSinceBodyUpdate / BodyUpdatePeriod, 0.0f, 1.0f);
+			FTransform Current;
+			Current.Blend(Display.Previous, Display.Target, Alpha);
+
+			Display.Previous = SnapBodyDisplay ? Target : Current;
+			Display.Target = Target;
+			return;
+		}
+	}
+
+	CelestialBodyDisplay Display;
+	Display.BodyComponent = BodyComponent;
+	Display.Previous = Target;
+	Display.Target = Target;
+	BodyDisplays.Add(Display);
+}
+
+void AFlarePlanetarium::UpdateCelestialBodyDisplay()
+{
+	FVector PlayerShipLocation = FVector::ZeroVector;
+	if (GetGame()->GetPC()->GetShipPawn())
+	{
+		PlayerShipLocation = GetGame()->GetPC()->GetShipPawn()->GetActorLocation();
+	}
+
+	float Alpha = FMath::Clamp(TimeSinceBodyUpdate / BodyUpdatePeriod, 0.0f, 1.0f);
+
+	for (const CelestialBodyDisplay& Display : BodyDisplays)
+	{
+		FTransform Current;
+		Current.Blend(Display.Previous, Display.Target, Alpha);
+
+		Display.BodyComponent->SetRelativeLocation(Current.GetLocation() + PlayerShipLocation);
+		Display.BodyComponent->SetRelativeScale3D(Current.GetScale3D());
+		Display.BodyComponent->SetRelativeRotation(FQuat::Identity);
+		Display.BodyComponent->SetRelativeRotation(Current.GetRotation());
+	}
+}
+
 inline static bool BodyDistanceComparator (const CelestialBodyPosition& ip1, const CelestialBodyPosition& ip2)
 {
 	return (ip1.Distance < ip2.Distance);
@@ -278,34 +376,23 @@ void AFlarePlanetarium::SetupCelestialBodies()
 
 void AFlarePlanetarium::SetupCelestialBody(CelestialBodyPosition* BodyPosition, double DisplayDistance, double DisplayRadius)
 {
-	FVector PlayerShipLocation = FVector::ZeroVector;
-	if (GetGame()->GetPC()->GetShipPawn())
-	{
-		PlayerShipLocation = GetGame()->GetPC()->GetShipPawn()->GetActorLocation();
-	}
-
 #ifdef PLANETARIUM_DEBUG
 	DrawDebugSphere(GetWorld(), FVector::ZeroVector, DisplayDistance /1000 , 32, FColor::Blue, false);
 
-	PlayerShipLocation = FVector::ZeroVector;
 	DisplayRadius /= 1000;
 	DisplayDistance /= 1000;
 #endif
 
-	BodyPosition->BodyComponent->SetRelativeLocation((DisplayDistance * BodyPosition->AlignedLocation.GetUnsafeNormal()).ToVector() + PlayerShipLocation);
+	// Location is relative to the player ship, added when displayed
+	FVector DisplayLocation = (DisplayDistance * BodyPosition->AlignedLocation.GetUnsafeNormal()).ToVector();
 
 	float Scale = DisplayRadius / 512; // Mesh size is 1024;
-	BodyPosition->BodyComponent->SetRelativeScale3D(FPreciseVector(Scale).ToVector());
 
 	FTransform BaseRotation = FTransform(FRotator(0, 0 ,90));
 	FTransform TimeRotation = FTransform(FRotator(0, BodyPosition->TotalRotation, 0));
 
 	FQuat Rotation = (TimeRotation * BaseRotation).GetRotation();
 
-	// TODO Rotation float time interpolation
-	BodyPosition->BodyComponent->SetRelativeRotation(FQuat::Identity);
-	BodyPosition->BodyComponent->SetRelativeRotation(Rotation);
-
 	// Apply sun direction to component
 	UMaterialInstanceDynamic* ComponentMaterial = Cast<UMaterialInstanceDynamic>(BodyPosition->BodyComponent->GetMaterial(0));
 	if (!ComponentMaterial)
@@ -345,9 +432,11 @@ void AFlarePlanetarium::SetupCelestialBody(CelestialBodyPosition* BodyPosition,
 	// Sun also rotates to track direction
 	if (BodyPosition->Body == &Sun)
 	{
-		BodyPosition->BodyComponent->SetRelativeRotation(SunDirection.ToVector().Rotation());
+		Rotation = SunDirection.ToVector().Rotation().Quaternion();
 	}
 
+	SetCelestialBodyDisplay(BodyPosition->BodyComponent, FTransform(Rotation, DisplayLocation, FPreciseVector(Scale).ToVector()));
+
 	// Compute sun occlusion
 	if (BodyPosition->Body != &Sun)
 	{
@@ -425,17 +514,8 @@ void AFlarePlanetarium::PrepareCelestialBody(FFlareCelestialBody* Body, FPrecise
 	BodyPosition.TotalRotation = Body->RotationAngle + AngleOffset;
 
 	// Find the celestial body component
-	UStaticMeshComponent* BodyComponent = NULL;
-	TArray<UActorComponent*> Components = GetComponentsByClass(UStaticMeshComponent::StaticClass());
-	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
-	{
-		UStaticMeshComponent* ComponentCandidate = Cast<UStaticMeshComponent>(Components[ComponentIndex]);
-		if (ComponentCandidate && ComponentCandidate->GetName() == Body->Identifier.ToString()	)
-		{
-			BodyComponent = ComponentCandidate;
-			break;
-		}
-	}
+	UStaticMeshComponent** BodyComponentEntry = BodyComponents.Find(Body->Identifier);
+	UStaticMeshComponent* BodyComponent = BodyComponentEntry ? *BodyComponentEntry : NULL;
 
 	if (BodyComponent)
 	{
@@ -464,11 +544,14 @@ void AFlarePlanetarium::PrepareCelestialBody(FFlareCelestialBody* Body, FPrecise
 void AFlarePlanetarium::ResetTime()
 {
 	SmoothTime = 0;
+	BodyUpdateRequested = true;
+	SnapBodyDisplay = true;
 }
 
 void AFlarePlanetarium::SetTimeMultiplier(float Multiplier)
 {
 	TimeMultiplier = Multiplier;
+	BodyUpdateRequested = true;
 }
 
 void AFlarePlanetarium::SkipNight(float TimeRange)
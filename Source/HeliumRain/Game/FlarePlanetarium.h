@@ -17,8 +17,17 @@ struct CelestialBodyPosition
 	FPreciseVector AlignedLocation;
 };
 
+/** Displayed transform of a celestial body component, relative to the player ship */
+struct CelestialBodyDisplay
+{
+	UStaticMeshComponent* BodyComponent;
+	FTransform Previous;
+	FTransform Target;
+};
+
 
 struct FFlareCelestialBody;
+class UFlareSector;
 
 UCLASS()
 class HELIUMRAIN_API AFlarePlanetarium : public AActor
@@ -42,6 +51,15 @@ public:
 
 	void SetupCelestialBody(CelestialBodyPosition* BodyPosition, double DisplayDistance, double DisplayRadius);
 
+	/** Set the new target transform of a celestial body component */
+	void SetCelestialBodyDisplay(UStaticMeshComponent* BodyComponent, const FTransform& Target);
+
+	/** Move the celestial body components between their previous and target transforms */
+	void UpdateCelestialBodyDisplay();
+
+	/** Find the sky actor and sun light, once per sector activation */
+	void ResolveSkyAndLight();
+
 	/** Reset the current time */
 	void ResetTime();
 
@@ -84,6 +102,8 @@ protected:
 
 	AActor* Sky;
 	UDirectionalLightComponent* Light;
+	TWeakObjectPtr<UFlareSector> ResolvedSector;
+	TMap<FName, UStaticMeshComponent*> BodyComponents;
 
 	FName PreviousSector;
 	FName CurrentSector;
@@ -101,7 +121,14 @@ protected:
 	float SkipNightTimeRange;
 	bool Ready;
 
+	// Celestial bodies are recomputed at a reduced rate and interpolated in between
+	float TimeSinceBodyUpdate;
+	float BodyUpdatePeriod;
+	bool BodyUpdateRequested;
+	bool SnapBodyDisplay;
+
 	TArray<CelestialBodyPosition> BodyPositions;
+	TArray<CelestialBodyDisplay> BodyDisplays;
 	FPreciseVector SunDirection;
 
 public:
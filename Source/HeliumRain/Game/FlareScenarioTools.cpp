@@ -3,6 +3,7 @@
 #include "../Flare.h"
 
 #include "../Data/FlareResourceCatalog.h"
+#include "../Data/FlareSpacecraftCatalog.h"
 
 #include "../Economy/FlareFactory.h"
 #include "../Economy/FlareCargoBay.h"
@@ -196,6 +197,57 @@ UFlareSimulatedSpacecraft* UFlareScenarioTools::CreateRecoveryPlayerShip()
 	return CreatePlayerShip(FirstLight, "ship-solen");
 }
 
+uint32 UFlareScenarioTools::ComputeWorldHash() const
+{
+	uint32 Hash = 0;
+
+	// Names are hashed by content, FName indices change from one run to another
+	auto HashName = [&Hash](FName Name)
+	{
+		Hash = FCrc::StrCrc32(*Name.ToString(), Hash);
+	};
+
+	for (UFlareSimulatedSector* Sector : World->GetSectors())
+	{
+		HashName(Sector->GetIdentifier());
+
+		for (const FFlareAsteroidSave& Asteroid : Sector->Save()->AsteroidData)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Asteroid.AsteroidMeshID));
+			Hash = HashCombine(Hash, GetTypeHash(Asteroid.Location));
+			Hash = HashCombine(Hash, GetTypeHash(Asteroid.Scale));
+		}
+	}
+
+	for (UFlareCompany* Company : World->GetCompanies())
+	{
+		HashName(Company->GetIdentifier());
+		Hash = HashCombine(Hash, GetTypeHash(Company->GetMoney()));
+
+		TArray<UFlareSimulatedSpacecraft*> Spacecrafts = Company->GetCompanyStations();
+		Spacecrafts.Append(Company->GetCompanyChildStations());
+		Spacecrafts.Append(Company->GetCompanyShips());
+		for (UFlareSimulatedSpacecraft* Spacecraft : Spacecrafts)
+		{
+			FFlareSpacecraftSave* Data = Spacecraft->Save();
+			HashName(Data->Immatriculation);
+			HashName(Data->Identifier);
+			HashName(Spacecraft->GetCurrentSector() ? Spacecraft->GetCurrentSector()->GetIdentifier() : NAME_None);
+			Hash = HashCombine(Hash, GetTypeHash(Data->Location));
+			Hash = HashCombine(Hash, GetTypeHash(Data->Level));
+			Hash = HashCombine(Hash, GetTypeHash(Data->AsteroidData.Location));
+
+			for (const FFlareCargoSave& Cargo : Data->ProductionCargoBay)
+			{
+				HashName(Cargo.ResourceIdentifier);
+				Hash = HashCombine(Hash, GetTypeHash(Cargo.Quantity));
+			}
+		}
+	}
+
+	return Hash;
+}
+
 
 /*----------------------------------------------------
 	Common world
@@ -203,6 +255,9 @@ UFlareSimulatedSpacecraft* UFlareScenarioTools::CreateRecoveryPlayerShip()
 
 void UFlareScenarioTools::SetupWorld()
 {
+	// Nobody else creates spacecrafts during generation, names can be tracked once
+	Game->StartSpacecraftNameBatch();
+
 	// Setup common stuff
 	SetupAsteroids();
 
@@ -430,6 +485,8 @@ void UFlareScenarioTools::SetupWorld()
 	CreateShips(ShipGhoul, Pirates, Boneyard, 5);
 	CreateShips(ShipDragon, Pirates, Boneyard, 1);
 	CreateShips(ShipGhoul, BrokenMoon, Colossus, 2);
+
+	Game->EndSpacecraftNameBatch();
 }
 
 void UFlareScenarioTools::SetupAsteroids()
@@ -486,6 +543,25 @@ void UFlareScenarioTools::SetupKnownSectors(UFlareCompany* Company)
 }
 
 
+FFlareSpacecraftDescription* UFlareScenarioTools::GetSpacecraftDescription(FName Identifier, FString DefaultPrefix)
+{
+	FFlareSpacecraftDescription** CachedDesc = SpacecraftDescriptions.Find(Identifier);
+	if (CachedDesc)
+	{
+		return *CachedDesc;
+	}
+
+	FFlareSpacecraftDescription* Desc = Game->GetSpacecraftCatalog()->Get(Identifier);
+	if (!Desc)
+	{
+		Desc = Game->GetSpacecraftCatalog()->Get(FName(*(DefaultPrefix + Identifier.ToString())));
+	}
+
+	SpacecraftDescriptions.Add(Identifier, Desc);
+	return Desc;
+}
+
+
 /*----------------------------------------------------
 	Helpers
 ----------------------------------------------------*/
@@ -515,6 +591,15 @@ void UFlareScenarioTools::CreateAsteroids(UFlareSimulatedSector* Sector, int32 C
 		int32 AsteroidCount = 0;
 		int32 CellCount = DistributionShape.X * DistributionShape.Y * DistributionShape.Z * 4;
 		int32 FailCount = 0;
+		int32 AsteroidCatalogCount = Game->GetAsteroidCatalog() ? Game->GetAsteroidCatalog()->Asteroids.Num() : 0;
+
+		// Candidates lie on a grid with a MaxAsteroidDistance step, so new asteroids only collide if they share a cell
+		TSet<FIntVector> UsedCells;
+		TArray<FVector> ExistingLocations;
+		for (const FFlareAsteroidSave& Asteroid : Sector->Save()->AsteroidData)
+		{
+			ExistingLocations.Add(Asteroid.Location);
+		}
 
 		while (AsteroidCount < Count && FailCount < 5000)
 		{
@@ -526,17 +611,16 @@ void UFlareScenarioTools::CreateAsteroids(UFlareSimulatedSector* Sector, int32 C
 					{
 						if (FMath::RandHelper(CellCount) <= Count)
 						{
-							bool CanSpawn = true;
+							FIntVector Cell(X, Y, Z);
 							FVector AsteroidLocation = MaxAsteroidDistance * FVector(X, Y, Z);
 
 							// Check for collision
-							TArray<FFlareAsteroidSave> Asteroids = Sector->Save()->AsteroidData;
-							for (int32 Index = 0; Index < Asteroids.Num(); Index++)
+							bool CanSpawn = !UsedCells.Contains(Cell);
+							for (int32 Index = 0; CanSpawn && Index < ExistingLocations.Num(); Index++)
 							{
-								if ((Asteroids[Index].Location - AsteroidLocation).Size() < MaxAsteroidDistance)
+								if ((ExistingLocations[Index] - AsteroidLocation).Size() < MaxAsteroidDistance)
 								{
 									CanSpawn = false;
-									break;
 								}
 							}
 
@@ -544,7 +628,7 @@ void UFlareScenarioTools::CreateAsteroids(UFlareSimulatedSector* Sector, int32 C
 							if (CanSpawn)
 							{
 								FString AsteroidName = FString("asteroid") + FString::FromInt(AsteroidCount);
-								int32 AsteroidCatalogCount = Game->GetAsteroidCatalog() ? Game->GetAsteroidCatalog()->Asteroids.Num() : 0;
+								UsedCells.Add(Cell);
 								Sector->CreateAsteroid(FMath::RandRange(0, AsteroidCatalogCount - 1), FName(*AsteroidName), AsteroidLocation);
 								AsteroidCount++;
 							}
@@ -564,22 +648,36 @@ void UFlareScenarioTools::CreateAsteroids(UFlareSimulatedSector* Sector, int32 C
 
 void UFlareScenarioTools::CreateShips(FName ShipClass, UFlareCompany* Company, UFlareSimulatedSector* Sector, uint32 Count)
 {
-	if (Sector && Company)
+	if (Sector && Company && Count > 0)
 	{
+		FFlareSpacecraftDescription* Desc = GetSpacecraftDescription(ShipClass, "ship-");
+		if (!Desc)
+		{
+			FLOGV("UFlareScenarioTools::CreateShips : unknown ship '%s'", *ShipClass.ToString());
+			return;
+		}
+
 		for (uint32 Index = 0; Index < Count; Index++)
 		{
-			Sector->CreateSpacecraft(ShipClass, Company, FVector::ZeroVector);
+			Sector->CreateSpacecraft(Desc, Company, FVector::ZeroVector);
 		}
 	}
 }
 
 void UFlareScenarioTools::CreateStations(FName StationClass, UFlareCompany* Company, UFlareSimulatedSector* Sector, uint32 Count, int32 Level, FFlareStationSpawnParameters SpawnParameters)
 {
-	if (Sector && Company)
+	if (Sector && Company && Count > 0)
 	{
+		FFlareSpacecraftDescription* Desc = GetSpacecraftDescription(StationClass, "station-");
+		if (!Desc)
+		{
+			FLOGV("UFlareScenarioTools::CreateStations : unknown station '%s'", *StationClass.ToString());
+			return;
+		}
+
 		for (uint32 Index = 0; Index < Count; Index++)
 		{
-			UFlareSimulatedSpacecraft* Station = Sector->CreateStation(StationClass, Company, false, SpawnParameters);
+			UFlareSimulatedSpacecraft* Station = Sector->CreateStation(Desc, Company, false, SpawnParameters);
 
 			if (!Station)
 			{
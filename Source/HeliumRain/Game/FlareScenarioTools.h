@@ -36,6 +36,9 @@ public:
 	/** Add a new player ship */
 	UFlareSimulatedSpacecraft* CreateRecoveryPlayerShip();
 
+	/** Hash the generated content of the world, to check that generation is reproducible */
+	uint32 ComputeWorldHash() const;
+
 	
 protected:
 
@@ -52,6 +55,9 @@ protected:
 	/** Discover all known sectors*/
 	void SetupKnownSectors(UFlareCompany* Company);
 
+	/** Resolve a spacecraft description once per generation */
+	FFlareSpacecraftDescription* GetSpacecraftDescription(FName Identifier, FString DefaultPrefix);
+
 
 public:
 
@@ -96,6 +102,9 @@ protected:
 	AFlareGame*                                Game;
 	UFlareWorld*                               World;
 
+	// Resolved catalog entries
+	TMap<FName, FFlareSpacecraftDescription*>  SpacecraftDescriptions;
+
 public:
 
 	/*----------------------------------------------------
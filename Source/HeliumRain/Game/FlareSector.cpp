@@ -12,6 +12,11 @@
 #include "../Spacecrafts/FlareShell.h"
 #include "../Spacecrafts/FlareSpacecraft.h"
 
+DECLARE_CYCLE_STAT(TEXT("FlareSector Load"), STAT_FlareSector_Load, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlareSector TickLoading"), STAT_FlareSector_TickLoading, STATGROUP_Flare);
+
+#define SECTOR_LOADING_FRAME_BUDGET 0.004
+
 
 /*----------------------------------------------------
 	Constructor
@@ -22,6 +27,8 @@ UFlareSector::UFlareSector(const FObjectInitializer& ObjectInitializer)
 {
 	SectorRepartitionCache = false;
 	IsDestroyingSector = false;
+	PendingAsteroidIndex = 0;
+	IsPaused = false;
 }
 
 /*----------------------------------------------------
@@ -30,15 +37,25 @@ UFlareSector::UFlareSector(const FObjectInitializer& ObjectInitializer)
 
 void UFlareSector::Load(UFlareSimulatedSector* Parent)
 {
+	SCOPE_CYCLE_COUNTER(STAT_FlareSector_Load);
+	double StartTs = FPlatformTime::Seconds();
+
 	DestroySector();
 	ParentSector = Parent;
 	LocalTime = Parent->GetData()->LocalTime;
 
-	// Load asteroids
-	for (int i = 0 ; i < ParentSector->GetData()->AsteroidData.Num(); i++)
+	// Colliders are level actors, they don't change while the sector is active
+	UGameplayStatics::GetAllActorsOfClass(GetGame()->GetWorld(), AFlareCollider::StaticClass(), SectorColliders);
+
+	// Asteroids are spawned over the next frames, nearest to the player first
+	PendingAsteroids = ParentSector->GetData()->AsteroidData;
+	PendingAsteroidIndex = 0;
+	UFlareSimulatedSpacecraft* PlayerShip = Parent->GetGame()->GetPC()->GetPlayerShip();
+	FVector LoadingCenter = (PlayerShip && PlayerShip->GetCurrentSector() == Parent) ? PlayerShip->GetData().Location : FVector::ZeroVector;
+	PendingAsteroids.Sort([LoadingCenter](const FFlareAsteroidSave& A, const FFlareAsteroidSave& B)
 	{
-		LoadAsteroid(ParentSector->GetData()->AsteroidData[i]);
-	}
+		return FVector::DistSquared(A.Location, LoadingCenter) < FVector::DistSquared(B.Location, LoadingCenter);
+	});
 
 	// Load meteorite
 	for (FFlareMeteoriteSave& Meteorite : ParentSector->GetData()->MeteoriteData)
@@ -76,6 +93,34 @@ void UFlareSector::Load(UFlareSimulatedSector* Parent)
 	{
 		LoadBomb(ParentSector->GetData()->BombData[i]);
 	}
+
+	FLOGV("UFlareSector::Load : loaded '%s' in %fs, %d asteroids pending",
+		*ParentSector->GetSectorName().ToString(), FPlatformTime::Seconds() - StartTs, PendingAsteroids.Num() - PendingAsteroidIndex);
+}
+
+void UFlareSector::TickLoading()
+{
+	if (!IsLoading())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_FlareSector_TickLoading);
+	double StartTs = FPlatformTime::Seconds();
+
+	// Spawn at least one asteroid per frame
+	do
+	{
+		LoadAsteroid(PendingAsteroids[PendingAsteroidIndex]);
+		PendingAsteroidIndex++;
+	}
+	while (PendingAsteroidIndex < PendingAsteroids.Num() && FPlatformTime::Seconds() - StartTs < SECTOR_LOADING_FRAME_BUDGET);
+
+	if (PendingAsteroidIndex >= PendingAsteroids.Num())
+	{
+		PendingAsteroids.Empty();
+		PendingAsteroidIndex = 0;
+	}
 }
 
 void UFlareSector::Save()
@@ -97,6 +142,11 @@ void UFlareSector::Save()
 		SectorData->AsteroidData.Add(*SectorAsteroids[i]->Save());
 	}
 
+	for (int i = PendingAsteroidIndex; i < PendingAsteroids.Num(); i++)
+	{
+		SectorData->AsteroidData.Add(PendingAsteroids[i]);
+	}
+
 	for (AFlareMeteorite* Meteorite : SectorMeteorites)
 	{
 		Meteorite->Save();
@@ -142,8 +192,12 @@ void UFlareSector::DestroySector()
 	SectorStations.Empty();
 	SectorBombs.Empty();
 	SectorAsteroids.Empty();
+	SectorAsteroidSizes.Empty();
 	SectorMeteorites.Empty();
 	SectorShells.Empty();
+	SectorColliders.Empty();
+	PendingAsteroids.Empty();
+	PendingAsteroidIndex = 0;
 
 	IsDestroyingSector = false;
 }
@@ -162,7 +216,17 @@ AFlareAsteroid* UFlareSector::LoadAsteroid(const FFlareAsteroidSave& AsteroidDat
 	AFlareAsteroid* Asteroid = GetGame()->GetWorld()->SpawnActor<AFlareAsteroid>(AFlareAsteroid::StaticClass(), AsteroidData.Location, AsteroidData.Rotation, Params);
     Asteroid->Load(AsteroidData);
 
-	SectorAsteroids.AddUnique(Asteroid);
+	if (IsPaused)
+	{
+		Asteroid->SetPause(true);
+	}
+
+	if (SectorAsteroids.Find(Asteroid) == INDEX_NONE)
+	{
+		FBox AsteroidBox = Asteroid->GetComponentsBoundingBox();
+		SectorAsteroids.Add(Asteroid);
+		SectorAsteroidSizes.Add(FMath::Max(AsteroidBox.GetExtent().Size(), 1.0f));
+	}
     return Asteroid;
 }
 
@@ -474,6 +538,8 @@ void UFlareSector::UnregisterShell(AFlareShell* Shell)
 
 void UFlareSector::SetPause(bool Pause)
 {
+	IsPaused = Pause;
+
 	for (int i = 0 ; i < SectorSpacecrafts.Num(); i++)
 	{
 		SectorSpacecrafts[i]->SetPause(Pause);
@@ -520,9 +586,7 @@ AActor* UFlareSector::GetNearestBody(FVector Location, float* NearestDistance, b
 	for (int32 AsteroidIndex = 0; AsteroidIndex < GetAsteroids().Num(); AsteroidIndex++)
 	{
 		AFlareAsteroid* AsteroidCandidate = GetAsteroids()[AsteroidIndex];
-
-		FBox CandidateBox = AsteroidCandidate->GetComponentsBoundingBox();
-		float CandidateSize = FMath::Max(CandidateBox.GetExtent().Size(), 1.0f);
+		float CandidateSize = SectorAsteroidSizes[AsteroidIndex];
 
 		float Distance = FVector::Dist(AsteroidCandidate->GetActorLocation(), Location) - CandidateSize;
 		if (AsteroidCandidate != ActorToIgnore && (!NearestCandidateActor || NearestCandidateActorDistance > Distance))
@@ -532,11 +596,9 @@ AActor* UFlareSector::GetNearestBody(FVector Location, float* NearestDistance, b
 		}
 	}
 
-	TArray<AActor*> ColliderActorList;
-	UGameplayStatics::GetAllActorsOfClass(GetGame()->GetWorld(), AFlareCollider::StaticClass(), ColliderActorList);
-	for (int32 ColliderIndex = 0; ColliderIndex < ColliderActorList.Num(); ColliderIndex++)
+	for (int32 ColliderIndex = 0; ColliderIndex < SectorColliders.Num(); ColliderIndex++)
 	{
-		AActor* ColliderCandidate = ColliderActorList[ColliderIndex];
+		AActor* ColliderCandidate = SectorColliders[ColliderIndex];
 
 		float CandidateSize = Cast<UStaticMeshComponent>(ColliderCandidate->GetRootComponent())->Bounds.SphereRadius;
 
@@ -552,6 +614,27 @@ AActor* UFlareSector::GetNearestBody(FVector Location, float* NearestDistance, b
 	return NearestCandidateActor;
 }
 
+const FFlareAsteroidSave* UFlareSector::GetNearestPendingAsteroid(FVector Location, float* NearestDistance) const
+{
+	const FFlareAsteroidSave* NearestCandidate = NULL;
+	float NearestCandidateDistance = 0;
+
+	for (int32 AsteroidIndex = PendingAsteroidIndex; AsteroidIndex < PendingAsteroids.Num(); AsteroidIndex++)
+	{
+		const FFlareAsteroidSave& AsteroidCandidate = PendingAsteroids[AsteroidIndex];
+
+		float Distance = FVector::Dist(AsteroidCandidate.Location, Location) - AFlareAsteroid::GetEstimatedSize(AsteroidCandidate);
+		if (!NearestCandidate || NearestCandidateDistance > Distance)
+		{
+			NearestCandidate = &AsteroidCandidate;
+			NearestCandidateDistance = Distance;
+		}
+	}
+
+	*NearestDistance = NearestCandidateDistance;
+	return NearestCandidate;
+}
+
 void UFlareSector::PlaceSpacecraft(AFlareSpacecraft* Spacecraft, FVector Location)
 {
 	float RandomLocationRadiusIncrement = 100000; // 1000m
@@ -563,9 +646,17 @@ void UFlareSector::PlaceSpacecraft(AFlareSpacecraft* Spacecraft, FVector Locatio
 		Location += FMath::VRand() * RandomLocationRadius;
 		float Size = (Spacecraft->IsStation() ? 80000 : Spacecraft->GetMeshScale());
 		float NearestDistance;
+		float NearestPendingDistance;
+
+		// Check if location is secure, asteroids still loading are checked from their save
+		bool HasNearestBody = (GetNearestBody(Location, &NearestDistance, true, Spacecraft) != NULL);
+		if (GetNearestPendingAsteroid(Location, &NearestPendingDistance))
+		{
+			NearestDistance = HasNearestBody ? FMath::Min(NearestDistance, NearestPendingDistance) : NearestPendingDistance;
+			HasNearestBody = true;
+		}
 
-		// Check if location is secure
-		if (GetNearestBody(Location, &NearestDistance, true, Spacecraft) == NULL)
+		if (!HasNearestBody)
 		{
 			// No other ship.
 			break;
@@ -578,11 +669,9 @@ void UFlareSector::PlaceSpacecraft(AFlareSpacecraft* Spacecraft, FVector Locatio
 
 #if !UE_BUILD_SHIPPING
 	{
-		TArray<AActor*> ColliderActorList;
-		UGameplayStatics::GetAllActorsOfClass(GetGame()->GetWorld(), AFlareCollider::StaticClass(), ColliderActorList);
-		for (int32 ColliderIndex = 0; ColliderIndex < ColliderActorList.Num(); ColliderIndex++)
+		for (int32 ColliderIndex = 0; ColliderIndex < SectorColliders.Num(); ColliderIndex++)
 		{
-			AActor* ColliderCandidate = ColliderActorList[ColliderIndex];
+			AActor* ColliderCandidate = SectorColliders[ColliderIndex];
 
 			float CandidateSize = Cast<UStaticMeshComponent>(ColliderCandidate->GetRootComponent())->Bounds.SphereRadius;
 			float SpacecraftSize = Spacecraft->GetSimpleCollisionRadius();
@@ -32,6 +32,15 @@ public:
 	/** Destroy the sector */
 	virtual void DestroySector();
 
+	/** Spawn pending objects within the per-frame loading budget */
+	void TickLoading();
+
+	/** Check if some objects are still waiting to be spawned */
+	bool IsLoading() const
+	{
+		return PendingAsteroids.Num() > 0;
+	}
+
 
 	/*----------------------------------------------------
 		Gameplay
@@ -61,6 +70,9 @@ public:
 
 protected:
 
+	/** Get the nearest asteroid still waiting to be spawned, using its estimated size */
+	const FFlareAsteroidSave* GetNearestPendingAsteroid(FVector Location, float* NearestDistance) const;
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -87,6 +99,16 @@ protected:
 	UPROPERTY()
 	TArray<AFlareShell*>           SectorShells;
 
+	// Colliders and asteroid sizes, gathered once for spawn searches
+	UPROPERTY()
+	TArray<AActor*>                SectorColliders;
+	TArray<float>                  SectorAsteroidSizes;
+
+	// Asteroids not spawned yet, nearest first
+	TArray<FFlareAsteroidSave>     PendingAsteroids;
+	int32                          PendingAsteroidIndex;
+	bool                           IsPaused;
+
 	int64						   LocalTime;
 	bool						   SectorRepartitionCache;
 	bool                           IsDestroyingSector;
@@ -33,8 +33,9 @@ UFlareSimulatedSpacecraft*  SectorHelper::FindTradeStation(FlareTradeRequest Req
 	UFlareCompany* ClientCompany = Request.AllowUseNoTradeForMe ? Request.Client->GetCompany() : nullptr;
 
 
+	// Only consider stations that produce, consume or store this resource
 	UFlareSimulatedSector* Sector = Request.Client->GetCurrentSector();
-	TArray<UFlareSimulatedSpacecraft*>& SectorStations = Sector->GetSectorStations();
+	const TArray<UFlareSimulatedSpacecraft*>& SectorStations = Sector->GetTradeStationCandidates(Request.Resource);
 
 	float UnloadQuantityScoreMultiplier = 0;
 	float LoadQuantityScoreMultiplier = 0;
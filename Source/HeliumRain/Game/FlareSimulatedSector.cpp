@@ -30,6 +30,7 @@ DECLARE_CYCLE_STAT(TEXT("FlareSector GetSectorFriendlyness"), STAT_FlareSector_G
 DECLARE_CYCLE_STAT(TEXT("FlareSector GetSectorBattleState"), STAT_FlareSector_GetSectorBattleState, STATGROUP_Flare);
 
 #define FLEET_SUPPLY_CONSUMPTION_STATS 50
+#define PRICE_HISTORY_SIZE 50
 
 #define LOCTEXT_NAMESPACE "FlareSimulatedSector"
 
@@ -42,6 +43,9 @@ UFlareSimulatedSector::UFlareSimulatedSector(const FObjectInitializer& ObjectIni
 	: Super(ObjectInitializer)
 {
 	PersistentStationIndex = 0;
+	PriceHistoryWriteIndex = 0;
+	TradeStationIndexDate = -1;
+	BattleStateVersion = 0;
 }
 
 void UFlareSimulatedSector::Load(const FFlareSectorDescription* Description, const FFlareSectorSave& Data, const FFlareSectorOrbitParameters& OrbitParameters)
@@ -65,6 +69,8 @@ void UFlareSimulatedSector::Load(const FFlareSectorDescription* Description, con
 	SectorChildStations.Empty();
 	SectorSpacecrafts.Empty();
 	SectorFleets.Empty();
+	InvalidateTradeStationIndex();
+	InvalidateBattleState();
 
 	FFlareCelestialBody* Body = Game->GetGameWorld()->GetPlanerarium()->FindCelestialBody(SectorOrbitParameters.CelestialBodyIdentifier);
 	if (Body)
@@ -178,7 +184,6 @@ FFlareSectorSave* UFlareSimulatedSector::Save()
 UFlareSimulatedSpacecraft* UFlareSimulatedSector::CreateStation(FName StationClass, UFlareCompany* Company, bool UnderConstruction, FFlareStationSpawnParameters SpawnParameters)
 {
 	FFlareSpacecraftDescription* Desc = Game->GetSpacecraftCatalog()->Get(StationClass);
-	UFlareSimulatedSpacecraft* Station = NULL;
 
 	// Invalid desc ? Get a new one
 	if (!Desc)
@@ -188,35 +193,46 @@ UFlareSimulatedSpacecraft* UFlareSimulatedSector::CreateStation(FName StationCla
 
 	if (Desc)
 	{
-		bool SafeSpawn = (SpawnParameters.AttachActorName != NAME_None);
-		bool IsChildStation = (SpawnParameters.AttachComplexStationName != NAME_None);
-		Station = CreateSpacecraft(Desc, Company, SpawnParameters.Location, SpawnParameters.Rotation, NULL, SafeSpawn, UnderConstruction, SpawnParameters.AttachComplexStationName);
+		return CreateStation(Desc, Company, UnderConstruction, SpawnParameters);
+	}
+	else
+	{
+		FLOGV("CreateStation failed: Unkwnon station %s", *StationClass.ToString());
+	}
 
-		// Attach to asteroid
-		if (Station && Desc->BuildConstraint.Contains(EFlareBuildConstraint::FreeAsteroid))
-		{
-			AttachStationToAsteroid(Station);
-		}
+	return NULL;
+}
 
-		// Attach to world as substation
-		if (Station && Desc->IsSubstation)
-		{
-			FCHECK(SpawnParameters.AttachActorName != NAME_None);
-			AttachStationToActor(Station, SpawnParameters.AttachActorName);
-		}
+UFlareSimulatedSpacecraft* UFlareSimulatedSector::CreateStation(FFlareSpacecraftDescription* Desc, UFlareCompany* Company, bool UnderConstruction, FFlareStationSpawnParameters SpawnParameters)
+{
+	bool SafeSpawn = (SpawnParameters.AttachActorName != NAME_None);
+	bool IsChildStation = (SpawnParameters.AttachComplexStationName != NAME_None);
+	UFlareSimulatedSpacecraft* Station = CreateSpacecraft(Desc, Company, SpawnParameters.Location, SpawnParameters.Rotation, NULL, SafeSpawn, UnderConstruction, SpawnParameters.AttachComplexStationName);
 
-		// Attach to station complex as station element
-		if (Station && IsChildStation)
-		{
-			FCHECK(SpawnParameters.AttachComplexConnectorName != NAME_None);
-			AttachStationToComplexStation(Station, SpawnParameters.AttachComplexStationName, SpawnParameters.AttachComplexConnectorName);
-		}
+	// Attach to asteroid
+	if (Station && Desc->BuildConstraint.Contains(EFlareBuildConstraint::FreeAsteroid))
+	{
+		AttachStationToAsteroid(Station);
+	}
 
-		// Under construction
-		if (UnderConstruction && Company == GetGame()->GetPC()->GetCompany())
-		{
-			Game->GetQuestManager()->OnEvent(FFlareBundle().PutTag("start-station-construction").PutInt32("upgrade", 0));
-		}
+	// Attach to world as substation
+	if (Station && Desc->IsSubstation)
+	{
+		FCHECK(SpawnParameters.AttachActorName != NAME_None);
+		AttachStationToActor(Station, SpawnParameters.AttachActorName);
+	}
+
+	// Attach to station complex as station element
+	if (Station && IsChildStation)
+	{
+		FCHECK(SpawnParameters.AttachComplexConnectorName != NAME_None);
+		AttachStationToComplexStation(Station, SpawnParameters.AttachComplexStationName, SpawnParameters.AttachComplexConnectorName);
+	}
+
+	// Under construction
+	if (UnderConstruction && Company == GetGame()->GetPC()->GetCompany())
+	{
+		Game->GetQuestManager()->OnEvent(FFlareBundle().PutTag("start-station-construction").PutInt32("upgrade", 0));
 	}
 
 	return Station;
@@ -403,8 +419,11 @@ UFlareSimulatedSpacecraft* UFlareSimulatedSector::CreateSpacecraft(FFlareSpacecr
 
 	// Create the ship
 	Spacecraft = Company->LoadSpacecraft(ShipData);
+	InvalidateBattleState();
 	if (Spacecraft->IsStation())
 	{
+		InvalidateTradeStationIndex();
+
 		if(Spacecraft->IsComplexElement())
 		{
 			SectorChildStations.Add(Spacecraft);
@@ -470,6 +489,7 @@ void UFlareSimulatedSector::CreateAsteroid(int32 ID, FName Name, FVector Locatio
 void UFlareSimulatedSector::AddFleet(UFlareFleet* Fleet)
 {
 	SectorFleets.AddUnique(Fleet);
+	InvalidateBattleState();
 
 	for (int ShipIndex = 0; ShipIndex < Fleet->GetShips().Num(); ShipIndex++)
 	{
@@ -511,7 +531,12 @@ void UFlareSimulatedSector::RetireFleet(UFlareFleet* Fleet)
 
 int UFlareSimulatedSector::RemoveSpacecraft(UFlareSimulatedSpacecraft* Spacecraft)
 {
-	SectorStations.Remove(Spacecraft);
+	InvalidateBattleState();
+
+	if (SectorStations.Remove(Spacecraft) > 0)
+	{
+		InvalidateTradeStationIndex();
+	}
 	SectorChildStations.Remove(Spacecraft);
 	SectorShips.Remove(Spacecraft);
 	return SectorSpacecrafts.Remove(Spacecraft);
@@ -535,6 +560,14 @@ FText UFlareSimulatedSector::GetSectorDescription() const
 
 bool UFlareSimulatedSector::CanBuildStation(FFlareSpacecraftDescription* StationDescription, UFlareCompany* Company, TArray<FText>& OutReasons,
 	bool IgnoreCost, bool InComplex, bool InComplexSpecial)
+{
+	bool SectorResult = CanBuildStationInSector(Company, OutReasons, InComplex);
+	bool StationResult = CanBuildStationDescription(StationDescription, Company, OutReasons, IgnoreCost, InComplex, InComplexSpecial);
+
+	return SectorResult && StationResult;
+}
+
+bool UFlareSimulatedSector::CanBuildStationInSector(UFlareCompany* Company, TArray<FText>& OutReasons, bool InComplex)
 {
 	bool Result = true;
 
@@ -545,13 +578,6 @@ bool UFlareSimulatedSector::CanBuildStation(FFlareSpacecraftDescription* Station
 		Result = false;
 	}
 
-	// Station technology
-	if (!Company->IsTechnologyUnlockedStation(StationDescription))
-	{
-		OutReasons.Add(LOCTEXT("StationTechnologyRequired", "You need to unlock station technology first"));
-		Result = false;
-	}
-
 	// The sector has danger
 	if (GetSectorBattleState(Company).HasDanger)
 	{
@@ -582,6 +608,21 @@ bool UFlareSimulatedSector::CanBuildStation(FFlareSpacecraftDescription* Station
 		Result = false;
 	}
 
+	return Result;
+}
+
+bool UFlareSimulatedSector::CanBuildStationDescription(FFlareSpacecraftDescription* StationDescription, UFlareCompany* Company, TArray<FText>& OutReasons,
+	bool IgnoreCost, bool InComplex, bool InComplexSpecial)
+{
+	bool Result = true;
+
+	// Station technology
+	if (!Company->IsTechnologyUnlockedStation(StationDescription))
+	{
+		OutReasons.Add(LOCTEXT("StationTechnologyRequired", "You need to unlock station technology first"));
+		Result = false;
+	}
+
 	// Does it needs sun
 	if (StationDescription->BuildConstraint.Contains(EFlareBuildConstraint::SunExposure) && SectorDescription->IsSolarPoor)
 	{
@@ -788,19 +829,9 @@ void UFlareSimulatedSector::AttachStationToActor(UFlareSimulatedSpacecraft* Spac
 }
 
 void UFlareSimulatedSector::SimulatePriceVariation()
-{
-	for(int32 ResourceIndex = 0; ResourceIndex < Game->GetResourceCatalog()->Resources.Num(); ResourceIndex++)
-	{
-		FFlareResourceDescription* Resource = &Game->GetResourceCatalog()->Resources[ResourceIndex]->Data;
-		SimulatePriceVariation(Resource);
-	}
-}
-
-void UFlareSimulatedSector::SimulatePriceVariation(FFlareResourceDescription* Resource)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareSector_SimulatePriceVariation);
 
-	float OldPrice = GetPreciseResourcePrice(Resource);
 	// Prices can increase because :
 
 	//  - The input of a station is low (and less than half)
@@ -813,24 +844,61 @@ void UFlareSimulatedSector::SimulatePriceVariation(FFlareResourceDescription* Re
 	//  - Consumer ressource is full (and more than half)
 	//  - Maintenance ressource is full (and more than half) (very slow decrease)
 
+	UFlareResourceCatalog* ResourceCatalog = Game->GetResourceCatalog();
+	const int32 ResourceCount = ResourceCatalog->Resources.Num();
 
-	float WantedPriceSum = 0;
-	float WantedWeightSum = 0;
+	TArray<float> WantedPriceSums;
+	TArray<float> WantedWeightSums;
+	TArray<float> ConsumerWeights;
+	TArray<int32> StationStocks;
+	WantedPriceSums.SetNumZeroed(ResourceCount);
+	WantedWeightSums.SetNumZeroed(ResourceCount);
+	ConsumerWeights.SetNumZeroed(ResourceCount);
+	StationStocks.SetNumUninitialized(ResourceCount);
 
+	for (int32 ResourceIndex = 0; ResourceIndex < ResourceCount; ResourceIndex++)
+	{
+		FFlareResourceDescription* Resource = &ResourceCatalog->Resources[ResourceIndex]->Data;
+		if (Resource->IsConsumerResource)
+		{
+			ConsumerWeights[ResourceIndex] = GetPeople()->GetRessourceConsumption(Resource, false);
+		}
+	}
 
-	// Prices never go below min production cost
+	// Collect the supply and demand weights of all stations in one pass
 	for (int32 CountIndex = 0 ; CountIndex < SectorStations.Num(); CountIndex++)
 	{
 		UFlareSimulatedSpacecraft* Station = SectorStations[CountIndex];
+		UFlareCargoBay* CargoBay = Station->GetActiveCargoBay();
 
-		if(Station->GetActiveCargoBay()->HasRestrictions())
+		if(CargoBay->HasRestrictions())
 		{
 			// Not allow station with slot restriction to impact the price
 			continue;
 		}
 
-		float StockRatio = FMath::Clamp((float) Station->GetActiveCargoBay()->GetResourceQuantity(Resource, NULL) / (float) Station->GetActiveCargoBay()->GetSlotCapacity(), 0.f, 1.f);
+		// Stock of each resource
+		FMemory::Memzero(StationStocks.GetData(), ResourceCount * sizeof(int32));
+		for (int32 SlotIndex = 0; SlotIndex < CargoBay->GetSlotCount(); SlotIndex++)
+		{
+			FFlareCargo* Cargo = CargoBay->GetSlot(SlotIndex);
+			if (Cargo && Cargo->Resource)
+			{
+				int32 ResourceIndex = ResourceCatalog->GetResourceIndex(Cargo->Resource);
+				if (ResourceIndex != INDEX_NONE)
+				{
+					StationStocks[ResourceIndex] += Cargo->Quantity;
+				}
+			}
+		}
+
+		const float SlotCapacity = CargoBay->GetSlotCapacity();
+		auto GetStockDemand = [&](int32 ResourceIndex)
+		{
+			return 1.f - FMath::Clamp(StationStocks[ResourceIndex] / SlotCapacity, 0.f, 1.f);
+		};
 
+		// Factory inputs and outputs
 		for (int32 FactoryIndex = 0; FactoryIndex < Station->GetFactories().Num(); FactoryIndex++)
 		{
 			UFlareFactory* Factory = Station->GetFactories()[FactoryIndex];
@@ -840,144 +908,166 @@ void UFlareSimulatedSector::SimulatePriceVariation(FFlareResourceDescription* Re
 				continue;
 			}
 
+			const FFlareProductionData& CycleData = Factory->GetCycleData();
 
-			if (Factory->HasInputResource(Resource))
+			for (const FFlareFactoryResource& FactoryResource : CycleData.InputResources)
 			{
-				float Weight = Factory->GetInputResourceQuantity(Resource);
-				WantedPriceSum += Weight * (1.f - StockRatio);
-				WantedWeightSum += Weight;
+				int32 ResourceIndex = ResourceCatalog->GetResourceIndex(&FactoryResource.Resource->Data);
+				if (ResourceIndex != INDEX_NONE)
+				{
+					float Weight = FactoryResource.Quantity;
+					WantedPriceSums[ResourceIndex] += Weight * GetStockDemand(ResourceIndex);
+					WantedWeightSums[ResourceIndex] += Weight;
+				}
 			}
 
-			if (Factory->HasOutputResource(Resource))
+			for (const FFlareFactoryResource& FactoryResource : CycleData.OutputResources)
 			{
-				float Weight = Factory->GetOutputResourceQuantity(Resource);
-				WantedPriceSum += Weight * (1.f - StockRatio);
-				WantedWeightSum += Weight;
+				int32 ResourceIndex = ResourceCatalog->GetResourceIndex(&FactoryResource.Resource->Data);
+				if (ResourceIndex != INDEX_NONE)
+				{
+					float Weight = FactoryResource.Quantity;
+					WantedPriceSums[ResourceIndex] += Weight * GetStockDemand(ResourceIndex);
+					WantedWeightSums[ResourceIndex] += Weight;
+				}
 			}
 		}
 
-		if(Station->HasCapability(EFlareSpacecraftCapability::Consumer) && Resource->IsConsumerResource)
-		{
-			float Weight = GetPeople()->GetRessourceConsumption(Resource, false);
-			WantedPriceSum += Weight * (1.f - StockRatio);
-			WantedWeightSum += Weight;
-		}
+		// Consumers and maintenance
+		bool IsConsumer = Station->HasCapability(EFlareSpacecraftCapability::Consumer);
+		bool IsMaintenance = Station->HasCapability(EFlareSpacecraftCapability::Maintenance);
 
-		if(Station->HasCapability(EFlareSpacecraftCapability::Maintenance) && Resource->IsMaintenanceResource)
+		if (IsConsumer || IsMaintenance)
 		{
-			WantedPriceSum += 1.f - StockRatio;
-			WantedWeightSum += 1;
+			for (int32 ResourceIndex = 0; ResourceIndex < ResourceCount; ResourceIndex++)
+			{
+				FFlareResourceDescription* Resource = &ResourceCatalog->Resources[ResourceIndex]->Data;
+
+				if (IsConsumer && Resource->IsConsumerResource)
+				{
+					float Weight = ConsumerWeights[ResourceIndex];
+					WantedPriceSums[ResourceIndex] += Weight * GetStockDemand(ResourceIndex);
+					WantedWeightSums[ResourceIndex] += Weight;
+				}
+
+				if (IsMaintenance && Resource->IsMaintenanceResource)
+				{
+					WantedPriceSums[ResourceIndex] += GetStockDemand(ResourceIndex);
+					WantedWeightSums[ResourceIndex] += 1;
+				}
+			}
 		}
 	}
 
-	if(WantedWeightSum > 0)
+	// Update all prices
+	// Resources without local use keep their price
+	const float MaxPriceVariation = 10;
+	const float A = (MaxPriceVariation - 2) * (MaxPriceVariation - 2) / (MaxPriceVariation * (MaxPriceVariation - 1));
+	const float B = (MaxPriceVariation - 2) / (MaxPriceVariation * (MaxPriceVariation - 1));
+	const float C = MaxPriceVariation / (MaxPriceVariation - 2);
+
+	for (int32 ResourceIndex = 0; ResourceIndex < ResourceCount; ResourceIndex++)
 	{
-		float MeanWantedPriceRatio = WantedPriceSum / WantedWeightSum;
-		float OldPriceRatio = (OldPrice - Resource->MinPrice) / (float) (Resource->MaxPrice - Resource->MinPrice);
+		FFlareResourceDescription* Resource = &ResourceCatalog->Resources[ResourceIndex]->Data;
+		float OldPrice = ResourcePrices[ResourceIndex];
 
+		if (WantedWeightSums[ResourceIndex] <= 0)
+		{
+			ResourcePrices[ResourceIndex] = FMath::Clamp(OldPrice, (float) Resource->MinPrice, (float) Resource->MaxPrice);
+			continue;
+		}
 
+		float MeanWantedPriceRatio = WantedPriceSums[ResourceIndex] / WantedWeightSums[ResourceIndex];
+		float OldPriceRatio = (OldPrice - Resource->MinPrice) / (float) (Resource->MaxPrice - Resource->MinPrice);
 		float WantedVariation = MeanWantedPriceRatio - OldPriceRatio;
 
-
-		/*FLOGV(">>> %s price in %s", *Resource->Name.ToString(), *GetSectorName().ToString());
-		FLOGV("   WantedPriceSum %f", WantedPriceSum);
-		FLOGV("   WantedWeightSum %f", WantedWeightSum);
-		FLOGV("   MeanWantedPriceRatio %f", MeanWantedPriceRatio);
-		FLOGV("   OldPrice %f", OldPrice);
-		FLOGV("   OldPriceRatio %f", OldPriceRatio);
-		FLOGV("   WantedVariation %f", WantedVariation);*/
-
-
-
-
 		if(WantedVariation != 0.f)
 		{
-
-
-
-			float MaxPriceVariation = 10;
-			float OldPriceRatioToVariationDirection;
-
-			if(WantedVariation > 0)
-			{
-				OldPriceRatioToVariationDirection = OldPriceRatio;
-			}
-			else
-			{
-				OldPriceRatioToVariationDirection = 1 - OldPriceRatio;
-			}
-
-			float A = (MaxPriceVariation - 2) * (MaxPriceVariation - 2) / (MaxPriceVariation * (MaxPriceVariation - 1));
-			float B = (MaxPriceVariation - 2) / (MaxPriceVariation * (MaxPriceVariation - 1));
-			float C = MaxPriceVariation / (MaxPriceVariation - 2);
-
+			float OldPriceRatioToVariationDirection = (WantedVariation > 0) ? OldPriceRatio : 1 - OldPriceRatio;
 			float VariationScale = (1 / (A*OldPriceRatioToVariationDirection + B)) - C;
-
-
-
 			float Variation = VariationScale * WantedVariation;
+			float NewPrice = FMath::Max(1.f, OldPrice * (1 + Variation / 100.f));
+
+			ResourcePrices[ResourceIndex] = FMath::Clamp(NewPrice, (float) Resource->MinPrice, (float) Resource->MaxPrice);
+		}
+	}
+}
 
+const TArray<UFlareSimulatedSpacecraft*>& UFlareSimulatedSector::GetTradeStationCandidates(FFlareResourceDescription* Resource)
+{
+	if (TradeStationIndexDate != Game->GetGameWorld()->GetDate())
+	{
+		UpdateTradeStationIndex();
+	}
 
-			float NewPrice = FMath::Max(1.f, OldPrice * (1 + Variation / 100.f));
+	int32 ResourceIndex = Game->GetResourceCatalog()->GetResourceIndex(Resource);
+	if (TradeStationIndex.IsValidIndex(ResourceIndex))
+	{
+		return TradeStationIndex[ResourceIndex];
+	}
+	return SectorStations;
+}
 
+void UFlareSimulatedSector::UpdateTradeStationIndex()
+{
+	UFlareResourceCatalog* ResourceCatalog = Game->GetResourceCatalog();
+	TArray<UFlareResourceCatalogEntry*>& Resources = ResourceCatalog->GetResourceList();
 
-			/*FLOGV("   VariationScale %f", VariationScale);
-			FLOGV("   Variation %f", Variation);
-			FLOGV("   NewPrice %f", NewPrice);*/
+	TradeStationIndex.SetNum(Resources.Num());
+	for (TArray<UFlareSimulatedSpacecraft*>& Stations : TradeStationIndex)
+	{
+		Stations.Reset();
+	}
 
-			SetPreciseResourcePrice(Resource, NewPrice);
-			/*if(NewPrice > Resource->MaxPrice)
+	auto AddCandidate = [&](UFlareSimulatedSpacecraft* Station, const FFlareResourceDescription* Resource)
+	{
+		int32 ResourceIndex = ResourceCatalog->GetResourceIndex(Resource);
+		if (ResourceIndex != INDEX_NONE)
+		{
+			TArray<UFlareSimulatedSpacecraft*>& Stations = TradeStationIndex[ResourceIndex];
+			if (Stations.Num() == 0 || Stations.Last() != Station)
 			{
-				FLOGV("%s price at max in %s", *Resource->Name.ToString(), *GetSectorName().ToString());
+				Stations.Add(Station);
 			}
-			else if(NewPrice < Resource->MinPrice)
+		}
+	};
+
+	// Stations are visited in order, so each list keeps the sector station order
+	for (UFlareSimulatedSpacecraft* Station : SectorStations)
+	{
+		// Storage usage depends on cargo locks, keep storages for every resource
+		if (Station->HasCapability(EFlareSpacecraftCapability::Storage))
+		{
+			for (UFlareResourceCatalogEntry* Entry : Resources)
 			{
-				FLOGV("%s price at min in %s", *Resource->Name.ToString(), *GetSectorName().ToString());
+				AddCandidate(Station, &Entry->Data);
 			}
-			else
-			{
-				FLOGV("%s price in %s change from %f to %f (%f)", *Resource->Name.ToString(), *GetSectorName().ToString(), OldPrice / 100.f, NewPrice / 100.f, Variation);
-			}*/
+			continue;
 		}
-	}
-	else
-	{
-
-		// Find nearest sectors
-
-		int64 MinTravelDuration = -1;
-		int32 NumSector = 0;
-		float PriceSum = 0;
 
-		for (int SectorIndex = 0; SectorIndex < GetGame()->GetGameWorld()->GetSectors().Num(); SectorIndex++)
+		for (UFlareFactory* Factory : Station->GetFactories())
 		{
-			UFlareSimulatedSector* SectorCandidate = GetGame()->GetGameWorld()->GetSectors()[SectorIndex];
-
-			if(SectorCandidate == this)
+			for (const FFlareFactoryResource& FactoryResource : Factory->GetCycleData().InputResources)
 			{
-				continue;
+				AddCandidate(Station, &FactoryResource.Resource->Data);
 			}
-
-			int64 TravelDuration = UFlareTravel::ComputeTravelDuration(GetGame()->GetGameWorld(), this, SectorCandidate, NULL);
-
-
-			if (MinTravelDuration == -1 || MinTravelDuration > TravelDuration)
+			for (const FFlareFactoryResource& FactoryResource : Factory->GetCycleData().OutputResources)
 			{
-				MinTravelDuration = TravelDuration;
-				NumSector = 0;
-				PriceSum = 0;
+				AddCandidate(Station, &FactoryResource.Resource->Data);
 			}
+		}
 
-			if (MinTravelDuration == TravelDuration)
+		for (UFlareResourceCatalogEntry* Entry : Resources)
+		{
+			if ((Station->HasCapability(EFlareSpacecraftCapability::Consumer) && Entry->Data.IsConsumerResource)
+			 || (Station->HasCapability(EFlareSpacecraftCapability::Maintenance) && Entry->Data.IsMaintenanceResource))
 			{
-				PriceSum += GetPreciseResourcePrice(Resource);
-				NumSector++;
+				AddCandidate(Station, &Entry->Data);
 			}
 		}
-
-		float MeanNearPrice = PriceSum / NumSector;
-		SetPreciseResourcePrice(Resource, MeanNearPrice);
 	}
+
+	TradeStationIndexDate = Game->GetGameWorld()->GetDate();
 }
 
 bool UFlareSimulatedSector::WantSell(FFlareResourceDescription* Resource, UFlareCompany* Client)
@@ -1114,17 +1204,39 @@ uint32 UFlareSimulatedSector::GetResourceCount(UFlareCompany* Company, FFlareRes
 
 void UFlareSimulatedSector::LoadResourcePrices()
 {
-	ResourcePrices.Empty();
-	LastResourcePrices.Empty();
+	UFlareResourceCatalog* ResourceCatalog = Game->GetResourceCatalog();
+	const int32 ResourceCount = ResourceCatalog->Resources.Num();
+
+	ResourcePrices.SetNumUninitialized(ResourceCount);
+	PriceHistory.SetNumZeroed(ResourceCount * PRICE_HISTORY_SIZE);
+	PriceHistoryCounts.SetNumZeroed(ResourceCount);
+	PriceHistoryWriteIndex = 0;
+
+	for (int32 ResourceIndex = 0; ResourceIndex < ResourceCount; ResourceIndex++)
+	{
+		ResourcePrices[ResourceIndex] = GetDefaultResourcePrice(&ResourceCatalog->Resources[ResourceIndex]->Data);
+	}
+
 	for (int PriceIndex = 0; PriceIndex < SectorData.ResourcePrices.Num(); PriceIndex++)
 	{
 		FFFlareResourcePrice* ResourcePrice = &SectorData.ResourcePrices[PriceIndex];
-		FFlareResourceDescription* Resource = Game->GetResourceCatalog()->Get(ResourcePrice->ResourceIdentifier);
-		float Price = ResourcePrice->Price;
-		ResourcePrices.Add(Resource, Price);
+		int32 ResourceIndex = ResourceCatalog->GetResourceIndex(ResourceCatalog->Get(ResourcePrice->ResourceIdentifier));
+		if (ResourceIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		ResourcePrices[ResourceIndex] = ResourcePrice->Price;
+
+		// Copy the history, the most recent value ending before the write index
 		FFlareFloatBuffer* Prices = &ResourcePrice->Prices;
-		Prices->Resize(50);
-		LastResourcePrices.Add(Resource, *Prices);
+		int32 HistoryCount = FMath::Min(Prices->Values.Num(), PRICE_HISTORY_SIZE);
+		for (int32 Age = 0; Age < HistoryCount; Age++)
+		{
+			int32 Row = PRICE_HISTORY_SIZE - 1 - Age;
+			PriceHistory[Row * ResourceCount + ResourceIndex] = Prices->GetValue(Age);
+		}
+		PriceHistoryCounts[ResourceIndex] = HistoryCount;
 	}
 }
 
@@ -1132,23 +1244,41 @@ void UFlareSimulatedSector::SaveResourcePrices()
 {
 	SectorData.ResourcePrices.Empty();
 
-	for(int32 ResourceIndex = 0; ResourceIndex < Game->GetResourceCatalog()->Resources.Num(); ResourceIndex++)
+	for(int32 ResourceIndex = 0; ResourceIndex < ResourcePrices.Num(); ResourceIndex++)
 	{
-		FFlareResourceDescription* Resource = &Game->GetResourceCatalog()->Resources[ResourceIndex]->Data;
-		if (ResourcePrices.Contains(Resource))
+		FFFlareResourcePrice Price;
+		Price.ResourceIdentifier = Game->GetResourceCatalog()->Resources[ResourceIndex]->Data.Identifier;
+		Price.Price = ResourcePrices[ResourceIndex];
+
+		Price.Prices.Init(PRICE_HISTORY_SIZE);
+		for (int32 Age = PriceHistoryCounts[ResourceIndex] - 1; Age >= 0; Age--)
 		{
-			FFFlareResourcePrice Price;
-			Price.ResourceIdentifier = Resource->Identifier;
-			Price.Price = ResourcePrices[Resource];
-			if (LastResourcePrices.Contains(Resource))
-			{
-				Price.Prices = LastResourcePrices[Resource];
-				SectorData.ResourcePrices.Add(Price);
-			}
+			Price.Prices.Append(GetHistoryPrice(ResourceIndex, Age));
 		}
+
+		SectorData.ResourcePrices.Add(Price);
 	}
 }
 
+float UFlareSimulatedSector::GetHistoryPrice(int32 ResourceIndex, int32 Age) const
+{
+	int32 HistoryCount = PriceHistoryCounts[ResourceIndex];
+	if (HistoryCount == 0)
+	{
+		return 0.f;
+	}
+
+	Age = FMath::Min(Age, HistoryCount - 1);
+
+	int32 Row = PriceHistoryWriteIndex - 1 - Age;
+	if (Row < 0)
+	{
+		Row += PRICE_HISTORY_SIZE;
+	}
+
+	return PriceHistory[Row * ResourcePrices.Num() + ResourceIndex];
+}
+
 FText UFlareSimulatedSector::GetSectorName()
 {
 	if (SectorData.GivenName.ToString().Len())
@@ -1510,51 +1640,52 @@ FLinearColor UFlareSimulatedSector::GetSectorFriendlynessColor(UFlareCompany* Co
 
 float UFlareSimulatedSector::GetPreciseResourcePrice(FFlareResourceDescription* Resource, int32 Age)
 {
-	if(Age == 0)
+	int32 ResourceIndex = Game->GetResourceCatalog()->GetResourceIndex(Resource);
+	if (!ResourcePrices.IsValidIndex(ResourceIndex))
 	{
+		return Resource ? GetDefaultResourcePrice(Resource) : 0.f;
+	}
 
-		if (!ResourcePrices.Contains(Resource))
-		{
-			ResourcePrices.Add(Resource, GetDefaultResourcePrice(Resource));
-		}
-
-		return ResourcePrices[Resource];
+	if(Age == 0)
+	{
+		return ResourcePrices[ResourceIndex];
 	}
 	else
 	{
-		if (!LastResourcePrices.Contains(Resource))
+		if (PriceHistoryCounts[ResourceIndex] == 0)
 		{
-			FFlareFloatBuffer Prices;
-			Prices.Init(50);
-			Prices.Append(GetPreciseResourcePrice(Resource, 0));
-			LastResourcePrices.Add(Resource, Prices);
+			// No history yet, use the current price as the last known value
+			int32 Row = (PriceHistoryWriteIndex + PRICE_HISTORY_SIZE - 1) % PRICE_HISTORY_SIZE;
+			PriceHistory[Row * ResourcePrices.Num() + ResourceIndex] = ResourcePrices[ResourceIndex];
+			PriceHistoryCounts[ResourceIndex] = 1;
 		}
 
-		return LastResourcePrices[Resource].GetValue(Age);
+		return GetHistoryPrice(ResourceIndex, Age);
 	}
 
 }
 
 void UFlareSimulatedSector::SwapPrices()
 {
-	for(int32 ResourceIndex = 0; ResourceIndex < Game->GetResourceCatalog()->Resources.Num(); ResourceIndex++)
-	{
-		FFlareResourceDescription* Resource = &Game->GetResourceCatalog()->Resources[ResourceIndex]->Data;
+	const int32 ResourceCount = ResourcePrices.Num();
 
-		if (!LastResourcePrices.Contains(Resource))
-		{
-			FFlareFloatBuffer Prices;
-			Prices.Init(50);
-			LastResourcePrices.Add(Resource, Prices);
-		}
-
-		LastResourcePrices[Resource].Append(GetPreciseResourcePrice(Resource, 0));
+	// Write today's row
+	FMemory::Memcpy(&PriceHistory[PriceHistoryWriteIndex * ResourceCount], ResourcePrices.GetData(), ResourceCount * sizeof(float));
+	for (int32 ResourceIndex = 0; ResourceIndex < ResourceCount; ResourceIndex++)
+	{
+		PriceHistoryCounts[ResourceIndex] = FMath::Min(PriceHistoryCounts[ResourceIndex] + 1, PRICE_HISTORY_SIZE);
 	}
+
+	PriceHistoryWriteIndex = (PriceHistoryWriteIndex + 1) % PRICE_HISTORY_SIZE;
 }
 
 void UFlareSimulatedSector::SetPreciseResourcePrice(FFlareResourceDescription* Resource, float NewPrice)
 {
-	ResourcePrices[Resource] = FMath::Clamp(NewPrice, (float) Resource->MinPrice, (float) Resource->MaxPrice);
+	int32 ResourceIndex = Game->GetResourceCatalog()->GetResourceIndex(Resource);
+	if (ResourcePrices.IsValidIndex(ResourceIndex))
+	{
+		ResourcePrices[ResourceIndex] = FMath::Clamp(NewPrice, (float) Resource->MinPrice, (float) Resource->MaxPrice);
+	}
 }
 
 
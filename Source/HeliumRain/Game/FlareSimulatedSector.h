@@ -385,6 +385,10 @@ public:
 	UFlareSimulatedSpacecraft* CreateStation(FName StationClass, UFlareCompany* Company, bool UnderConstruction,
 		FFlareStationSpawnParameters SpawnParameters = FFlareStationSpawnParameters());
 
+	/** Create a station from an already resolved description. No null description accepted */
+	UFlareSimulatedSpacecraft* CreateStation(FFlareSpacecraftDescription* StationDescription, UFlareCompany* Company, bool UnderConstruction,
+		FFlareStationSpawnParameters SpawnParameters = FFlareStationSpawnParameters());
+
     /** Create a ship in the level  for a specific company */
 	UFlareSimulatedSpacecraft* CreateSpacecraft(FName ShipClass, UFlareCompany* Company, FVector TargetPosition);
 
@@ -412,6 +416,13 @@ public:
 	bool CanBuildStation(FFlareSpacecraftDescription* StationDescription, UFlareCompany* Company, TArray<FText>& OutReason,
 		bool IgnoreCost = false, bool InComplex = false, bool InComplexSpecial = false);
 
+	/** Check the sector-wide part of CanBuildStation, common to all station types */
+	bool CanBuildStationInSector(UFlareCompany* Company, TArray<FText>& OutReason, bool InComplex = false);
+
+	/** Check the station-specific part of CanBuildStation */
+	bool CanBuildStationDescription(FFlareSpacecraftDescription* StationDescription, UFlareCompany* Company, TArray<FText>& OutReason,
+		bool IgnoreCost = false, bool InComplex = false, bool InComplexSpecial = false);
+
 	/** Build a station on this sector */
 	UFlareSimulatedSpacecraft* BuildStation(FFlareSpacecraftDescription* StationDescription, UFlareCompany* Company,
 		FFlareStationSpawnParameters SpawnParameters = FFlareStationSpawnParameters());
@@ -427,9 +438,29 @@ public:
 	void AttachStationToActor(UFlareSimulatedSpacecraft* Spacecraft, FName AttachActorName);
 	void AttachStationToComplexStation(UFlareSimulatedSpacecraft* Spacecraft, FName AttachStationName, FName AttachConnectorName);
 
+	/** Update all resource prices from the sector supply and demand */
 	void SimulatePriceVariation();
 
-	void SimulatePriceVariation(FFlareResourceDescription* Resource);
+	/** Get the stations that may trade this resource, in sector station order. Stock and relations still need checking */
+	const TArray<UFlareSimulatedSpacecraft*>& GetTradeStationCandidates(FFlareResourceDescription* Resource);
+
+	/** Invalidate the trade station index after a change in station set or factories */
+	void InvalidateTradeStationIndex()
+	{
+		TradeStationIndexDate = -1;
+	}
+
+	/** Notify that the battle state of this sector may have changed */
+	void InvalidateBattleState()
+	{
+		BattleStateVersion++;
+	}
+
+	/** Get a counter that changes each time the battle state may have changed */
+	int32 GetBattleStateVersion() const
+	{
+		return BattleStateVersion;
+	}
 
 	/** Can we load or buy this resource in this sector ? */
 	bool WantSell(FFlareResourceDescription* Resource, UFlareCompany* Client);
@@ -477,8 +508,27 @@ protected:
 	UPROPERTY()
 	FFlareSectorOrbitParameters             SectorOrbitParameters;
 	const FFlareSectorDescription*          SectorDescription;
-	TMap<FFlareResourceDescription*, float> ResourcePrices;
-	TMap<FFlareResourceDescription*, FFlareFloatBuffer> LastResourcePrices;
+
+	// Prices, indexed like the resource catalog
+	TArray<float>                           ResourcePrices;
+
+	// Price history ring buffer : one row of resource prices per day
+	TArray<float>                           PriceHistory;
+	TArray<int32>                           PriceHistoryCounts;
+	int32                                   PriceHistoryWriteIndex;
+
+	/** Get a price from the history ring buffer */
+	float GetHistoryPrice(int32 ResourceIndex, int32 Age) const;
+
+	// Stations by traded resource, indexed like the resource catalog, rebuilt daily or on invalidation
+	TArray<TArray<UFlareSimulatedSpacecraft*>> TradeStationIndex;
+	int64                                   TradeStationIndexDate;
+
+	// Bumped by arrivals, departures, damage, capture and diplomacy changes
+	int32                                   BattleStateVersion;
+
+	/** Rebuild the trade station index */
+	void UpdateTradeStationIndex();
 
 public:
 
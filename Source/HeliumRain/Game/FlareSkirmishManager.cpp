@@ -7,7 +7,9 @@
 #include "FlareGame.h"
 #include "FlareGameTools.h"
 
+#include "../Data/FlareCompanyCatalog.h"
 #include "../Data/FlareCustomizationCatalog.h"
+#include "../Data/FlareSpacecraftCatalog.h"
 
 #include "../Player/FlareMenuManager.h"
 #include "../Player/FlarePlayerController.h"
@@ -19,6 +21,22 @@
 
 #define LOCTEXT_NAMESPACE "FlareSkirmishManager"
 
+// Default simulation rate of batch skirmishes
+#define SKIRMISH_BATCH_DEFAULT_FPS 30
+
+
+// CSV column of each EFlareSkirmishBatchSection
+static const TCHAR* SkirmishBatchStatColumns[] =
+{
+	TEXT("Pilots"),
+	TEXT("Turrets"),
+	TEXT("Shells"),
+	TEXT("Navigation")
+};
+
+double FFlareSkirmishBatchScope::SectionTime[EFlareSkirmishBatchSection::Count];
+bool FFlareSkirmishBatchScope::Enabled = false;
+
 
 /*----------------------------------------------------
 	Gameplay phases
@@ -44,6 +62,14 @@ UFlareSkirmishManager::UFlareSkirmishManager(const FObjectInitializer& ObjectIni
 	DebrisCatalog = ConstructorStatics.DebrisCatalog.Object;
 
 	CurrentPhase = EFlareSkirmishPhase::Idle;
+
+	BatchChecked = false;
+	BatchPending = false;
+	BatchActive = false;
+	BatchRunCount = 1;
+	BatchSeed = 0;
+	BatchRunIndex = 0;
+	BatchRunStarted = false;
 }
 
 void UFlareSkirmishManager::Update(float DeltaSeconds)
@@ -52,6 +78,8 @@ void UFlareSkirmishManager::Update(float DeltaSeconds)
 	{
 		Result.GameTime += DeltaSeconds;
 	}
+
+	UpdateBatch(DeltaSeconds);
 }
 
 void UFlareSkirmishManager::StartSetup()
@@ -139,21 +167,18 @@ void UFlareSkirmishManager::RestartPlay()
 void UFlareSkirmishManager::EndPlay()
 {
 	// Start skirmish countdown
-	if (CurrentPhase == EFlareSkirmishPhase::Play)
+	if (CurrentPhase == EFlareSkirmishPhase::Play && !BatchActive)
 	{
 		AFlareMenuManager::GetSingleton()->PrepareSkirmishEnd();
 	}
 
-	// Detect victory
-	AFlarePlayerController* PC = GetGame()->GetPC();
-	FFlareSectorBattleState BattleState = GetGame()->GetActiveSector()->GetSimulatedSector()->GetSectorBattleState(PC->GetCompany());
-	if (BattleState.FriendlyControllableShipCount > 0 && !BattleState.HasDanger)
-	{
-		Result.PlayerVictory = true;
-	}
-	else
+	// Detect victory, a timeout is a draw
+	Result.PlayerVictory = false;
+	if (!Result.TimedOut)
 	{
-		Result.PlayerVictory = false;
+		AFlarePlayerController* PC = GetGame()->GetPC();
+		FFlareSectorBattleState BattleState = GetGame()->GetActiveSector()->GetSimulatedSector()->GetSectorBattleState(PC->GetCompany());
+		Result.PlayerVictory = (BattleState.FriendlyControllableShipCount > 0 && !BattleState.HasDanger);
 	}
 
 	// Reset phase
@@ -232,6 +257,388 @@ void UFlareSkirmishManager::AmmoHit(bool ForPlayer)
 }
 
 
+/*----------------------------------------------------
+	Batch
+----------------------------------------------------*/
+
+void UFlareSkirmishManager::SetOrderDefaults(FFlareSkirmishSpacecraftOrder& Order)
+{
+	if (Order.Description->Size == EFlarePartSize::S)
+	{
+		Order.EngineType = FName("engine-thresher");
+		Order.RCSType = FName("rcs-coral");
+
+		for (auto& Slot : Order.Description->WeaponGroups)
+		{
+			Order.WeaponTypes.Add(FName("weapon-eradicator"));
+		}
+	}
+	else
+	{
+		Order.EngineType = FName("pod-thera");
+		Order.RCSType = FName("rcs-rift");
+
+		for (auto& Slot : Order.Description->WeaponGroups)
+		{
+			Order.WeaponTypes.Add(FName("weapon-artemis"));
+		}
+	}
+}
+
+bool UFlareSkirmishManager::LoadBatch(FString Path)
+{
+	FString BatchString;
+	if (!FFileHelper::LoadFileToString(BatchString, *Path))
+	{
+		FLOGV("UFlareSkirmishManager::LoadBatch : fail to read '%s'", *Path);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Object;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BatchString);
+	const TArray<TSharedPtr<FJsonValue>>* Skirmishes;
+	if (!FJsonSerializer::Deserialize(Reader, Object) || !Object.IsValid() || !Object->TryGetArrayField("Skirmishes", Skirmishes))
+	{
+		FLOGV("UFlareSkirmishManager::LoadBatch : fail to deserialize '%s'", *Path);
+		return false;
+	}
+
+	BatchEntries.Empty();
+	for (const TSharedPtr<FJsonValue>& Item : *Skirmishes)
+	{
+		TSharedPtr<FJsonObject> SkirmishObject = Item->AsObject();
+		if (!SkirmishObject.IsValid())
+		{
+			continue;
+		}
+
+		FFlareSkirmishBatchEntry Entry;
+		Entry.Name = FString::Printf(TEXT("Skirmish%d"), BatchEntries.Num());
+		Entry.EnemyCompanyName = GetGame()->GetCompanyCatalog()->Companies[0].ShortName;
+
+		FString StringValue;
+		double NumberValue;
+		bool BoolValue;
+
+		if (SkirmishObject->TryGetStringField("Name", StringValue))
+		{
+			Entry.Name = StringValue;
+		}
+		if (SkirmishObject->TryGetStringField("CelestialBody", StringValue))
+		{
+			Entry.CelestialBodyIdentifier = FName(*StringValue);
+		}
+		if (SkirmishObject->TryGetStringField("EnemyCompany", StringValue))
+		{
+			Entry.EnemyCompanyName = FName(*StringValue);
+		}
+		if (SkirmishObject->TryGetNumberField("MaxTime", NumberValue))
+		{
+			Entry.MaxTime = NumberValue;
+		}
+		if (SkirmishObject->TryGetNumberField("Altitude", NumberValue))
+		{
+			Entry.SectorAltitude = FMath::Clamp((float)NumberValue, 0.0f, 1.0f);
+		}
+		if (SkirmishObject->TryGetNumberField("AsteroidCount", NumberValue))
+		{
+			Entry.AsteroidCount = NumberValue;
+		}
+		if (SkirmishObject->TryGetNumberField("DebrisDensity", NumberValue))
+		{
+			Entry.DebrisFieldDensity = NumberValue;
+		}
+		if (SkirmishObject->TryGetBoolField("Icy", BoolValue))
+		{
+			Entry.IsIcy = BoolValue;
+		}
+		if (SkirmishObject->TryGetBoolField("MetallicDebris", BoolValue))
+		{
+			Entry.MetallicDebris = BoolValue;
+		}
+
+		// Fleets
+		const TArray<TSharedPtr<FJsonValue>>* Fleet;
+		if (!SkirmishObject->TryGetArrayField("Player", Fleet) || !LoadBatchFleet(*Fleet, Entry.Player)
+		 || !SkirmishObject->TryGetArrayField("Enemy", Fleet) || !LoadBatchFleet(*Fleet, Entry.Enemy)
+		 || Entry.Player.OrderedSpacecrafts.Num() == 0 || Entry.Enemy.OrderedSpacecrafts.Num() == 0)
+		{
+			FLOGV("UFlareSkirmishManager::LoadBatch : invalid fleets for '%s'", *Entry.Name);
+			return false;
+		}
+
+		BatchEntries.Add(Entry);
+	}
+
+	FLOGV("UFlareSkirmishManager::LoadBatch : loaded %d skirmishes from '%s'", BatchEntries.Num(), *Path);
+	return (BatchEntries.Num() > 0);
+}
+
+bool UFlareSkirmishManager::LoadBatchFleet(const TArray<TSharedPtr<FJsonValue>>& Fleet, FFlareSkirmishPlayerData& Belligerent)
+{
+	for (const TSharedPtr<FJsonValue>& Item : Fleet)
+	{
+		TSharedPtr<FJsonObject> ShipObject = Item->AsObject();
+		FString StringValue;
+		if (!ShipObject.IsValid() || !ShipObject->TryGetStringField("Ship", StringValue))
+		{
+			return false;
+		}
+
+		FFlareSpacecraftDescription* Desc = GetGame()->GetSpacecraftCatalog()->Get(FName(*StringValue));
+		if (!Desc)
+		{
+			FLOGV("UFlareSkirmishManager::LoadBatchFleet : unknown ship '%s'", *StringValue);
+			return false;
+		}
+
+		// Upgrades
+		FFlareSkirmishSpacecraftOrder Order(Desc);
+		Order.ForPlayer = false;
+		SetOrderDefaults(Order);
+		if (ShipObject->TryGetStringField("Engine", StringValue))
+		{
+			Order.EngineType = FName(*StringValue);
+		}
+		if (ShipObject->TryGetStringField("RCS", StringValue))
+		{
+			Order.RCSType = FName(*StringValue);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Weapons;
+		if (ShipObject->TryGetArrayField("Weapons", Weapons))
+		{
+			for (int32 WeaponIndex = 0; WeaponIndex < Weapons->Num() && WeaponIndex < Order.WeaponTypes.Num(); WeaponIndex++)
+			{
+				Order.WeaponTypes[WeaponIndex] = FName(*(*Weapons)[WeaponIndex]->AsString());
+			}
+		}
+
+		// Copies
+		int32 Count = 1;
+		ShipObject->TryGetNumberField("Count", Count);
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			Belligerent.OrderedSpacecrafts.Add(Order);
+		}
+	}
+
+	return true;
+}
+
+void UFlareSkirmishManager::UpdateBatch(float DeltaSeconds)
+{
+	// Look for a batch on the command line
+	if (!BatchChecked)
+	{
+		BatchChecked = true;
+
+		FString BatchPath;
+		if (FParse::Value(FCommandLine::Get(), TEXT("SkirmishBatch="), BatchPath))
+		{
+			int32 FPS = SKIRMISH_BATCH_DEFAULT_FPS;
+			FParse::Value(FCommandLine::Get(), TEXT("SkirmishRuns="), BatchRunCount);
+			FParse::Value(FCommandLine::Get(), TEXT("SkirmishSeed="), BatchSeed);
+			FParse::Value(FCommandLine::Get(), TEXT("SkirmishFPS="), FPS);
+			BatchRunCount = FMath::Max(BatchRunCount, 1);
+
+			BatchOutputPath = FPaths::ProjectSavedDir() / TEXT("Skirmish.csv");
+			FParse::Value(FCommandLine::Get(), TEXT("SkirmishOutput="), BatchOutputPath);
+
+			if (LoadBatch(BatchPath))
+			{
+				// Simulate at a fixed rate, as fast as possible
+				FApp::SetBenchmarking(true);
+				FApp::SetUseFixedTimeStep(true);
+				FApp::SetFixedDeltaTime(1.0 / FMath::Max(FPS, 1));
+
+				BatchPending = true;
+			}
+			else
+			{
+				FPlatformMisc::RequestExit(false);
+			}
+		}
+	}
+
+	// Wait for the main menu
+	if (BatchPending)
+	{
+		AFlareMenuManager* MenuManager = AFlareMenuManager::GetSingleton();
+		if (MenuManager && GetGame()->GetPC() && MenuManager->GetCurrentMenu() == EFlareMenu::MENU_Main && !MenuManager->IsSwitchingMenu())
+		{
+			FLOGV("UFlareSkirmishManager::UpdateBatch : starting %d runs", BatchEntries.Num() * BatchRunCount);
+
+			BatchOutput = TEXT("Skirmish,Run,Seed,PlayerVictory,TimedOut,GameTime");
+			for (FString Side : { TEXT("Player"), TEXT("Enemy") })
+			{
+				BatchOutput += FString::Printf(TEXT(",%sShipsDisabled,%sShipsDestroyed,%sAmmoFired,%sAmmoHit"), *Side, *Side, *Side, *Side);
+			}
+			BatchOutput += TEXT(",Frames,AvgFrameMs,MaxFrameMs");
+			for (const TCHAR* Column : SkirmishBatchStatColumns)
+			{
+				BatchOutput += FString::Printf(TEXT(",Avg%sMs,Max%sMs"), Column, Column);
+			}
+			BatchOutput += TEXT("\n");
+
+			BatchPending = false;
+			BatchActive = true;
+			BatchRunIndex = 0;
+			StartBatchRun();
+		}
+		return;
+	}
+
+	if (!BatchActive)
+	{
+		return;
+	}
+
+	if (CurrentPhase == EFlareSkirmishPhase::Play)
+	{
+		AFlareMenuManager* MenuManager = AFlareMenuManager::GetSingleton();
+		AFlareSpacecraft* ShipPawn = GetGame()->GetPC()->GetShipPawn();
+
+		// Wait for the sector to be loaded
+		if (!BatchRunStarted)
+		{
+			if (ShipPawn && !MenuManager->IsSwitchingMenu())
+			{
+				Result = FFlareSkirmishResultData();
+				BatchRunStarted = true;
+				BatchLastFrameTime = FPlatformTime::Seconds();
+
+				// Start timing sections with the first simulated frame
+				FMemory::Memzero(FFlareSkirmishBatchScope::SectionTime);
+				FFlareSkirmishBatchScope::Enabled = true;
+			}
+			return;
+		}
+
+		SampleBatchFrame();
+
+		// Nobody is flying, let the AI take the player ship
+		if (ShipPawn && !ShipPawn->GetStateManager()->IsPilotMode())
+		{
+			ShipPawn->GetStateManager()->EnablePilot(true);
+		}
+
+		// Draw
+		if (Result.GameTime > BatchEntries[BatchRunIndex / BatchRunCount].MaxTime)
+		{
+			Result.TimedOut = true;
+			EndPlay();
+		}
+	}
+	else if (CurrentPhase == EFlareSkirmishPhase::End)
+	{
+		EndBatchRun();
+	}
+}
+
+void UFlareSkirmishManager::StartBatchRun()
+{
+	const FFlareSkirmishBatchEntry& Entry = BatchEntries[BatchRunIndex / BatchRunCount];
+	int32 Seed = BatchSeed + BatchRunIndex;
+	FLOGV("UFlareSkirmishManager::StartBatchRun : '%s' run %d seed %d", *Entry.Name, BatchRunIndex % BatchRunCount, Seed);
+
+	FMath::RandInit(Seed);
+	FMath::SRandInit(Seed);
+
+	StartSetup();
+
+	// Fleets
+	Data.Player = Entry.Player;
+	Data.Enemy = Entry.Enemy;
+	Data.EnemyCompanyName = Entry.EnemyCompanyName;
+	Data.PlayerCompanyData = *GetGame()->GetPC()->GetCompanyDescription();
+
+	// Sector
+	Data.SectorAltitude = Entry.SectorAltitude;
+	Data.AsteroidCount = Entry.AsteroidCount;
+	Data.MetallicDebris = Entry.MetallicDebris;
+	Data.SectorDescription.CelestialBodyIdentifier = Entry.CelestialBodyIdentifier;
+	Data.SectorDescription.IsIcy = Entry.IsIcy;
+	Data.SectorDescription.DebrisFieldInfo.DebrisFieldDensity = Entry.DebrisFieldDensity;
+
+	// Reset stats
+	BatchRunStarted = false;
+	BatchFrames = 0;
+	BatchTotalFrameTime = 0;
+	BatchMaxFrameTime = 0;
+	BatchTotalStatTime.Init(0, EFlareSkirmishBatchSection::Count);
+	BatchMaxStatTime.Init(0, EFlareSkirmishBatchSection::Count);
+	FFlareSkirmishBatchScope::Enabled = false;
+
+	StartPlay();
+}
+
+void UFlareSkirmishManager::EndBatchRun()
+{
+	const FFlareSkirmishBatchEntry& Entry = BatchEntries[BatchRunIndex / BatchRunCount];
+	int32 Frames = FMath::Max(BatchFrames, 1);
+	FFlareSkirmishBatchScope::Enabled = false;
+	FLOGV("UFlareSkirmishManager::EndBatchRun : '%s' run %d victory %d timeout %d in %fs",
+		*Entry.Name, BatchRunIndex % BatchRunCount, Result.PlayerVictory, Result.TimedOut, Result.GameTime);
+
+	// Scores
+	BatchOutput += FString::Printf(TEXT("%s,%d,%d,%d,%d,%f"),
+		*Entry.Name, BatchRunIndex % BatchRunCount, BatchSeed + BatchRunIndex, Result.PlayerVictory ? 1 : 0, Result.TimedOut ? 1 : 0, Result.GameTime);
+	for (const FFlareSkirmishPlayerResult* Belligerent : { &Result.Player, &Result.Enemy })
+	{
+		BatchOutput += FString::Printf(TEXT(",%d,%d,%d,%d"),
+			Belligerent->ShipsDisabled, Belligerent->ShipsDestroyed, Belligerent->AmmoFired, Belligerent->AmmoHit);
+	}
+
+	// Performance
+	BatchOutput += FString::Printf(TEXT(",%d,%f,%f"), BatchFrames, BatchTotalFrameTime / Frames, BatchMaxFrameTime);
+	for (int32 StatIndex = 0; StatIndex < BatchTotalStatTime.Num(); StatIndex++)
+	{
+		BatchOutput += FString::Printf(TEXT(",%f,%f"), BatchTotalStatTime[StatIndex] / Frames, BatchMaxStatTime[StatIndex]);
+	}
+	BatchOutput += TEXT("\n");
+
+	// Save after every run so that a crash keeps previous results
+	if (!FFileHelper::SaveStringToFile(BatchOutput, *BatchOutputPath))
+	{
+		FLOGV("UFlareSkirmishManager::EndBatchRun : fail to write '%s'", *BatchOutputPath);
+	}
+
+	// Next run
+	BatchRunIndex++;
+	if (BatchRunIndex < BatchEntries.Num() * BatchRunCount)
+	{
+		StartBatchRun();
+	}
+	else
+	{
+		FLOGV("UFlareSkirmishManager::EndBatchRun : batch done, results in '%s'", *BatchOutputPath);
+		BatchActive = false;
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+void UFlareSkirmishManager::SampleBatchFrame()
+{
+	double Time = FPlatformTime::Seconds();
+	double FrameTime = 1000 * (Time - BatchLastFrameTime);
+	BatchLastFrameTime = Time;
+
+	BatchFrames++;
+	BatchTotalFrameTime += FrameTime;
+	BatchMaxFrameTime = FMath::Max(BatchMaxFrameTime, FrameTime);
+
+	// Section times of the last frame
+	for (int32 Section = 0; Section < EFlareSkirmishBatchSection::Count; Section++)
+	{
+		double SectionTime = 1000 * FFlareSkirmishBatchScope::SectionTime[Section];
+		BatchTotalStatTime[Section] += SectionTime;
+		BatchMaxStatTime[Section] = FMath::Max(BatchMaxStatTime[Section], SectionTime);
+		FFlareSkirmishBatchScope::SectionTime[Section] = 0;
+	}
+}
+
+
 /*----------------------------------------------------
 	Getters
 ----------------------------------------------------*/
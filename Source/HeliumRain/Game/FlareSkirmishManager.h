@@ -8,6 +8,7 @@
 
 class AFlareGame;
 struct FFlareSpacecraftDescription;
+class FJsonValue;
 
 
 /** Skirmish phase state */
@@ -23,6 +24,50 @@ namespace EFlareSkirmishPhase
 	};
 }
 
+/** Sections timed by batch skirmishes */
+namespace EFlareSkirmishBatchSection
+{
+	enum Type
+	{
+		Pilots,
+		Turrets,
+		Shells,
+		Navigation,
+		Count
+	};
+}
+
+/** Add the time spent in a scope to a batch section, while a batch skirmish runs */
+struct HELIUMRAIN_API FFlareSkirmishBatchScope
+{
+	FFlareSkirmishBatchScope(EFlareSkirmishBatchSection::Type ScopeSection)
+		: Section(ScopeSection)
+		, Active(Enabled)
+		, StartTime(Active ? FPlatformTime::Seconds() : 0)
+	{
+	}
+
+	~FFlareSkirmishBatchScope()
+	{
+		if (Active)
+		{
+			SectionTime[Section] += FPlatformTime::Seconds() - StartTime;
+		}
+	}
+
+	/** Time spent in each section since the last batch sample, in seconds */
+	static double SectionTime[EFlareSkirmishBatchSection::Count];
+
+	/** Set while a batch skirmish run is being measured */
+	static bool Enabled;
+
+protected:
+
+	EFlareSkirmishBatchSection::Type Section;
+	bool                             Active;
+	double                           StartTime;
+};
+
 /** Skirmish belligerent */
 USTRUCT()
 struct FFlareSkirmishPlayerData
@@ -101,6 +146,7 @@ struct FFlareSkirmishResultData
 
 	// General data
 	bool                                             PlayerVictory;
+	bool                                             TimedOut;
 	float                                            GameTime;
 
 	// Player data
@@ -110,6 +156,7 @@ struct FFlareSkirmishResultData
 	// Defaults
 	FFlareSkirmishResultData()
 		: PlayerVictory(false)
+		, TimedOut(false)
 		, GameTime(0)
 		, Player()
 		, Enemy()
@@ -117,6 +164,43 @@ struct FFlareSkirmishResultData
 	}
 };
 
+/** Skirmish batch entry, loaded from a definition file */
+USTRUCT()
+struct FFlareSkirmishBatchEntry
+{
+	GENERATED_USTRUCT_BODY()
+
+	// General data
+	FString                                          Name;
+	float                                            MaxTime;
+
+	// World setup
+	FName                                            CelestialBodyIdentifier;
+	float                                            SectorAltitude;
+	int32                                            AsteroidCount;
+	int32                                            DebrisFieldDensity;
+	bool                                             IsIcy;
+	bool                                             MetallicDebris;
+
+	// Belligerents
+	FFlareSkirmishPlayerData                         Player;
+	FFlareSkirmishPlayerData                         Enemy;
+	FName                                            EnemyCompanyName;
+
+	// Defaults
+	FFlareSkirmishBatchEntry()
+		: MaxTime(600)
+		, CelestialBodyIdentifier("nema")
+		, SectorAltitude(0.5)
+		, AsteroidCount(20)
+		, DebrisFieldDensity(10)
+		, IsIcy(true)
+		, MetallicDebris(false)
+		, EnemyCompanyName(NAME_None)
+	{
+	}
+};
+
 /** Skirmish managing class */
 UCLASS()
 class HELIUMRAIN_API UFlareSkirmishManager : public UObject
@@ -175,8 +259,41 @@ public:
 	void AmmoHit(bool ForPlayer);
 
 
+	/*----------------------------------------------------
+		Batch
+	----------------------------------------------------*/
+
+	/** Are we running skirmishes from the command line */
+	inline bool IsBatchRunning() const
+	{
+		return BatchActive;
+	}
+
+	/** Fill the default upgrades of a ship order */
+	static void SetOrderDefaults(FFlareSkirmishSpacecraftOrder& Order);
+
+
 protected:
 
+	/** Load skirmish definitions from a JSON file */
+	bool LoadBatch(FString Path);
+
+	/** Load a fleet definition */
+	bool LoadBatchFleet(const TArray<TSharedPtr<FJsonValue>>& Fleet, FFlareSkirmishPlayerData& Belligerent);
+
+	/** Run batch skirmishes, called every frame */
+	void UpdateBatch(float DeltaSeconds);
+
+	/** Start the current batch run */
+	void StartBatchRun();
+
+	/** Save the results of the current batch run and move to the next one */
+	void EndBatchRun();
+
+	/** Record the frame time and section times of the last frame */
+	void SampleBatchFrame();
+
+
 	/*----------------------------------------------------
 		Data
 	----------------------------------------------------*/
@@ -194,6 +311,26 @@ protected:
 	FFlareSkirmishData                               Data;
 	FFlareSkirmishResultData                         Result;
 
+	// Batch setup
+	TArray<FFlareSkirmishBatchEntry>                 BatchEntries;
+	bool                                             BatchChecked;
+	bool                                             BatchPending;
+	bool                                             BatchActive;
+	int32                                            BatchRunCount;
+	int32                                            BatchSeed;
+	int32                                            BatchRunIndex;
+	FString                                          BatchOutputPath;
+	FString                                          BatchOutput;
+
+	// Batch run state
+	bool                                             BatchRunStarted;
+	double                                           BatchLastFrameTime;
+	int32                                            BatchFrames;
+	double                                           BatchTotalFrameTime;
+	double                                           BatchMaxFrameTime;
+	TArray<double>                                   BatchTotalStatTime;
+	TArray<double>                                   BatchMaxStatTime;
+
 
 public:
 
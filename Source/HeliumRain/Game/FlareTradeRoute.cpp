@@ -226,6 +226,7 @@ bool UFlareTradeRoute::ProcessLoadOperation(FFlareTradeRouteSectorOperationSave*
 	FFlareResourceDescription* Resource = Game->GetResourceCatalog()->Get(Operation->ResourceIdentifier);
 
 	TArray<UFlareSimulatedSpacecraft*> UsefullShips;
+	TArray<int32> UsefullShipFreeSpaces;
 
 	TArray<UFlareSimulatedSpacecraft*>&  RouteShips = TradeRouteFleet->GetShips();
 	int32 FleetFreeSpace = 0;
@@ -254,6 +255,7 @@ bool UFlareTradeRoute::ProcessLoadOperation(FFlareTradeRouteSectorOperationSave*
 		{
 			FleetFreeSpace += FreeSpace;
 			UsefullShips.Add(Ship);
+			UsefullShipFreeSpaces.Add(FreeSpace);
 		}
 
 		// TODO sort by most pertinent
@@ -275,16 +277,18 @@ bool UFlareTradeRoute::ProcessLoadOperation(FFlareTradeRouteSectorOperationSave*
 	Request.AllowStorage = Operation->CanTradeWithStorages;
 	Request.AllowFullStock = true;
 
-	for (UFlareSimulatedSpacecraft* Ship : UsefullShips)
+	for (int32 ShipIndex = 0; ShipIndex < UsefullShips.Num(); ShipIndex++)
 	{
+		UFlareSimulatedSpacecraft* Ship = UsefullShips[ShipIndex];
 		if (Ship->IsTrading())
 		{
 			// Skip trading ships
 			continue;
 		}
 
+		// Other ships trading don't change this ship's cargo, the free space is still valid
 		Request.Client = Ship;
-		Request.MaxQuantity = Ship->GetActiveCargoBay()->GetFreeSpaceForResource(Resource, Ship->GetCompany());
+		Request.MaxQuantity = UsefullShipFreeSpaces[ShipIndex];
 		if (Operation->MaxQuantity !=-1)
 		{
 			Request.MaxQuantity = FMath::Min(Request.MaxQuantity, GetOperationRemainingQuantity(Operation));
@@ -292,7 +296,7 @@ bool UFlareTradeRoute::ProcessLoadOperation(FFlareTradeRouteSectorOperationSave*
 
 		if (Operation->InventoryLimit !=-1)
 		{
-			Request.MaxQuantity = FMath::Min(Request.MaxQuantity, GetOperationRemainingInventoryQuantity(Operation));
+			Request.MaxQuantity = FMath::Min(Request.MaxQuantity, GetOperationRemainingInventoryQuantity(Operation, Resource));
 		}
 
 		UFlareSimulatedSpacecraft* StationCandidate = SectorHelper::FindTradeStation(Request);
@@ -322,7 +326,7 @@ bool UFlareTradeRoute::ProcessLoadOperation(FFlareTradeRouteSectorOperationSave*
 			StatFail = true;
 		}
 
-		if (IsOperationQuantityLimitReach(Operation) || IsOperationInventoryLimitReach(Operation))
+		if (IsOperationQuantityLimitReach(Operation) || IsOperationInventoryLimitReach(Operation, Resource))
 		{
 			// Operation limit reach : operation done
 			UpdateOperationStats();
@@ -341,6 +345,7 @@ bool UFlareTradeRoute::ProcessUnloadOperation(FFlareTradeRouteSectorOperationSav
 	FFlareResourceDescription* Resource = Game->GetResourceCatalog()->Get(Operation->ResourceIdentifier);
 
 	TArray<UFlareSimulatedSpacecraft*> UsefullShips;
+	TArray<int32> UsefullShipQuantities;
 
 	TArray<UFlareSimulatedSpacecraft*>&  RouteShips = TradeRouteFleet->GetShips();
 	int32 FleetQuantity = 0;
@@ -370,6 +375,7 @@ bool UFlareTradeRoute::ProcessUnloadOperation(FFlareTradeRouteSectorOperationSav
 		{
 			FleetQuantity += Quantity;
 			UsefullShips.Add(Ship);
+			UsefullShipQuantities.Add(Quantity);
 		}
 
 		// TODO sort by most pertinent
@@ -390,17 +396,18 @@ bool UFlareTradeRoute::ProcessUnloadOperation(FFlareTradeRouteSectorOperationSav
 	Request.MaxQuantity = Operation->MaxQuantity;
 	Request.AllowStorage = Operation->CanTradeWithStorages;
 
-	for (UFlareSimulatedSpacecraft* Ship : UsefullShips)
+	for (int32 ShipIndex = 0; ShipIndex < UsefullShips.Num(); ShipIndex++)
 	{
-
+		UFlareSimulatedSpacecraft* Ship = UsefullShips[ShipIndex];
 		if (Ship->IsTrading())
 		{
 			// Skip trading ships
 			continue;
 		}
 
+		// Other ships trading don't change this ship's cargo, the quantity is still valid
 		Request.Client = Ship;
-		Request.MaxQuantity = Ship->GetActiveCargoBay()->GetResourceQuantity(Resource, Ship->GetCompany());
+		Request.MaxQuantity = UsefullShipQuantities[ShipIndex];
 		if (Operation->MaxQuantity !=-1)
 		{
 			Request.MaxQuantity = FMath::Min(Request.MaxQuantity, GetOperationRemainingQuantity(Operation));
@@ -408,7 +415,7 @@ bool UFlareTradeRoute::ProcessUnloadOperation(FFlareTradeRouteSectorOperationSav
 
 		if (Operation->InventoryLimit !=-1)
 		{
-			Request.MaxQuantity = FMath::Min(Request.MaxQuantity, GetOperationRemainingInventoryQuantity(Operation));
+			Request.MaxQuantity = FMath::Min(Request.MaxQuantity, GetOperationRemainingInventoryQuantity(Operation, Resource));
 		}
 
 		UFlareSimulatedSpacecraft* StationCandidate = SectorHelper::FindTradeStation(Request);
@@ -437,7 +444,7 @@ bool UFlareTradeRoute::ProcessUnloadOperation(FFlareTradeRouteSectorOperationSav
 			StatFail = true;
 		}
 
-		if (IsOperationQuantityLimitReach(Operation) || IsOperationInventoryLimitReach(Operation))
+		if (IsOperationQuantityLimitReach(Operation) || IsOperationInventoryLimitReach(Operation, Resource))
 		{
 			// Operation limit reach : operation done
 			UpdateOperationStats();
@@ -469,11 +476,10 @@ bool UFlareTradeRoute::IsOperationQuantityLimitReach(FFlareTradeRouteSectorOpera
 	return false;
 }
 
-int32 UFlareTradeRoute::GetOperationRemainingInventoryQuantity(FFlareTradeRouteSectorOperationSave* Operation)
+int32 UFlareTradeRoute::GetOperationRemainingInventoryQuantity(FFlareTradeRouteSectorOperationSave* Operation, FFlareResourceDescription* Resource)
 {
 	check(Operation->InventoryLimit != -1);
 
-	FFlareResourceDescription* Resource = Game->GetResourceCatalog()->Get(Operation->ResourceIdentifier);
 	int32 ResourceQuantity = TradeRouteFleet->GetFleetResourceQuantity(Resource);
 
 
@@ -488,7 +494,7 @@ int32 UFlareTradeRoute::GetOperationRemainingInventoryQuantity(FFlareTradeRouteS
 	}
 }
 
-bool UFlareTradeRoute::IsOperationInventoryLimitReach(FFlareTradeRouteSectorOperationSave* Operation)
+bool UFlareTradeRoute::IsOperationInventoryLimitReach(FFlareTradeRouteSectorOperationSave* Operation, FFlareResourceDescription* Resource)
 {
 	if(Operation->InventoryLimit == -1)
 	{
@@ -496,7 +502,7 @@ bool UFlareTradeRoute::IsOperationInventoryLimitReach(FFlareTradeRouteSectorOper
 	}
 	else
 	{
-		return GetOperationRemainingInventoryQuantity(Operation) <= 0;
+		return GetOperationRemainingInventoryQuantity(Operation, Resource) <= 0;
 	}
 }
 
@@ -185,9 +185,9 @@ public:
 
 	bool IsOperationQuantityLimitReach(FFlareTradeRouteSectorOperationSave* Operation);
 
-	int32 GetOperationRemainingInventoryQuantity(FFlareTradeRouteSectorOperationSave* Operation);
+	int32 GetOperationRemainingInventoryQuantity(FFlareTradeRouteSectorOperationSave* Operation, FFlareResourceDescription* Resource);
 
-	bool IsOperationInventoryLimitReach(FFlareTradeRouteSectorOperationSave* Operation);
+	bool IsOperationInventoryLimitReach(FFlareTradeRouteSectorOperationSave* Operation, FFlareResourceDescription* Resource);
 
 	void SetTargetSector(UFlareSimulatedSector* Sector);
 
@@ -15,6 +15,7 @@
 #include "FlareFleet.h"
 #include "FlareBattle.h"
 #include "AI/FlareAITradeHelper.h"
+#include "AI/FlareCompanyAI.h"
 
 #include "../Quests/FlareQuest.h"
 #include "../Quests/FlareQuestCondition.h"
@@ -419,6 +420,17 @@ void UFlareWorld::Simulate()
 	double StartTs = FPlatformTime::Seconds();
 	UFlareCompany* PlayerCompany = Game->GetPC()->GetCompany();
 
+	// Phase timing
+	FFlareWorldSimulationStats Stats;
+	Stats.Date = WorldData.Date;
+	double PhaseTs = StartTs;
+	auto EndPhase = [&PhaseTs](double& PhaseTime)
+	{
+		double Now = FPlatformTime::Seconds();
+		PhaseTime += Now - PhaseTs;
+		PhaseTs = Now;
+	};
+
 	/**
 	 *  End previous day
 	 */
@@ -426,6 +438,7 @@ void UFlareWorld::Simulate()
 
 	FLOG("* Simulate > Player autotrade");
 	AITradeHelper::CompanyAutoTrade(PlayerCompany);
+	EndPhase(Stats.AITrading);
 
 	FLOG("* Simulate > Battles");
 	for (int SectorIndex = 0; SectorIndex < Sectors.Num(); SectorIndex++)
@@ -485,6 +498,7 @@ void UFlareWorld::Simulate()
 			Spacecraft->GetCompany()->DestroySpacecraft(Spacecraft);
 		}
 	}
+	EndPhase(Stats.Battles);
 
 	FLOG("* Simulate > AI");
 
@@ -543,6 +557,12 @@ void UFlareWorld::Simulate()
 	IdleShips.Print();
 #endif
 
+	EndPhase(Stats.AITrading);
+
+	// AI. Share the world data between companies
+	AISnapshot = MakeShareable(new AIDaySnapshot());
+	AISnapshot->Generate(Game);
+
 	// AI. Play them in random order
 	TArray<UFlareCompany*> CompaniesToSimulateAI = Companies;
 	while(CompaniesToSimulateAI.Num())
@@ -551,6 +571,8 @@ void UFlareWorld::Simulate()
 		CompaniesToSimulateAI[Index]->SimulateAI();
 		CompaniesToSimulateAI.RemoveAt(Index);
 	}
+	AISnapshot.Reset();
+	EndPhase(Stats.CompanyAI);
 
 	// Clear bombs
 	for (int SectorIndex = 0; SectorIndex < Sectors.Num(); SectorIndex++)
@@ -698,6 +720,8 @@ void UFlareWorld::Simulate()
 	ProcessShipCapture();
 	ProcessStationCapture();
 
+	EndPhase(Stats.Other);
+
 	// Factories
 	FLOG("* Simulate > Factories");
 	for (UFlareFactory* Factory: Factories)
@@ -712,6 +736,7 @@ void UFlareWorld::Simulate()
 	{
 		Factories[FactoryIndex]->Simulate();
 	}
+	EndPhase(Stats.Factories);
 
 
 	// Peoples
@@ -720,6 +745,7 @@ void UFlareWorld::Simulate()
 	{
 		Sectors[SectorIndex]->GetPeople()->Simulate();
 	}
+	EndPhase(Stats.People);
 
 
 	FLOG("* Simulate > Trade routes");
@@ -734,6 +760,8 @@ void UFlareWorld::Simulate()
 			TradeRoutes[RouteIndex]->Simulate();
 		}
 	}
+	EndPhase(Stats.TradeRoutes);
+
 	FLOG("* Simulate > Travels");
 
 	// Undock and make move AI ships
@@ -756,6 +784,7 @@ void UFlareWorld::Simulate()
 	{
 		TravelsToProcess[TravelIndex]->Simulate();
 	}
+	EndPhase(Stats.Travels);
 	
 	FLOG("* Simulate > Prices");
 	// Price variation.
@@ -774,6 +803,7 @@ void UFlareWorld::Simulate()
 	{
 		Sectors[SectorIndex]->SwapPrices();
 	}
+	EndPhase(Stats.Prices);
 	
 	// Update reserve ships
 	for (int SectorIndex = 0; SectorIndex < Sectors.Num(); SectorIndex++)
@@ -796,10 +826,27 @@ void UFlareWorld::Simulate()
 	}
 
 	
+	EndPhase(Stats.Other);
+
 	double EndTs = FPlatformTime::Seconds();
 	FLOGV("** Simulate day %d done in %.6fs", WorldData.Date-1, EndTs- StartTs);
 
 	Game->GetQuestManager()->OnNextDay();
+	EndPhase(Stats.Quests);
+	Stats.Total = PhaseTs - StartTs;
+
+	// World size
+	Stats.CompanyCount = Companies.Num();
+	Stats.TravelCount = Travels.Num();
+	Stats.FactoryCount = Factories.Num();
+	for (UFlareCompany* Company : Companies)
+	{
+		Stats.SpacecraftCount += Company->GetCompanySpacecrafts().Num();
+		Stats.StationCount += Company->GetCompanyStations().Num();
+		Stats.FleetCount += Company->GetCompanyFleets().Num();
+		Stats.TradeRouteCount += Company->GetCompanyTradeRoutes().Num();
+	}
+	LastSimulationStats = Stats;
 
 	GameLog::DaySimulated(WorldData.Date);
 
@@ -1263,6 +1310,26 @@ void UFlareWorld::FastForward()
 	Simulate();
 }
 
+int32 UFlareWorld::FastForward(int32 DayCount, double TimeBudget, TFunctionRef<bool()> StopCondition)
+{
+	double StartTs = FPlatformTime::Seconds();
+	int32 SimulatedDays = 0;
+
+	// Always simulate at least one day, then stop when out of time or interrupted
+	while (SimulatedDays < DayCount)
+	{
+		Simulate();
+		SimulatedDays++;
+
+		if (StopCondition() || FPlatformTime::Seconds() - StartTs > TimeBudget)
+		{
+			break;
+		}
+	}
+
+	return SimulatedDays;
+}
+
 TMap<IncomingKey, IncomingValue> UFlareWorld::GetIncomingPlayerEnemy()
 {
 	// List sector with player possesion
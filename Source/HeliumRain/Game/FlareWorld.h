@@ -18,6 +18,7 @@
 
 struct FFlareSectorSave;
 struct FFlareSectorDescription;
+struct AIDaySnapshot;
 
 class UFlareCompany;
 class UFlareFleet;
@@ -91,6 +92,32 @@ inline uint32 GetTypeHash(const IncomingKey& Key)
 	return int32(Key.RemainingDuration);
 }
 
+/** Wall time of each phase of a day simulation, in seconds, and world size */
+struct FFlareWorldSimulationStats
+{
+	int64  Date = 0;
+
+	double Battles = 0;
+	double AITrading = 0;
+	double CompanyAI = 0;
+	double Factories = 0;
+	double People = 0;
+	double TradeRoutes = 0;
+	double Travels = 0;
+	double Prices = 0;
+	double Quests = 0;
+	double Other = 0;
+	double Total = 0;
+
+	int32  CompanyCount = 0;
+	int32  SpacecraftCount = 0;
+	int32  StationCount = 0;
+	int32  FleetCount = 0;
+	int32  TravelCount = 0;
+	int32  TradeRouteCount = 0;
+	int32  FactoryCount = 0;
+};
+
 struct IncomingValue
 {
 	bool NeedNotification = false;
@@ -155,6 +182,9 @@ public:
 	/** Simulate world from now to the next event */
 	void FastForward();
 
+	/** Simulate up to DayCount days within TimeBudget seconds, stopping early when StopCondition is true. Return the number of simulated days */
+	int32 FastForward(int32 DayCount, double TimeBudget, TFunctionRef<bool()> StopCondition);
+
 	UFlareTravel* StartTravel(UFlareFleet* TravelingFleet, UFlareSimulatedSector* DestinationSector, bool Force=false);
 
 	virtual void DeleteTravel(UFlareTravel* Travel);
@@ -202,6 +232,11 @@ protected:
 
 	bool WorldMoneyReferenceInit;
 
+	FFlareWorldSimulationStats            LastSimulationStats;
+
+	/** Shared company AI data, only valid while the AI is simulated */
+	TSharedPtr<AIDaySnapshot>             AISnapshot;
+
 public:
 	int64 WorldMoneyReference;
 
@@ -274,4 +309,16 @@ public:
 
 	TMap<IncomingKey, IncomingValue> GetIncomingPlayerEnemy();
 
+	/** Get the world data shared by company AIs, or NULL outside of the AI simulation */
+	inline const AIDaySnapshot* GetAIDaySnapshot() const
+	{
+		return AISnapshot.Get();
+	}
+
+	/** Get the timings of the last simulated day */
+	inline const FFlareWorldSimulationStats& GetLastSimulationStats() const
+	{
+		return LastSimulationStats;
+	}
+
 };
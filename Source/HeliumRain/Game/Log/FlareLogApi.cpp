@@ -225,127 +225,52 @@ void CombatLog::BombDestroyed(FName BombIdentifier)
 	FFlareLogWriter::PushWriterMessage(Message);
 }
 
-void CombatLog::SpacecraftDamaged(UFlareSimulatedSpacecraft* Spacecraft, float Energy, float Radius, FVector RelativeLocation, EFlareDamage::Type DamageType, UFlareCompany* DamageSource, FString DamageCauser)
+bool CombatLog::IsEnabled()
 {
-	FlareLogMessage Message;
-	Message.Target = EFlareLogTarget::Combat;
-	Message.Event = EFlareLogEvent::SPACECRAFT_DAMAGED;
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Spacecraft->GetImmatriculation().ToString();
-		Message.Params.Add(Param);
-	}
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = UFlareSaveWriter::FormatEnum<EFlareDamage::Type>("EFlareDamage", DamageType);
-		Message.Params.Add(Param);
-	}
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::Float;
-		Param.FloatValue = Energy;
-		Message.Params.Add(Param);
-	}
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::Float;
-		Param.FloatValue = Radius;
-		Message.Params.Add(Param);
-	}
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::Vector3;
-		Param.Vector3Value = RelativeLocation;
-		Message.Params.Add(Param);
-	}
+	return FFlareLogWriter::IsTargetEnabled(EFlareLogTarget::Combat);
+}
 
+void CombatLog::SpacecraftDamaged(UFlareSimulatedSpacecraft* Spacecraft, float Energy, float Radius, FVector RelativeLocation, EFlareDamage::Type DamageType, UFlareCompany* DamageSource, FString DamageCauser)
+{
+	if (!IsEnabled())
 	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue =  (DamageSource ? DamageSource->GetShortName().ToString() : "");
-		Message.Params.Add(Param);
+		return;
 	}
 
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = DamageCauser;
-		Message.Params.Add(Param);
-	}
+	FlareLogEventRecord Record;
+	Record.Target = EFlareLogTarget::Combat;
+	Record.Event = EFlareLogEvent::SPACECRAFT_DAMAGED;
+	Record.DamageType = DamageType;
+	Record.Names[0] = Spacecraft->GetImmatriculation();
+	Record.Names[1] = (DamageSource ? DamageSource->GetShortName() : NAME_None);
+	Record.Names[2] = FName(*DamageCauser);
+	Record.Values[0] = Energy;
+	Record.Values[1] = Radius;
+	Record.Location = RelativeLocation;
 
-	FFlareLogWriter::PushWriterMessage(Message);
+	FFlareLogWriter::PushWriterEvent(Record);
 }
 
 void CombatLog::SpacecraftComponentDamaged(UFlareSimulatedSpacecraft* Spacecraft, FFlareSpacecraftComponentSave* ComponentData, FFlareSpacecraftComponentDescription* ComponentDescription, float Energy, float EffectiveEnergy, EFlareDamage::Type DamageType, float InitialDamageRatio, float TerminalDamageRatio)
 {
-	FlareLogMessage Message;
-	Message.Target = EFlareLogTarget::Combat;
-	Message.Event = EFlareLogEvent::SPACECRAFT_COMPONENT_DAMAGED;
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = Spacecraft->GetImmatriculation().ToString();
-		Message.Params.Add(Param);
-	}
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = ComponentData->ShipSlotIdentifier.ToString();
-		Message.Params.Add(Param);
-	}
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = ComponentDescription->Identifier.ToString();
-		Message.Params.Add(Param);
-	}
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::Float;
-		Param.FloatValue = Energy;
-		Message.Params.Add(Param);
-	}
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::Float;
-		Param.FloatValue = EffectiveEnergy;
-		Message.Params.Add(Param);
-	}
-
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::String;
-		Param.StringValue = UFlareSaveWriter::FormatEnum<EFlareDamage::Type>("EFlareDamage", DamageType);
-		Message.Params.Add(Param);
-	}
-
+	if (!IsEnabled())
 	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::Float;
-		Param.FloatValue = InitialDamageRatio;
-		Message.Params.Add(Param);
+		return;
 	}
 
-	{
-		FlareLogMessageParam Param;
-		Param.Type = EFlareLogParam::Float;
-		Param.FloatValue = TerminalDamageRatio;
-		Message.Params.Add(Param);
-	}
+	FlareLogEventRecord Record;
+	Record.Target = EFlareLogTarget::Combat;
+	Record.Event = EFlareLogEvent::SPACECRAFT_COMPONENT_DAMAGED;
+	Record.DamageType = DamageType;
+	Record.Names[0] = Spacecraft->GetImmatriculation();
+	Record.Names[1] = ComponentData->ShipSlotIdentifier;
+	Record.Names[2] = ComponentDescription->Identifier;
+	Record.Values[0] = Energy;
+	Record.Values[1] = EffectiveEnergy;
+	Record.Values[2] = InitialDamageRatio;
+	Record.Values[3] = TerminalDamageRatio;
 
-	FFlareLogWriter::PushWriterMessage(Message);
+	FFlareLogWriter::PushWriterEvent(Record);
 }
 
 void CombatLog::SpacecraftHarpooned(UFlareSimulatedSpacecraft* Spacecraft, UFlareCompany* HarpoonOwner)
@@ -76,6 +76,9 @@ public:
 class CombatLog
 {
 public:
+	/** Return true if combat events are written, to skip preparing their parameters */
+	static bool IsEnabled();
+
 	/**
 	 * The sector has been activated
 	 *
@@ -10,6 +10,8 @@
 FFlareLogWriter* FFlareLogWriter::Runnable = NULL;
 //***********************************************************
 
+uint32 FFlareLogWriter::EnabledTargets = (1 << EFlareLogTarget::Game) | (1 << EFlareLogTarget::Combat);
+
 static int ThreadIndex = 0;
 
 FFlareLogWriter::FFlareLogWriter(FName UUID)
@@ -21,6 +23,7 @@ FFlareLogWriter::FFlareLogWriter(FName UUID)
 
 	GameLogFile = NULL;
 	CombatLogFile = NULL;
+	EventBuffer.SetNum(LOG_EVENT_BUFFER_SIZE);
 
 	Thread = FRunnableThread::Create(this, *Name, 0, TPri_BelowNormal); //windows default = 8mb for thread, could specify more
 	ThreadIndex++;
@@ -60,10 +63,34 @@ uint32 FFlareLogWriter::Run()
 	{
 		NewMessageEvent->Wait();
 
-		FlareLogMessage Message;
-		while (MessageQueue.Dequeue(Message))
+		// Write messages and event records in the order they were pushed
+		while (true)
+		{
+			FlareLogMessage* NextMessage = MessageQueue.Peek();
+			bool HasEvent = (EventTail.GetValue() != EventHead.GetValue());
+
+			if (NextMessage && (!HasEvent || NextMessage->Sequence < EventBuffer[EventTail.GetValue() % LOG_EVENT_BUFFER_SIZE].Sequence))
+			{
+				WriteMessage(*NextMessage);
+				MessageQueue.Pop();
+			}
+			else if (HasEvent)
+			{
+				FlareLogMessage Message;
+				DecodeEvent(EventBuffer[EventTail.GetValue() % LOG_EVENT_BUFFER_SIZE], Message);
+				EventTail.Increment();
+				WriteMessage(Message);
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		int32 DroppedEvents = DroppedEventCount.Set(0);
+		if (DroppedEvents > 0)
 		{
-			WriteMessage(Message);
+			FLOGV("FFlareLogWriter::Run : %d log events dropped", DroppedEvents);
 		}
 	}
 
@@ -225,17 +252,122 @@ FString FFlareLogWriter::FormatParam(FlareLogMessageParam* Param)
 	return "";
 }
 
+void FFlareLogWriter::DecodeEvent(const FlareLogEventRecord& Record, FlareLogMessage& Message)
+{
+	Message.Date = Record.Date;
+	Message.Sequence = Record.Sequence;
+	Message.Target = Record.Target;
+	Message.Event = Record.Event;
+
+	auto AddString = [&Message](FString Value)
+	{
+		FlareLogMessageParam Param;
+		Param.Type = EFlareLogParam::String;
+		Param.StringValue = Value;
+		Message.Params.Add(Param);
+	};
+
+	auto AddName = [&AddString](FName Value)
+	{
+		AddString(Value == NAME_None ? FString() : Value.ToString());
+	};
+
+	auto AddFloat = [&Message](float Value)
+	{
+		FlareLogMessageParam Param;
+		Param.Type = EFlareLogParam::Float;
+		Param.FloatValue = Value;
+		Message.Params.Add(Param);
+	};
+
+	FString DamageType = UFlareSaveWriter::FormatEnum<EFlareDamage::Type>("EFlareDamage", (EFlareDamage::Type) Record.DamageType);
+
+	switch (Record.Event)
+	{
+		case EFlareLogEvent::SPACECRAFT_DAMAGED:
+		{
+			AddName(Record.Names[0]);
+			AddString(DamageType);
+			AddFloat(Record.Values[0]);
+			AddFloat(Record.Values[1]);
+
+			FlareLogMessageParam Param;
+			Param.Type = EFlareLogParam::Vector3;
+			Param.Vector3Value = Record.Location;
+			Message.Params.Add(Param);
+
+			AddName(Record.Names[1]);
+			AddName(Record.Names[2]);
+		}
+		break;
+
+		case EFlareLogEvent::SPACECRAFT_COMPONENT_DAMAGED:
+			AddName(Record.Names[0]);
+			AddName(Record.Names[1]);
+			AddName(Record.Names[2]);
+			AddFloat(Record.Values[0]);
+			AddFloat(Record.Values[1]);
+			AddString(DamageType);
+			AddFloat(Record.Values[2]);
+			AddFloat(Record.Values[3]);
+			break;
+
+		default:
+			FLOGV("Invalid log event record %d", (Record.Event + 0));
+			break;
+	}
+}
+
 void FFlareLogWriter::PushMessage(FlareLogMessage& Message)
 {
 	Message.Date = FDateTime::UtcNow();
+	Message.Sequence = MessageSequence.Increment();
 	MessageQueue.Enqueue(Message);
 	NewMessageEvent->Trigger();
 }
 
+void FFlareLogWriter::PushEvent(FlareLogEventRecord& Record)
+{
+	int32 Head = EventHead.GetValue();
+	if (Head - EventTail.GetValue() >= LOG_EVENT_BUFFER_SIZE)
+	{
+		DroppedEventCount.Increment();
+		return;
+	}
+
+	Record.Date = FDateTime::UtcNow();
+	Record.Sequence = MessageSequence.Increment();
+	EventBuffer[Head % LOG_EVENT_BUFFER_SIZE] = Record;
+
+	// Publish the record once it is fully written
+	EventHead.Increment();
+	NewMessageEvent->Trigger();
+}
+
 void FFlareLogWriter::PushWriterMessage(FlareLogMessage& Message)
 {
-	if (Runnable)
+	if (IsTargetEnabled(Message.Target))
 	{
 		Runnable->PushMessage(Message);
 	}
 }
+
+void FFlareLogWriter::PushWriterEvent(FlareLogEventRecord& Record)
+{
+	if (IsTargetEnabled(Record.Target))
+	{
+		Runnable->PushEvent(Record);
+	}
+}
+
+void FFlareLogWriter::SetTargetEnabled(EFlareLogTarget::Type Target, bool Enabled)
+{
+	if (Enabled)
+	{
+		EnabledTargets |= (1 << Target);
+	}
+	else
+	{
+		EnabledTargets &= ~(1 << Target);
+	}
+}
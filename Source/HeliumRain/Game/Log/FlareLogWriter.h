@@ -62,11 +62,28 @@ struct FlareLogMessageParam
 struct FlareLogMessage
 {
 	FDateTime Date;
+	uint32 Sequence;
 	EFlareLogTarget::Type Target;
 	EFlareLogEvent::Type Event;
 	TArray<FlareLogMessageParam> Params;
 };
 
+/** Fixed-size record for frequent events, formatted by the writer thread */
+struct FlareLogEventRecord
+{
+	FDateTime Date;
+	uint32 Sequence;
+	EFlareLogTarget::Type Target;
+	EFlareLogEvent::Type Event;
+	uint8 DamageType;
+	FName Names[4];
+	float Values[4];
+	FVector Location;
+};
+
+// Max count of pending event records
+#define LOG_EVENT_BUFFER_SIZE 4096
+
 
 //~~~~~ Multi Threading ~~~
 class FFlareLogWriter : public FRunnable
@@ -91,6 +108,9 @@ class FFlareLogWriter : public FRunnable
 
 	void WriteMessage(FlareLogMessage& Message);
 
+	/** Convert an event record to a message */
+	void DecodeEvent(const FlareLogEventRecord& Record, FlareLogMessage& Message);
+
 	FString FormatMessage(FlareLogMessage& Message);
 
 	FString FormatParam(FlareLogMessageParam* Param);
@@ -99,6 +119,17 @@ private:
 	int32					PrimesFoundCount;
 	FEvent*					NewMessageEvent;
 	TQueue<FlareLogMessage>	MessageQueue;
+
+	// Single producer ring buffer of event records
+	TArray<FlareLogEventRecord> EventBuffer;
+	FThreadSafeCounter      EventHead;
+	FThreadSafeCounter      EventTail;
+	FThreadSafeCounter      DroppedEventCount;
+	FThreadSafeCounter      MessageSequence;
+
+	/** Targets currently written */
+	static uint32           EnabledTargets;
+
 	IFileHandle*			GameLogFile;
 	IFileHandle*			CombatLogFile;
 	FName					GameUUID;
@@ -114,6 +145,8 @@ public:
 
 	void PushMessage(FlareLogMessage& Message);
 
+	void PushEvent(FlareLogEventRecord& Record);
+
 	// Begin FRunnable interface.
 	virtual bool Init();
 	virtual uint32 Run();
@@ -137,6 +170,17 @@ public:
 	static FFlareLogWriter* InitWriter(FName UUID);
 	static void PushWriterMessage(FlareLogMessage& Message);
 
+	/** Push an event record, only from the game thread */
+	static void PushWriterEvent(FlareLogEventRecord& Record);
+
+	/** Cheap check to skip building events for a target that isn't written */
+	static inline bool IsTargetEnabled(EFlareLogTarget::Type Target)
+	{
+		return Runnable && (EnabledTargets & (1 << Target));
+	}
+
+	static void SetTargetEnabled(EFlareLogTarget::Type Target, bool Enabled);
+
 	/** Shuts down the thread. Static so it can easily be called from outside the thread context */
 	static void Shutdown();
 
@@ -15,6 +15,9 @@ const FPreciseVector FPreciseVector::ZeroVector = FPreciseVector();
 
 UFlareSimulatedPlanetarium::UFlareSimulatedPlanetarium(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, BodyLocationsValid(false)
+	, BodyLocationsTime(0)
+	, BodyLocationsSmoothTime(0)
 {
 }
 
@@ -88,12 +91,41 @@ void UFlareSimulatedPlanetarium::Load()
 		Nema.Sattelites.Add(Adena);
 	}
 	Sun.Sattelites.Add(Nema);
+
+	// Flatten the body tree now that it won't change anymore
+	Bodies.Empty();
+	BodyIndices.Empty();
+	IndexCelestialBody(&Sun, INDEX_NONE);
+	BodyLocationsValid = false;
+}
+
+void UFlareSimulatedPlanetarium::IndexCelestialBody(FFlareCelestialBody* Body, int32 ParentIndex)
+{
+	FFlareCelestialBodyEntry Entry;
+	Entry.Body = Body;
+	Entry.ParentIndex = ParentIndex;
+	Entry.RevolutionTime = 0;
+	Entry.RotationPeriod = ComputeRotationPeriod(Body->RotationVelocity);
+
+	if (ParentIndex != INDEX_NONE)
+	{
+		Entry.RevolutionTime = ComputeRevolutionTime(Bodies[ParentIndex].Body->Mass, Body->Mass, Body->OrbitDistance);
+	}
+
+	int32 BodyIndex = Bodies.Add(Entry);
+	BodyIndices.Add(Body->Identifier, BodyIndex);
+
+	for (int SatteliteIndex = 0; SatteliteIndex < Body->Sattelites.Num(); SatteliteIndex++)
+	{
+		IndexCelestialBody(&Body->Sattelites[SatteliteIndex], BodyIndex);
+	}
 }
 
 
 FFlareCelestialBody* UFlareSimulatedPlanetarium::FindCelestialBody(FName BodyIdentifier)
 {
-	return FindCelestialBody(&Sun, BodyIdentifier);
+	int32* BodyIndex = BodyIndices.Find(BodyIdentifier);
+	return BodyIndex ? Bodies[*BodyIndex].Body : NULL;
 }
 
 FFlareCelestialBody* UFlareSimulatedPlanetarium::FindCelestialBody(FFlareCelestialBody* Body, FName BodyIdentifier)
@@ -123,6 +155,13 @@ FFlareCelestialBody* UFlareSimulatedPlanetarium::FindParent(FFlareCelestialBody*
 		return NULL;
 	}
 
+	int32* BodyIndex = BodyIndices.Find(Body->Identifier);
+	if (BodyIndex && Bodies[*BodyIndex].Body == Body)
+	{
+		int32 ParentIndex = Bodies[*BodyIndex].ParentIndex;
+		return (ParentIndex == INDEX_NONE) ? NULL : Bodies[ParentIndex].Body;
+	}
+
 	return FindParent(Body, &Sun);
 }
 
@@ -166,34 +205,101 @@ float UFlareSimulatedPlanetarium::GetLightRatio(FFlareCelestialBody* Body, doubl
 
 FFlareCelestialBody UFlareSimulatedPlanetarium::GetSnapShot(int64 Time, float SmoothTime)
 {
-	ComputeCelestialBodyLocation(NULL, &Sun, Time, SmoothTime);
+	ComputeBodyLocations(Time, SmoothTime);
 	return Sun;
 }
 
-FPreciseVector UFlareSimulatedPlanetarium::GetRelativeLocation(FFlareCelestialBody* ParentBody, int64 Time, float SmoothTime, double OrbitDistance, double Mass, double InitialPhase)
+void UFlareSimulatedPlanetarium::ComputeBodyLocations(int64 Time, float SmoothTime)
+{
+	if (BodyLocationsValid && BodyLocationsTime == Time && BodyLocationsSmoothTime == SmoothTime)
+	{
+		return;
+	}
+
+	// Parents come first, so their absolute location is always up to date
+	for (const FFlareCelestialBodyEntry& Entry : Bodies)
+	{
+		FFlareCelestialBody* Body = Entry.Body;
+
+		if (Entry.ParentIndex != INDEX_NONE)
+		{
+			Body->RelativeLocation = ComputeOrbitLocation(Entry.RevolutionTime, Time, SmoothTime, Body->OrbitDistance, 0);
+			Body->AbsoluteLocation = Bodies[Entry.ParentIndex].Body->AbsoluteLocation + Body->RelativeLocation;
+		}
+
+		Body->RotationAngle = ComputeRotationAngle(Body->RotationVelocity, Entry.RotationPeriod, Time, SmoothTime);
+	}
+
+	BodyLocationsValid = true;
+	BodyLocationsTime = Time;
+	BodyLocationsSmoothTime = SmoothTime;
+}
+
+double UFlareSimulatedPlanetarium::CheckBodyLocations(int64 StartTime, int64 EndTime, int64 Step)
+{
+	FFlareCelestialBody Reference = Sun;
+	double MaxError = 0;
+
+	for (int64 Time = StartTime; Time < EndTime; Time += FMath::Max(Step, (int64) 1))
+	{
+		float SmoothTime = (Time % 10) / 10.f;
+		ComputeCelestialBodyLocation(NULL, &Reference, Time, SmoothTime);
+		ComputeBodyLocations(Time, SmoothTime);
+
+		for (const FFlareCelestialBodyEntry& Entry : Bodies)
+		{
+			FFlareCelestialBody* ReferenceBody = FindCelestialBody(&Reference, Entry.Body->Identifier);
+			MaxError = FMath::Max(MaxError, (ReferenceBody->AbsoluteLocation - Entry.Body->AbsoluteLocation).Size());
+			MaxError = FMath::Max(MaxError, FMath::Abs(ReferenceBody->RotationAngle - Entry.Body->RotationAngle));
+		}
+	}
+
+	return MaxError;
+}
+
+int64 UFlareSimulatedPlanetarium::ComputeRevolutionTime(double ParentMass, double Mass, double OrbitDistance)
 {
 	// TODO extract the constant
 	double G = 6.674e-11; // Gravitational constant
 
-	double MassSum = ParentBody->Mass + Mass;
+	double MassSum = ParentMass + Mass;
 	double OrbitalVelocity = FPreciseMath::Sqrt(G * ((MassSum) / (1000 * OrbitDistance)));
 
 	double OrbitalCircumference = 2 * PI * 1000 * OrbitDistance;
-	int64 RevolutionTime = (int64) (OrbitalCircumference / OrbitalVelocity);
+	return (int64) (OrbitalCircumference / OrbitalVelocity);
+}
 
+int64 UFlareSimulatedPlanetarium::ComputeRotationPeriod(double RotationVelocity)
+{
+	return (RotationVelocity == 0) ? 0 : (int64) (360 / RotationVelocity);
+}
+
+FPreciseVector UFlareSimulatedPlanetarium::ComputeOrbitLocation(int64 RevolutionTime, int64 Time, float SmoothTime, double OrbitDistance, double InitialPhase)
+{
 	double CurrentRevolutionTime = fmod(((double) (Time % RevolutionTime) + SmoothTime), (double) RevolutionTime);
 
 	double Phase = (360 * CurrentRevolutionTime / (double) RevolutionTime) + InitialPhase;
 
-
-	FPreciseVector RelativeLocation = OrbitDistance * FPreciseVector(FPreciseMath::Cos(FPreciseMath::DegreesToRadians(Phase)),
+	return OrbitDistance * FPreciseVector(FPreciseMath::Cos(FPreciseMath::DegreesToRadians(Phase)),
 			0,
 			FPreciseMath::Sin(FPreciseMath::DegreesToRadians(Phase)));
+}
 
+double UFlareSimulatedPlanetarium::ComputeRotationAngle(double RotationVelocity, int64 RotationPeriod, int64 Time, float SmoothTime)
+{
+	if (RotationPeriod == 0)
+	{
+		return 0;
+	}
 
-	return RelativeLocation;
+	return FPreciseMath::UnwindDegrees(RotationVelocity * (Time % RotationPeriod)) + RotationVelocity * SmoothTime;
 }
 
+FPreciseVector UFlareSimulatedPlanetarium::GetRelativeLocation(FFlareCelestialBody* ParentBody, int64 Time, float SmoothTime, double OrbitDistance, double Mass, double InitialPhase)
+{
+	int64 RevolutionTime = ComputeRevolutionTime(ParentBody->Mass, Mass, OrbitDistance);
+	return ComputeOrbitLocation(RevolutionTime, Time, SmoothTime, OrbitDistance, InitialPhase);
+}
 
 void UFlareSimulatedPlanetarium::ComputeCelestialBodyLocation(FFlareCelestialBody* ParentBody, FFlareCelestialBody* Body, int64 Time, float SmoothTime)
 {
@@ -203,9 +309,7 @@ void UFlareSimulatedPlanetarium::ComputeCelestialBodyLocation(FFlareCelestialBod
 		Body->AbsoluteLocation = ParentBody->AbsoluteLocation + Body->RelativeLocation;
 	}
 
-	int64 RotationPeriod = 360/Body->RotationVelocity;
-
-	Body->RotationAngle = FPreciseMath::UnwindDegrees(Body->RotationVelocity * (Time % RotationPeriod)) + Body->RotationVelocity * SmoothTime;
+	Body->RotationAngle = ComputeRotationAngle(Body->RotationVelocity, ComputeRotationPeriod(Body->RotationVelocity), Time, SmoothTime);
 	for (int SatteliteIndex = 0; SatteliteIndex < Body->Sattelites.Num(); SatteliteIndex++)
 	{
 		FFlareCelestialBody* CelestialBody = &Body->Sattelites[SatteliteIndex];
@@ -224,6 +224,23 @@ struct FFlareCelestialBody
 };
 
 
+/** Flattened celestial body entry, parents are always stored before their sattelites */
+struct FFlareCelestialBodyEntry
+{
+	/** Body in the celestial body tree */
+	FFlareCelestialBody* Body;
+
+	/** Index of the parent entry, INDEX_NONE for the root star */
+	int32 ParentIndex;
+
+	/** Orbital period around the parent. In s */
+	int64 RevolutionTime;
+
+	/** Self rotation period. In s, 0 if the body doesn't rotate */
+	int64 RotationPeriod;
+};
+
+
 UCLASS()
 class HELIUMRAIN_API UFlareSimulatedPlanetarium : public UObject
 {
@@ -238,6 +255,12 @@ public:
 	/** Load the planetarium */
 	virtual FFlareCelestialBody GetSnapShot(int64 Time, float SmoothTime);
 
+	/** Compute the location of all celestial bodies at the given time. Results are kept until the time changes */
+	void ComputeBodyLocations(int64 Time, float SmoothTime);
+
+	/** Compare the cached locations with the recursive computation over a time range, return the max error in km */
+	double CheckBodyLocations(int64 StartTime, int64 EndTime, int64 Step);
+
 	/** Get relative location of a body orbiting around its parent */
 	virtual FPreciseVector GetRelativeLocation(FFlareCelestialBody* ParentBody, int64 Time, float SmoothTime, double OrbitDistance, double Mass, double InitialPhase);
 
@@ -262,6 +285,21 @@ protected:
 
 	void ComputeCelestialBodyLocation(FFlareCelestialBody* ParentBody, FFlareCelestialBody* Body, int64 time, float SmoothTime);
 
+	/** Add a body and its sattelites to the flattened body list */
+	void IndexCelestialBody(FFlareCelestialBody* Body, int32 ParentIndex);
+
+	/** Get the orbital period of a body around its parent */
+	static int64 ComputeRevolutionTime(double ParentMass, double Mass, double OrbitDistance);
+
+	/** Get the self rotation period of a body */
+	static int64 ComputeRotationPeriod(double RotationVelocity);
+
+	/** Get the location of a body on its orbit */
+	static FPreciseVector ComputeOrbitLocation(int64 RevolutionTime, int64 Time, float SmoothTime, double OrbitDistance, double InitialPhase);
+
+	/** Get the self rotation angle of a body */
+	static double ComputeRotationAngle(double RotationVelocity, int64 RotationPeriod, int64 Time, float SmoothTime);
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -270,6 +308,15 @@ protected:
 
 	FFlareCelestialBody           Sun;
 
+	// Flattened body tree
+	TArray<FFlareCelestialBodyEntry> Bodies;
+	TMap<FName, int32>            BodyIndices;
+
+	// Location cache
+	bool                          BodyLocationsValid;
+	int64                         BodyLocationsTime;
+	float                         BodyLocationsSmoothTime;
+
 public:
 
 	/*----------------------------------------------------
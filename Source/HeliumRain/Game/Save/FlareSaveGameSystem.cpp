@@ -81,14 +81,9 @@ bool UFlareSaveGameSystem::SaveGame(const FString SaveName, UFlareSaveGame* Save
 	return ret;
 }
 
-UFlareSaveGame* UFlareSaveGameSystem::LoadGame(const FString SaveName)
+bool UFlareSaveGameSystem::LoadSaveString(const FString SaveName, FString& SaveString)
 {
-	FLOGV("UFlareSaveGameSystem::LoadGame SaveName=%s", *SaveName);
-
-	UFlareSaveGame *SaveGame = NULL;
-
 	// Read the saveto a string
-	FString SaveString;
 	bool SaveStringLoaded = false;
 
 	TArray<uint8> Data;
@@ -118,7 +113,10 @@ UFlareSaveGame* UFlareSaveGameSystem::LoadGame(const FString SaveName)
 
 		Data[UncompressedSize] = 0; // end string
 
-		Result = UTF8_TO_TCHAR(Data.GetData());
+		// Convert with the known length to avoid a second scan and copy of the save
+		FUTF8ToTCHAR Converter((const ANSICHAR*) Data.GetData(), UncompressedSize);
+		Result = FString(Converter.Length(), Converter.Get());
+		Data.Empty();
 
 		return true;
 	};
@@ -134,28 +132,156 @@ UFlareSaveGame* UFlareSaveGameSystem::LoadGame(const FString SaveName)
 		SaveStringLoaded = true;
 	}
 
-	if(SaveStringLoaded)
+	if (!SaveStringLoaded)
+	{
+		FLOGV("Fail to read save '%s' or '%s'", *GetSaveGamePath(SaveName, true), *GetSaveGamePath(SaveName, false));
+	}
+
+	return SaveStringLoaded;
+}
+
+UFlareSaveGame* UFlareSaveGameSystem::LoadGame(const FString SaveName)
+{
+	FLOGV("UFlareSaveGameSystem::LoadGame SaveName=%s", *SaveName);
+
+	UFlareSaveGame *SaveGame = NULL;
+
+	FString SaveString;
+	if(LoadSaveString(SaveName, SaveString))
 	{
-		// Deserialize a JSON object from the string
-		TSharedPtr< FJsonObject > Object;
-		TSharedRef< TJsonReader<> > Reader = TJsonReaderFactory<>::Create(SaveString);
-		if(FJsonSerializer::Deserialize(Reader, Object) && Object.IsValid())
+		// Parse the JSON stream directly into the save
+		UFlareSaveReaderV1* SaveReader = NewObject<UFlareSaveReaderV1>(this, UFlareSaveReaderV1::StaticClass());
+		SaveGame = SaveReader->LoadGameStream(SaveString);
+		if (!SaveGame)
 		{
-			UFlareSaveReaderV1* SaveReader = NewObject<UFlareSaveReaderV1>(this, UFlareSaveReaderV1::StaticClass());
-			SaveGame = SaveReader->LoadGame(Object);
+			FLOGV("Fail to deserialize save '%s' (len: %d)", *GetSaveGamePath(SaveName, false), SaveString.Len());
+		}
+	}
+
+	return SaveGame;
+}
+
+/** Compare two reflected values property by property, logging the path of each mismatch */
+static int32 CompareSaveProperties(const UStruct* Struct, const void* DataA, const void* DataB, const FString& Path)
+{
+	int32 Mismatches = 0;
+
+	for (TFieldIterator<UProperty> It(Struct); It; ++It)
+	{
+		UProperty* Property = *It;
+		if (Property->Identical_InContainer(DataA, DataB))
+		{
+			continue;
+		}
+
+		FString PropertyPath = Path + "." + Property->GetName();
+		UStructProperty* StructProperty = Cast<UStructProperty>(Property);
+		UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property);
+		UStructProperty* InnerStructProperty = ArrayProperty ? Cast<UStructProperty>(ArrayProperty->Inner) : NULL;
+
+		// Find the mismatching fields of structures
+		if (StructProperty)
+		{
+			int32 StructMismatches = CompareSaveProperties(StructProperty->Struct,
+				StructProperty->ContainerPtrToValuePtr<void>(DataA), StructProperty->ContainerPtrToValuePtr<void>(DataB), PropertyPath);
+
+			// Structures with custom comparison, like bundles, may differ in unreflected data
+			if (StructMismatches == 0)
+			{
+				FLOGV("CompareSaveProperties : %s differs", *PropertyPath);
+				StructMismatches = 1;
+			}
+			Mismatches += StructMismatches;
 		}
+
+		// Find the mismatching elements of structure arrays
+		else if (InnerStructProperty)
+		{
+			FScriptArrayHelper ArrayA(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(DataA));
+			FScriptArrayHelper ArrayB(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(DataB));
+
+			if (ArrayA.Num() != ArrayB.Num())
+			{
+				FLOGV("CompareSaveProperties : %s has %d elements instead of %d", *PropertyPath, ArrayB.Num(), ArrayA.Num());
+				Mismatches++;
+			}
+			else
+			{
+				for (int32 Index = 0; Index < ArrayA.Num(); Index++)
+				{
+					Mismatches += CompareSaveProperties(InnerStructProperty->Struct, ArrayA.GetRawPtr(Index), ArrayB.GetRawPtr(Index),
+						FString::Printf(TEXT("%s[%d]"), *PropertyPath, Index));
+				}
+			}
+		}
+
+		// Values
 		else
 		{
-			FLOGV("Fail to deserialize save '%s' (len: %d)", *GetSaveGamePath(SaveName, false), SaveString.Len());
+			FLOGV("CompareSaveProperties : %s differs", *PropertyPath);
+			Mismatches++;
 		}
 	}
-	else
+
+	return Mismatches;
+}
+
+int32 UFlareSaveGameSystem::CompareSaveReaders(const FString SaveName)
+{
+	FString SaveString;
+	if (!LoadSaveString(SaveName, SaveString))
 	{
-		FLOGV("Fail to read save '%s' or '%s'", *GetSaveGamePath(SaveName, true), *GetSaveGamePath(SaveName, false));
+		return -1;
+	}
 
+	UFlareSaveReaderV1* SaveReader = NewObject<UFlareSaveReaderV1>(this, UFlareSaveReaderV1::StaticClass());
+
+	// Stream reader
+	double StartTs = FPlatformTime::Seconds();
+	UFlareSaveGame* StreamSave = SaveReader->LoadGameStream(SaveString);
+	double StreamTime = FPlatformTime::Seconds() - StartTs;
+
+	// Document reader
+	StartTs = FPlatformTime::Seconds();
+	UFlareSaveGame* DocumentSave = NULL;
+	TSharedPtr< FJsonObject > Object;
+	TSharedRef< TJsonReader<> > Reader = TJsonReaderFactory<>::Create(SaveString);
+	if (FJsonSerializer::Deserialize(Reader, Object) && Object.IsValid())
+	{
+		DocumentSave = SaveReader->LoadGame(Object);
 	}
+	Object.Reset();
+	double DocumentTime = FPlatformTime::Seconds() - StartTs;
 
-	return SaveGame;
+	if (!StreamSave || !DocumentSave)
+	{
+		FLOGV("UFlareSaveGameSystem::CompareSaveReaders : failed to read '%s' (stream %d, document %d)", *SaveName, StreamSave != NULL, DocumentSave != NULL);
+		return -1;
+	}
+
+	int32 Mismatches = CompareSaveProperties(UFlareSaveGame::StaticClass(), DocumentSave, StreamSave, SaveName);
+	FLOGV("UFlareSaveGameSystem::CompareSaveReaders : '%s' read in %fs with the stream reader and %fs with the document reader, %d mismatches",
+		*SaveName, StreamTime, DocumentTime, Mismatches);
+
+	return Mismatches;
+}
+
+UFlareSaveGame* UFlareSaveGameSystem::RoundTripGame(UFlareSaveGame* SaveData)
+{
+	UFlareSaveWriter* SaveWriter = NewObject<UFlareSaveWriter>(this, UFlareSaveWriter::StaticClass());
+	TSharedRef<FJsonObject> JsonObject = SaveWriter->SaveGame(SaveData);
+
+	FString SaveString;
+	TSharedRef< TJsonWriter<> > JsonWriter = TJsonWriterFactory<>::Create(&SaveString);
+	if (!FJsonSerializer::Serialize(JsonObject, JsonWriter))
+	{
+		FLOG("UFlareSaveGameSystem::RoundTripGame : fail to serialize save");
+		return NULL;
+	}
+	JsonWriter->Close();
+
+	UFlareSaveReaderV1* SaveReader = NewObject<UFlareSaveReaderV1>(this, UFlareSaveReaderV1::StaticClass());
+	return SaveReader->LoadGameStream(SaveString);
 }
 
 bool UFlareSaveGameSystem::DeleteGame(const FString SaveName)
@@ -25,6 +25,12 @@ public:
 
 	virtual UFlareSaveGame* LoadGame(const FString SaveName);
 
+	/** Load a save with both the stream and the document readers, and compare the results. Return the mismatch count, or -1 on failure. */
+	int32 CompareSaveReaders(const FString SaveName);
+
+	/** Write a save to JSON text and read it back with the stream reader, without touching the disk. Return NULL on failure. */
+	UFlareSaveGame* RoundTripGame(UFlareSaveGame* SaveData);
+
 
 	virtual bool DeleteGame(const FString SaveName);
 
@@ -33,6 +39,9 @@ public:
 
 protected:
 
+	/** Read the save text, compressed or not */
+	bool LoadSaveString(const FString SaveName, FString& SaveString);
+
 
 	/*----------------------------------------------------
 		Protected data
@@ -74,7 +74,11 @@ UFlareSaveGame* UFlareSaveReaderV1::LoadGame(TSharedPtr< FJsonObject > GameObjec
 	return SaveGame;
 }
 
-void UFlareSaveReaderV1::LoadPlayer(const TSharedPtr<FJsonObject> Object, FFlarePlayerSave* Data)
+/*----------------------------------------------------
+	Loaders
+----------------------------------------------------*/
+
+void UFlareSaveReaderV1::LoadPlayer(const TSharedPtr<FJsonObject>& Object, FFlarePlayerSave* Data)
 {
 	LoadFName(Object, "UUID", &Data->UUID);
 	LoadInt32(Object, "ScenarioId", &Data->ScenarioId);
@@ -98,7 +102,7 @@ void UFlareSaveReaderV1::LoadPlayer(const TSharedPtr<FJsonObject> Object, FFlare
 	const TArray<TSharedPtr<FJsonValue>>* UnlockedScannables;
 	if (Object->TryGetArrayField("UnlockedScannables", UnlockedScannables))
 	{
-		for (TSharedPtr<FJsonValue> Scannable : *UnlockedScannables)
+		for (const TSharedPtr<FJsonValue>& Scannable : *UnlockedScannables)
 		{
 			Data->UnlockedScannables.AddUnique(FName(*Scannable->AsString()));
 		}
@@ -106,7 +110,7 @@ void UFlareSaveReaderV1::LoadPlayer(const TSharedPtr<FJsonObject> Object, FFlare
 }
 
 
-void UFlareSaveReaderV1::LoadQuest(const TSharedPtr<FJsonObject> Object, FFlareQuestSave* Data)
+void UFlareSaveReaderV1::LoadQuest(const TSharedPtr<FJsonObject>& Object, FFlareQuestSave* Data)
 {
 
 	LoadFName(Object, "SelectedQuest", &Data->SelectedQuest);
@@ -118,7 +122,7 @@ void UFlareSaveReaderV1::LoadQuest(const TSharedPtr<FJsonObject> Object, FFlareQ
 	const TArray<TSharedPtr<FJsonValue>>* QuestProgresses;
 	if(Object->TryGetArrayField("QuestProgresses", QuestProgresses))
 	{
-		for (TSharedPtr<FJsonValue> Item : *QuestProgresses)
+		for (const TSharedPtr<FJsonValue>& Item : *QuestProgresses)
 		{
 			FFlareQuestProgressSave ChildData;
 			LoadQuestProgress(Item->AsObject(), &ChildData);
@@ -129,7 +133,7 @@ void UFlareSaveReaderV1::LoadQuest(const TSharedPtr<FJsonObject> Object, FFlareQ
 	const TArray<TSharedPtr<FJsonValue>>* GeneratedQuests;
 	if(Object->TryGetArrayField("GeneratedQuests", GeneratedQuests))
 	{
-		for (TSharedPtr<FJsonValue> Item : *GeneratedQuests)
+		for (const TSharedPtr<FJsonValue>& Item : *GeneratedQuests)
 		{
 			FFlareGeneratedQuestSave ChildData;
 			LoadGeneratedQuest(Item->AsObject(), &ChildData);
@@ -143,7 +147,7 @@ void UFlareSaveReaderV1::LoadQuest(const TSharedPtr<FJsonObject> Object, FFlareQ
 }
 
 
-void UFlareSaveReaderV1::LoadQuestProgress(const TSharedPtr<FJsonObject> Object, FFlareQuestProgressSave* Data)
+void UFlareSaveReaderV1::LoadQuestProgress(const TSharedPtr<FJsonObject>& Object, FFlareQuestProgressSave* Data)
 {
 	LoadFName(Object, "QuestIdentifier", &Data->QuestIdentifier);
 	Data->Status = LoadEnum<EFlareQuestStatus::Type>(Object, "Status", "EFlareQuestStatus");
@@ -157,7 +161,7 @@ void UFlareSaveReaderV1::LoadQuestProgress(const TSharedPtr<FJsonObject> Object,
 	const TArray<TSharedPtr<FJsonValue>>* CurrentStepProgress;
 	if(Object->TryGetArrayField("CurrentStepProgress", CurrentStepProgress))
 	{
-		for (TSharedPtr<FJsonValue> Item : *CurrentStepProgress)
+		for (const TSharedPtr<FJsonValue>& Item : *CurrentStepProgress)
 		{
 			FFlareQuestConditionSave ChildData;
 			LoadQuestStepProgress(Item->AsObject(), &ChildData);
@@ -168,7 +172,7 @@ void UFlareSaveReaderV1::LoadQuestProgress(const TSharedPtr<FJsonObject> Object,
 	const TArray<TSharedPtr<FJsonValue>>* TriggerConditionsSave;
 	if(Object->TryGetArrayField("TriggerConditionsSave", TriggerConditionsSave))
 	{
-		for (TSharedPtr<FJsonValue> Item : *TriggerConditionsSave)
+		for (const TSharedPtr<FJsonValue>& Item : *TriggerConditionsSave)
 		{
 			FFlareQuestConditionSave ChildData;
 			LoadQuestStepProgress(Item->AsObject(), &ChildData);
@@ -179,7 +183,7 @@ void UFlareSaveReaderV1::LoadQuestProgress(const TSharedPtr<FJsonObject> Object,
 	const TArray<TSharedPtr<FJsonValue>>* ExpirationConditionsSave;
 	if(Object->TryGetArrayField("ExpirationConditionsSave", ExpirationConditionsSave))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ExpirationConditionsSave)
+		for (const TSharedPtr<FJsonValue>& Item : *ExpirationConditionsSave)
 		{
 			FFlareQuestConditionSave ChildData;
 			LoadQuestStepProgress(Item->AsObject(), &ChildData);
@@ -188,20 +192,20 @@ void UFlareSaveReaderV1::LoadQuestProgress(const TSharedPtr<FJsonObject> Object,
 	}
 }
 
-void UFlareSaveReaderV1::LoadGeneratedQuest(const TSharedPtr<FJsonObject> Object, FFlareGeneratedQuestSave* Data)
+void UFlareSaveReaderV1::LoadGeneratedQuest(const TSharedPtr<FJsonObject>& Object, FFlareGeneratedQuestSave* Data)
 {
 	LoadFName(Object, "QuestClass", &Data->QuestClass);
 	LoadBundle(Object, "Data", &Data->Data);
 }
 
-void UFlareSaveReaderV1::LoadQuestStepProgress(const TSharedPtr<FJsonObject> Object, FFlareQuestConditionSave* Data)
+void UFlareSaveReaderV1::LoadQuestStepProgress(const TSharedPtr<FJsonObject>& Object, FFlareQuestConditionSave* Data)
 {
 	LoadFName(Object, "ConditionIdentifier", &Data->ConditionIdentifier);
 	LoadBundle(Object, "Data", &Data->Data);
 }
 
 
-void UFlareSaveReaderV1::LoadCompanyDescription(const TSharedPtr<FJsonObject> Object, FFlareCompanyDescription* Data)
+void UFlareSaveReaderV1::LoadCompanyDescription(const TSharedPtr<FJsonObject>& Object, FFlareCompanyDescription* Data)
 {
 	LoadFText(Object, "Name", &Data->Name);
 	LoadFName(Object, "ShortName", &Data->ShortName);
@@ -221,14 +225,14 @@ void UFlareSaveReaderV1::LoadCompanyDescription(const TSharedPtr<FJsonObject> Ob
 }
 
 
-void UFlareSaveReaderV1::LoadWorld(const TSharedPtr<FJsonObject> Object, FFlareWorldSave* Data)
+void UFlareSaveReaderV1::LoadWorld(const TSharedPtr<FJsonObject>& Object, FFlareWorldSave* Data)
 {
 	LoadInt64(Object, "Date", &Data->Date);
 
 	const TArray<TSharedPtr<FJsonValue>>* Companies;
 	if(Object->TryGetArrayField("Companies", Companies))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Companies)
+		for (const TSharedPtr<FJsonValue>& Item : *Companies)
 		{
 			FFlareCompanySave ChildData;
 			LoadCompany(Item->AsObject(), &ChildData);
@@ -239,7 +243,7 @@ void UFlareSaveReaderV1::LoadWorld(const TSharedPtr<FJsonObject> Object, FFlareW
 	const TArray<TSharedPtr<FJsonValue>>* Sectors;
 	if(Object->TryGetArrayField("Sectors", Sectors))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Sectors)
+		for (const TSharedPtr<FJsonValue>& Item : *Sectors)
 		{
 			FFlareSectorSave ChildData;
 			LoadSector(Item->AsObject(), &ChildData);
@@ -250,7 +254,7 @@ void UFlareSaveReaderV1::LoadWorld(const TSharedPtr<FJsonObject> Object, FFlareW
 	const TArray<TSharedPtr<FJsonValue>>* Travels;
 	if(Object->TryGetArrayField("Travels", Travels))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Travels)
+		for (const TSharedPtr<FJsonValue>& Item : *Travels)
 		{
 			FFlareTravelSave ChildData;
 			LoadTravel(Item->AsObject(), &ChildData);
@@ -261,7 +265,7 @@ void UFlareSaveReaderV1::LoadWorld(const TSharedPtr<FJsonObject> Object, FFlareW
 
 
 
-void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlareCompanySave* Data)
+void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject>& Object, FFlareCompanySave* Data)
 {
 	LoadFName(Object, "Identifier", &Data->Identifier);
 	LoadInt32(Object, "CatalogIdentifier", &Data->CatalogIdentifier);
@@ -280,7 +284,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* UnlockedTechnologies;
 	if (Object->TryGetArrayField("UnlockedTechnologies", UnlockedTechnologies))
 	{
-		for (TSharedPtr<FJsonValue> Item : *UnlockedTechnologies)
+		for (const TSharedPtr<FJsonValue>& Item : *UnlockedTechnologies)
 		{
 			Data->UnlockedTechnologies.Add(FName(*Item->AsString()));
 		}
@@ -289,7 +293,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* CaptureOrders;
 	if (Object->TryGetArrayField("CaptureOrders", CaptureOrders))
 	{
-		for (TSharedPtr<FJsonValue> Item : *CaptureOrders)
+		for (const TSharedPtr<FJsonValue>& Item : *CaptureOrders)
 		{
 			Data->CaptureOrders.Add(FName(*Item->AsString()));
 		}
@@ -306,7 +310,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* Ships;
 	if(Object->TryGetArrayField("Ships", Ships))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Ships)
+		for (const TSharedPtr<FJsonValue>& Item : *Ships)
 		{
 			FFlareSpacecraftSave ChildData;
 			LoadSpacecraft(Item->AsObject(), &ChildData);
@@ -317,7 +321,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* ChildStations;
 	if(Object->TryGetArrayField("ChildStations", ChildStations))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ChildStations)
+		for (const TSharedPtr<FJsonValue>& Item : *ChildStations)
 		{
 			FFlareSpacecraftSave ChildData;
 			LoadSpacecraft(Item->AsObject(), &ChildData);
@@ -328,7 +332,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* Stations;
 	if(Object->TryGetArrayField("Stations", Stations))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Stations)
+		for (const TSharedPtr<FJsonValue>& Item : *Stations)
 		{
 			FFlareSpacecraftSave ChildData;
 			LoadSpacecraft(Item->AsObject(), &ChildData);
@@ -339,7 +343,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* DestroyedSpacecrafts;
 	if(Object->TryGetArrayField("DestroyedSpacecrafts", DestroyedSpacecrafts))
 	{
-		for (TSharedPtr<FJsonValue> Item : *DestroyedSpacecrafts)
+		for (const TSharedPtr<FJsonValue>& Item : *DestroyedSpacecrafts)
 		{
 			FFlareSpacecraftSave ChildData;
 			LoadSpacecraft(Item->AsObject(), &ChildData);
@@ -350,7 +354,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* Fleets;
 	if(Object->TryGetArrayField("Fleets", Fleets))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Fleets)
+		for (const TSharedPtr<FJsonValue>& Item : *Fleets)
 		{
 			FFlareFleetSave ChildData;
 			LoadFleet(Item->AsObject(), &ChildData);
@@ -361,7 +365,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* TradeRoutes;
 	if(Object->TryGetArrayField("TradeRoutes", TradeRoutes))
 	{
-		for (TSharedPtr<FJsonValue> Item : *TradeRoutes)
+		for (const TSharedPtr<FJsonValue>& Item : *TradeRoutes)
 		{
 			FFlareTradeRouteSave ChildData;
 			LoadTradeRoute(Item->AsObject(), &ChildData);
@@ -372,7 +376,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* SectorsKnowledge;
 	if(Object->TryGetArrayField("SectorsKnowledge", SectorsKnowledge))
 	{
-		for (TSharedPtr<FJsonValue> Item : *SectorsKnowledge)
+		for (const TSharedPtr<FJsonValue>& Item : *SectorsKnowledge)
 		{
 			FFlareCompanySectorKnowledge ChildData;
 			LoadSectorKnowledge(Item->AsObject(), &ChildData);
@@ -383,7 +387,7 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* TransactionLog;
 	if(Object->TryGetArrayField("TransactionLog", TransactionLog))
 	{
-		for (TSharedPtr<FJsonValue> Item : *TransactionLog)
+		for (const TSharedPtr<FJsonValue>& Item : *TransactionLog)
 		{
 			FFlareTransactionLogEntry ChildData;
 			LoadTransactionLogEntry(Item->AsObject(), &ChildData);
@@ -391,12 +395,23 @@ void UFlareSaveReaderV1::LoadCompany(const TSharedPtr<FJsonObject> Object, FFlar
 		}
 	}
 
+	const TArray<TSharedPtr<FJsonValue>>* TransactionSummaries;
+	if(Object->TryGetArrayField("TransactionSummaries", TransactionSummaries))
+	{
+		for (const TSharedPtr<FJsonValue>& Item : *TransactionSummaries)
+		{
+			FFlareTransactionLogSummary ChildData;
+			LoadTransactionLogSummary(Item->AsObject(), &ChildData);
+			Data->TransactionSummaries.Add(ChildData);
+		}
+	}
+
 	LoadFloat(Object, "PlayerReputation", &Data->PlayerReputation);
 }
 
 
 
-void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FFlareSpacecraftSave* Data)
+void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject>& Object, FFlareSpacecraftSave* Data)
 {
 	Object->TryGetBoolField(TEXT("IsDestroyed"), Data->IsDestroyed);
 	Object->TryGetBoolField(TEXT("IsUnderConstruction"), Data->IsUnderConstruction);
@@ -475,7 +490,7 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 	const TArray<TSharedPtr<FJsonValue>>* Components;
 	if(Object->TryGetArrayField("Components", Components))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Components)
+		for (const TSharedPtr<FJsonValue>& Item : *Components)
 		{
 			FFlareSpacecraftComponentSave ChildData;
 			LoadSpacecraftComponent(Item->AsObject(), &ChildData);
@@ -486,7 +501,7 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 	const TArray<TSharedPtr<FJsonValue>>* ConstructionCargoBay;
 	if(Object->TryGetArrayField("ConstructionCargoBay", ConstructionCargoBay))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ConstructionCargoBay)
+		for (const TSharedPtr<FJsonValue>& Item : *ConstructionCargoBay)
 		{
 			FFlareCargoSave ChildData;
 			LoadCargo(Item->AsObject(), &ChildData);
@@ -497,7 +512,7 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 	const TArray<TSharedPtr<FJsonValue>>* ProductionCargoBay;
 	if(Object->TryGetArrayField("ProductionCargoBay", ProductionCargoBay))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ProductionCargoBay)
+		for (const TSharedPtr<FJsonValue>& Item : *ProductionCargoBay)
 		{
 			FFlareCargoSave ChildData;
 			LoadCargo(Item->AsObject(), &ChildData);
@@ -511,7 +526,7 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 	{
 		TArray<FFlareCargoSave>& targetCargoBay = Data->IsUnderConstruction ? Data->ConstructionCargoBay : Data->ProductionCargoBay;
 
-		for (TSharedPtr<FJsonValue> Item : *Cargo)
+		for (const TSharedPtr<FJsonValue>& Item : *Cargo)
 		{
 			FFlareCargoSave ChildData;
 			LoadCargo(Item->AsObject(), &ChildData);
@@ -525,7 +540,7 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 	{
 		TArray<FFlareCargoSave>& targetCargoBay = Data->IsUnderConstruction ? Data->ProductionCargoBay : Data->ConstructionCargoBay;
 
-		for (TSharedPtr<FJsonValue> Item : *CargoBackup)
+		for (const TSharedPtr<FJsonValue>& Item : *CargoBackup)
 		{
 			FFlareCargoSave ChildData;
 			LoadCargo(Item->AsObject(), &ChildData);
@@ -536,7 +551,7 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 	const TArray<TSharedPtr<FJsonValue>>* FactoryStates;
 	if(Object->TryGetArrayField("FactoryStates", FactoryStates))
 	{
-		for (TSharedPtr<FJsonValue> Item : *FactoryStates)
+		for (const TSharedPtr<FJsonValue>& Item : *FactoryStates)
 		{
 			FFlareFactorySave ChildData;
 			LoadFactory(Item->AsObject(), &ChildData, Data);
@@ -547,7 +562,7 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 	const TArray<TSharedPtr<FJsonValue>>* ShipyardOrderQueue;
 	if(Object->TryGetArrayField("ShipyardOrderQueue", ShipyardOrderQueue))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ShipyardOrderQueue)
+		for (const TSharedPtr<FJsonValue>& Item : *ShipyardOrderQueue)
 		{
 			FFlareShipyardOrderSave ChildData;
 			LoadShipyardOrder(Item->AsObject(), &ChildData);
@@ -558,7 +573,7 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 	const TArray<TSharedPtr<FJsonValue>>* ConnectedStations;
 	if (Object->TryGetArrayField("ConnectedStations", ConnectedStations))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ConnectedStations)
+		for (const TSharedPtr<FJsonValue>& Item : *ConnectedStations)
 		{
 			FFlareConnectionSave ChildData;
 			LoadStationConnection(Item->AsObject(), &ChildData);
@@ -572,7 +587,7 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 	const TArray<TSharedPtr<FJsonValue>>* CapturePoints;
 	if(Object->TryGetArrayField("CapturePoints", CapturePoints))
 	{
-		for (TSharedPtr<FJsonValue> Item : *CapturePoints)
+		for (const TSharedPtr<FJsonValue>& Item : *CapturePoints)
 		{
 			// Object with 2 field, the company name, and the point count
 			const TSharedPtr<FJsonObject> ChildObject = Item->AsObject();
@@ -588,14 +603,14 @@ void UFlareSaveReaderV1::LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FF
 }
 
 
-void UFlareSaveReaderV1::LoadPilot(const TSharedPtr<FJsonObject> Object, FFlareShipPilotSave* Data)
+void UFlareSaveReaderV1::LoadPilot(const TSharedPtr<FJsonObject>& Object, FFlareShipPilotSave* Data)
 {
 	LoadFName(Object, "Identifier", &Data->Identifier);
 	Object->TryGetStringField(TEXT("Name"), Data->Name);
 }
 
 
-void UFlareSaveReaderV1::LoadAsteroid(const TSharedPtr<FJsonObject> Object, FFlareAsteroidSave* Data)
+void UFlareSaveReaderV1::LoadAsteroid(const TSharedPtr<FJsonObject>& Object, FFlareAsteroidSave* Data)
 {
 	LoadFName(Object, "Identifier", &Data->Identifier);
 	LoadVector(Object, "Location", &Data->Location);
@@ -608,7 +623,7 @@ void UFlareSaveReaderV1::LoadAsteroid(const TSharedPtr<FJsonObject> Object, FFla
 }
 
 
-void UFlareSaveReaderV1::LoadMeteorite(const TSharedPtr<FJsonObject> Object, FFlareMeteoriteSave* Data)
+void UFlareSaveReaderV1::LoadMeteorite(const TSharedPtr<FJsonObject>& Object, FFlareMeteoriteSave* Data)
 {
 	//LoadFName(Object, "Identifier", &Data->Identifier);
 	LoadVector(Object, "Location", &Data->Location);
@@ -639,7 +654,7 @@ void UFlareSaveReaderV1::LoadMeteorite(const TSharedPtr<FJsonObject> Object, FFl
 }
 
 
-void UFlareSaveReaderV1::LoadSpacecraftComponent(const TSharedPtr<FJsonObject> Object, FFlareSpacecraftComponentSave* Data)
+void UFlareSaveReaderV1::LoadSpacecraftComponent(const TSharedPtr<FJsonObject>& Object, FFlareSpacecraftComponentSave* Data)
 {
 	LoadFName(Object, "ComponentIdentifier", &Data->ComponentIdentifier);
 
@@ -666,33 +681,33 @@ void UFlareSaveReaderV1::LoadSpacecraftComponent(const TSharedPtr<FJsonObject> O
 }
 
 
-void UFlareSaveReaderV1::LoadStationConnection(const TSharedPtr<FJsonObject> Object, FFlareConnectionSave* Data)
+void UFlareSaveReaderV1::LoadStationConnection(const TSharedPtr<FJsonObject>& Object, FFlareConnectionSave* Data)
 {
 	LoadFName(Object, "ConnectorName", &Data->ConnectorName);
 	LoadFName(Object, "StationIdentifier", &Data->StationIdentifier);
 }
 
-void UFlareSaveReaderV1::LoadSpacecraftComponentTurret(const TSharedPtr<FJsonObject> Object, FFlareSpacecraftComponentTurretSave* Data)
+void UFlareSaveReaderV1::LoadSpacecraftComponentTurret(const TSharedPtr<FJsonObject>& Object, FFlareSpacecraftComponentTurretSave* Data)
 {
 	LoadFloat(Object, "TurretAngle", &Data->TurretAngle);
 	LoadFloat(Object, "BarrelsAngle", &Data->BarrelsAngle);
 }
 
 
-void UFlareSaveReaderV1::LoadSpacecraftComponentWeapon(const TSharedPtr<FJsonObject> Object, FFlareSpacecraftComponentWeaponSave* Data)
+void UFlareSaveReaderV1::LoadSpacecraftComponentWeapon(const TSharedPtr<FJsonObject>& Object, FFlareSpacecraftComponentWeaponSave* Data)
 {
 	LoadInt32(Object, "FiredAmmo", &Data->FiredAmmo);
 }
 
 
-void UFlareSaveReaderV1::LoadTurretPilot(const TSharedPtr<FJsonObject> Object, FFlareTurretPilotSave* Data)
+void UFlareSaveReaderV1::LoadTurretPilot(const TSharedPtr<FJsonObject>& Object, FFlareTurretPilotSave* Data)
 {
 	LoadFName(Object, "Identifier", &Data->Identifier);
 	Object->TryGetStringField(TEXT("Name"), Data->Name);
 }
 
 
-void UFlareSaveReaderV1::LoadTradeOperation(const TSharedPtr<FJsonObject> Object, FFlareTradeRouteSectorOperationSave* Data)
+void UFlareSaveReaderV1::LoadTradeOperation(const TSharedPtr<FJsonObject>& Object, FFlareTradeRouteSectorOperationSave* Data)
 {
 	LoadFName(Object, "ResourceIdentifier", &Data->ResourceIdentifier);
 	LoadInt32(Object, "MaxQuantity", (int32*) &Data->MaxQuantity);
@@ -703,7 +718,7 @@ void UFlareSaveReaderV1::LoadTradeOperation(const TSharedPtr<FJsonObject> Object
 	Object->TryGetBoolField(TEXT("CanTradeWithStorages"), Data->CanTradeWithStorages);
 }
 
-void UFlareSaveReaderV1::LoadCargo(const TSharedPtr<FJsonObject> Object, FFlareCargoSave* Data)
+void UFlareSaveReaderV1::LoadCargo(const TSharedPtr<FJsonObject>& Object, FFlareCargoSave* Data)
 {
 	LoadFName(Object, "ResourceIdentifier", &Data->ResourceIdentifier);
 	LoadInt32(Object, "Quantity", (int32*) &Data->Quantity); // TODO clean after conversion
@@ -711,14 +726,14 @@ void UFlareSaveReaderV1::LoadCargo(const TSharedPtr<FJsonObject> Object, FFlareC
 	Data->Restriction = LoadEnum<EFlareResourceRestriction::Type>(Object, "Restriction", "EFlareResourceRestriction");
 }
 
-void UFlareSaveReaderV1::LoadShipyardOrder(const TSharedPtr<FJsonObject> Object, FFlareShipyardOrderSave* Data)
+void UFlareSaveReaderV1::LoadShipyardOrder(const TSharedPtr<FJsonObject>& Object, FFlareShipyardOrderSave* Data)
 {
 	LoadFName(Object, "ShipClass", &Data->ShipClass);
 	LoadFName(Object, "Company", &Data->Company);
 	LoadInt32(Object, "AdvancePayment", &Data->AdvancePayment);
 }
 
-void UFlareSaveReaderV1::LoadFactory(const TSharedPtr<FJsonObject> Object, FFlareFactorySave* Data, FFlareSpacecraftSave* SpacecraftData)
+void UFlareSaveReaderV1::LoadFactory(const TSharedPtr<FJsonObject>& Object, FFlareFactorySave* Data, FFlareSpacecraftSave* SpacecraftData)
 {
 	Object->TryGetBoolField(TEXT("Active"), Data->Active);
 	LoadInt32(Object, "CostReserved", (int32*) &Data->CostReserved); // TODO clean after conversion
@@ -745,7 +760,7 @@ void UFlareSaveReaderV1::LoadFactory(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* ResourceReserved;
 	if(Object->TryGetArrayField("ResourceReserved", ResourceReserved))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ResourceReserved)
+		for (const TSharedPtr<FJsonValue>& Item : *ResourceReserved)
 		{
 			FFlareCargoSave ChildData;
 			LoadCargo(Item->AsObject(), &ChildData);
@@ -756,7 +771,7 @@ void UFlareSaveReaderV1::LoadFactory(const TSharedPtr<FJsonObject> Object, FFlar
 	const TArray<TSharedPtr<FJsonValue>>* OutputCargoLimit;
 	if(Object->TryGetArrayField("OutputCargoLimit", OutputCargoLimit))
 	{
-		for (TSharedPtr<FJsonValue> Item : *OutputCargoLimit)
+		for (const TSharedPtr<FJsonValue>& Item : *OutputCargoLimit)
 		{
 			FFlareCargoSave ChildData;
 			LoadCargo(Item->AsObject(), &ChildData);
@@ -767,7 +782,7 @@ void UFlareSaveReaderV1::LoadFactory(const TSharedPtr<FJsonObject> Object, FFlar
 
 
 
-void UFlareSaveReaderV1::LoadFleet(const TSharedPtr<FJsonObject> Object, FFlareFleetSave* Data)
+void UFlareSaveReaderV1::LoadFleet(const TSharedPtr<FJsonObject>& Object, FFlareFleetSave* Data)
 {
 	LoadFText(Object, "Name", &Data->Name);
 	LoadFName(Object, "Identifier", &Data->Identifier);
@@ -797,7 +812,7 @@ void UFlareSaveReaderV1::LoadFleet(const TSharedPtr<FJsonObject> Object, FFlareF
 }
 
 
-void UFlareSaveReaderV1::LoadTradeRoute(const TSharedPtr<FJsonObject> Object, FFlareTradeRouteSave* Data)
+void UFlareSaveReaderV1::LoadTradeRoute(const TSharedPtr<FJsonObject>& Object, FFlareTradeRouteSave* Data)
 {
 	LoadFText(Object, "Name", &Data->Name);
 	LoadFName(Object, "Identifier", &Data->Identifier);
@@ -834,7 +849,7 @@ void UFlareSaveReaderV1::LoadTradeRoute(const TSharedPtr<FJsonObject> Object, FF
 	const TArray<TSharedPtr<FJsonValue>>* Sectors;
 	if(Object->TryGetArrayField("Sectors", Sectors))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Sectors)
+		for (const TSharedPtr<FJsonValue>& Item : *Sectors)
 		{
 			FFlareTradeRouteSectorSave ChildData;
 			LoadTradeRouteSector(Item->AsObject(), &ChildData);
@@ -844,7 +859,7 @@ void UFlareSaveReaderV1::LoadTradeRoute(const TSharedPtr<FJsonObject> Object, FF
 }
 
 
-void UFlareSaveReaderV1::LoadTradeRouteSector(const TSharedPtr<FJsonObject> Object, FFlareTradeRouteSectorSave* Data)
+void UFlareSaveReaderV1::LoadTradeRouteSector(const TSharedPtr<FJsonObject>& Object, FFlareTradeRouteSectorSave* Data)
 {
 
 	LoadFName(Object, "SectorIdentifier", &Data->SectorIdentifier);
@@ -854,7 +869,7 @@ void UFlareSaveReaderV1::LoadTradeRouteSector(const TSharedPtr<FJsonObject> Obje
 	const TArray<TSharedPtr<FJsonValue>>* ResourcesToUnload;
 	if(Object->TryGetArrayField("ResourcesToUnload", ResourcesToUnload))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ResourcesToUnload)
+		for (const TSharedPtr<FJsonValue>& Item : *ResourcesToUnload)
 		{
 			FFlareCargoSave ChildData;
 			LoadCargo(Item->AsObject(), &ChildData);
@@ -873,7 +888,7 @@ void UFlareSaveReaderV1::LoadTradeRouteSector(const TSharedPtr<FJsonObject> Obje
 	const TArray<TSharedPtr<FJsonValue>>* ResourcesToLoad;
 	if(Object->TryGetArrayField("ResourcesToLoad", ResourcesToLoad))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ResourcesToLoad)
+		for (const TSharedPtr<FJsonValue>& Item : *ResourcesToLoad)
 		{
 			FFlareCargoSave ChildData;
 			LoadCargo(Item->AsObject(), &ChildData);
@@ -891,7 +906,7 @@ void UFlareSaveReaderV1::LoadTradeRouteSector(const TSharedPtr<FJsonObject> Obje
 	const TArray<TSharedPtr<FJsonValue>>* Operations;
 	if(Object->TryGetArrayField("Operations", Operations))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Operations)
+		for (const TSharedPtr<FJsonValue>& Item : *Operations)
 		{
 			FFlareTradeRouteSectorOperationSave ChildData;
 			LoadTradeOperation(Item->AsObject(), &ChildData);
@@ -902,13 +917,13 @@ void UFlareSaveReaderV1::LoadTradeRouteSector(const TSharedPtr<FJsonObject> Obje
 }
 
 
-void UFlareSaveReaderV1::LoadSectorKnowledge(const TSharedPtr<FJsonObject> Object, FFlareCompanySectorKnowledge* Data)
+void UFlareSaveReaderV1::LoadSectorKnowledge(const TSharedPtr<FJsonObject>& Object, FFlareCompanySectorKnowledge* Data)
 {
 	LoadFName(Object, "SectorIdentifier", &Data->SectorIdentifier);
 	Data->Knowledge = LoadEnum<EFlareSectorKnowledge::Type>(Object, "Knowledge", "EFlareSectorKnowledge");
 }
 
-void UFlareSaveReaderV1::LoadTransactionLogEntry(const TSharedPtr<FJsonObject> Object, FFlareTransactionLogEntry* Data)
+void UFlareSaveReaderV1::LoadTransactionLogEntry(const TSharedPtr<FJsonObject>& Object, FFlareTransactionLogEntry* Data)
 {
 	LoadInt64(Object, "Date", &Data->Date);
 	LoadInt64(Object, "Amount", &Data->Amount);
@@ -923,9 +938,27 @@ void UFlareSaveReaderV1::LoadTransactionLogEntry(const TSharedPtr<FJsonObject> O
 	LoadFName(Object, "ExtraIdentifier2", &Data->ExtraIdentifier2);
 }
 
+void UFlareSaveReaderV1::LoadTransactionLogSummary(const TSharedPtr<FJsonObject>& Object, FFlareTransactionLogSummary* Data)
+{
+	LoadInt64(Object, "Year", &Data->Year);
+
+	// Amounts are stored as a single comma-separated block, indexed by transaction type
+	Data->Amounts.SetNumZeroed(EFlareTransactionLogEntry::TYPE_COUNT);
+	FString AmountsString;
+	if (Object->TryGetStringField("Amounts", AmountsString))
+	{
+		TArray<FString> Values;
+		AmountsString.ParseIntoArray(Values, TEXT(","), false);
+		for (int32 Type = 0; Type < Values.Num() && Type < Data->Amounts.Num(); Type++)
+		{
+			Data->Amounts[Type] = FCString::Atoi64(*Values[Type]);
+		}
+	}
+}
+
 
 
-void UFlareSaveReaderV1::LoadCompanyAI(const TSharedPtr<FJsonObject> Object, FFlareCompanyAISave* Data)
+void UFlareSaveReaderV1::LoadCompanyAI(const TSharedPtr<FJsonObject>& Object, FFlareCompanyAISave* Data)
 {
 	LoadInt64(Object, "BudgetMilitary", &Data->BudgetMilitary);
 	LoadInt64(Object, "BudgetStation", &Data->BudgetStation);
@@ -939,7 +972,7 @@ void UFlareSaveReaderV1::LoadCompanyAI(const TSharedPtr<FJsonObject> Object, FFl
 }
 
 
-void UFlareSaveReaderV1::LoadCompanyReputation(const TSharedPtr<FJsonObject> Object, FFlareCompanyReputationSave* Data)
+void UFlareSaveReaderV1::LoadCompanyReputation(const TSharedPtr<FJsonObject>& Object, FFlareCompanyReputationSave* Data)
 {
 	LoadFName(Object, "CompanyIdentifier", &Data->CompanyIdentifier);
 	LoadFloat(Object, "Reputation", &Data->Reputation);
@@ -948,7 +981,7 @@ void UFlareSaveReaderV1::LoadCompanyReputation(const TSharedPtr<FJsonObject> Obj
 
 
 
-void UFlareSaveReaderV1::LoadSector(const TSharedPtr<FJsonObject> Object, FFlareSectorSave* Data)
+void UFlareSaveReaderV1::LoadSector(const TSharedPtr<FJsonObject>& Object, FFlareSectorSave* Data)
 {
 	LoadFText(Object, "GivenName", &Data->GivenName);
 	LoadFName(Object, "Identifier", &Data->Identifier);
@@ -963,7 +996,7 @@ void UFlareSaveReaderV1::LoadSector(const TSharedPtr<FJsonObject> Object, FFlare
 	const TArray<TSharedPtr<FJsonValue>>* Bombs;
 	if(Object->TryGetArrayField("Bombs", Bombs))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Bombs)
+		for (const TSharedPtr<FJsonValue>& Item : *Bombs)
 		{
 			FFlareBombSave ChildData;
 			LoadBomb(Item->AsObject(), &ChildData);
@@ -974,7 +1007,7 @@ void UFlareSaveReaderV1::LoadSector(const TSharedPtr<FJsonObject> Object, FFlare
 	const TArray<TSharedPtr<FJsonValue>>* Asteroids;
 	if(Object->TryGetArrayField("Asteroids", Asteroids))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Asteroids)
+		for (const TSharedPtr<FJsonValue>& Item : *Asteroids)
 		{
 			FFlareAsteroidSave ChildData;
 			LoadAsteroid(Item->AsObject(), &ChildData);
@@ -985,7 +1018,7 @@ void UFlareSaveReaderV1::LoadSector(const TSharedPtr<FJsonObject> Object, FFlare
 	const TArray<TSharedPtr<FJsonValue>>* Meteorites;
 	if(Object->TryGetArrayField("Meteorites", Meteorites))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Meteorites)
+		for (const TSharedPtr<FJsonValue>& Item : *Meteorites)
 		{
 			FFlareMeteoriteSave ChildData;
 			LoadMeteorite(Item->AsObject(), &ChildData);
@@ -999,7 +1032,7 @@ void UFlareSaveReaderV1::LoadSector(const TSharedPtr<FJsonObject> Object, FFlare
 	const TArray<TSharedPtr<FJsonValue>>* ResourcePrices;
 	if(Object->TryGetArrayField("ResourcePrices", ResourcePrices))
 	{
-		for (TSharedPtr<FJsonValue> Item : *ResourcePrices)
+		for (const TSharedPtr<FJsonValue>& Item : *ResourcePrices)
 		{
 			FFFlareResourcePrice ChildData;
 			LoadResourcePrice(Item->AsObject(), &ChildData);
@@ -1017,7 +1050,7 @@ void UFlareSaveReaderV1::LoadSector(const TSharedPtr<FJsonObject> Object, FFlare
 }
 
 
-void UFlareSaveReaderV1::LoadPeople(const TSharedPtr<FJsonObject> Object, FFlarePeopleSave* Data)
+void UFlareSaveReaderV1::LoadPeople(const TSharedPtr<FJsonObject>& Object, FFlarePeopleSave* Data)
 {
 	LoadInt32(Object, "Population", (int32*) &Data->Population); // TODO clean after conversion
 	LoadInt32(Object, "FoodStock", (int32*) &Data->FoodStock);
@@ -1038,7 +1071,7 @@ void UFlareSaveReaderV1::LoadPeople(const TSharedPtr<FJsonObject> Object, FFlare
 	const TArray<TSharedPtr<FJsonValue>>* CompanyReputations;
 	if(Object->TryGetArrayField("CompanyReputations", CompanyReputations))
 	{
-		for (TSharedPtr<FJsonValue> Item : *CompanyReputations)
+		for (const TSharedPtr<FJsonValue>& Item : *CompanyReputations)
 		{
 			FFlareCompanyReputationSave ChildData;
 			LoadCompanyReputation(Item->AsObject(), &ChildData);
@@ -1048,7 +1081,7 @@ void UFlareSaveReaderV1::LoadPeople(const TSharedPtr<FJsonObject> Object, FFlare
 }
 
 
-void UFlareSaveReaderV1::LoadBomb(const TSharedPtr<FJsonObject> Object, FFlareBombSave* Data)
+void UFlareSaveReaderV1::LoadBomb(const TSharedPtr<FJsonObject>& Object, FFlareBombSave* Data)
 {
 	LoadFName(Object, "Identifier", &Data->Identifier);
 	LoadVector(Object, "Location", &Data->Location);
@@ -1068,7 +1101,7 @@ void UFlareSaveReaderV1::LoadBomb(const TSharedPtr<FJsonObject> Object, FFlareBo
 }
 
 
-void UFlareSaveReaderV1::LoadResourcePrice(const TSharedPtr<FJsonObject> Object, FFFlareResourcePrice* Data)
+void UFlareSaveReaderV1::LoadResourcePrice(const TSharedPtr<FJsonObject>& Object, FFFlareResourcePrice* Data)
 {
 	LoadFName(Object, "ResourceIdentifier", &Data->ResourceIdentifier);
 	LoadFloat(Object, "Price", &Data->Price);
@@ -1076,7 +1109,7 @@ void UFlareSaveReaderV1::LoadResourcePrice(const TSharedPtr<FJsonObject> Object,
 }
 
 
-void UFlareSaveReaderV1::LoadTravel(const TSharedPtr<FJsonObject> Object, FFlareTravelSave* Data)
+void UFlareSaveReaderV1::LoadTravel(const TSharedPtr<FJsonObject>& Object, FFlareTravelSave* Data)
 {
 	LoadFName(Object, "FleetIdentifier", &Data->FleetIdentifier);
 	LoadFName(Object, "OriginSectorIdentifier", &Data->OriginSectorIdentifier);
@@ -1105,7 +1138,7 @@ static bool ParseInt32(const FString& DataString, int32* Data)
 	return true;
 }
 
-void UFlareSaveReaderV1::LoadInt32(TSharedPtr< FJsonObject > Object, FString Key, int32* Data, int32 DefaultValue)
+void UFlareSaveReaderV1::LoadInt32(const TSharedPtr< FJsonObject >& Object, const FString& Key, int32* Data, int32 DefaultValue)
 {
 	FString DataString;
 	if(Object->TryGetStringField(Key, DataString))
@@ -1119,7 +1152,7 @@ void UFlareSaveReaderV1::LoadInt32(TSharedPtr< FJsonObject > Object, FString Key
 	}
 }
 
-void UFlareSaveReaderV1::LoadInt64(TSharedPtr< FJsonObject > Object, FString Key, int64* Data)
+void UFlareSaveReaderV1::LoadInt64(const TSharedPtr< FJsonObject >& Object, const FString& Key, int64* Data)
 {
 	FString DataString;
 	if(Object->TryGetStringField(Key, DataString))
@@ -1134,7 +1167,7 @@ void UFlareSaveReaderV1::LoadInt64(TSharedPtr< FJsonObject > Object, FString Key
 }
 
 
-void UFlareSaveReaderV1::LoadFloat(TSharedPtr< FJsonObject > Object, FString Key, float* Data)
+void UFlareSaveReaderV1::LoadFloat(const TSharedPtr< FJsonObject >& Object, const FString& Key, float* Data)
 {
 	double DataDouble;
 	if(Object->TryGetNumberField(Key, DataDouble))
@@ -1148,7 +1181,7 @@ void UFlareSaveReaderV1::LoadFloat(TSharedPtr< FJsonObject > Object, FString Key
 	}
 }
 
-void UFlareSaveReaderV1::LoadFName(TSharedPtr< FJsonObject > Object, FString Key, FName* Data)
+void UFlareSaveReaderV1::LoadFName(const TSharedPtr< FJsonObject >& Object, const FString& Key, FName* Data)
 {
 	FString DataString;
 	if(Object->TryGetStringField(Key, DataString))
@@ -1162,7 +1195,7 @@ void UFlareSaveReaderV1::LoadFName(TSharedPtr< FJsonObject > Object, FString Key
 	}
 }
 
-void UFlareSaveReaderV1::LoadFText(TSharedPtr< FJsonObject > Object, FString Key, FText* Data)
+void UFlareSaveReaderV1::LoadFText(const TSharedPtr< FJsonObject >& Object, const FString& Key, FText* Data)
 {
 	FString DataString;
 	if(Object->TryGetStringField(Key, DataString))
@@ -1175,24 +1208,26 @@ void UFlareSaveReaderV1::LoadFText(TSharedPtr< FJsonObject > Object, FString Key
 	}
 }
 
-void UFlareSaveReaderV1::LoadFNameArray(TSharedPtr< FJsonObject > Object, FString Key, TArray<FName>* Data)
+void UFlareSaveReaderV1::LoadFNameArray(const TSharedPtr< FJsonObject >& Object, const FString& Key, TArray<FName>* Data)
 {
 	const TArray<TSharedPtr<FJsonValue>>* Array;
 	if(Object->TryGetArrayField(Key, Array))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Array)
+		Data->Reserve(Data->Num() + Array->Num());
+		for (const TSharedPtr<FJsonValue>& Item : *Array)
 		{
 			(*Data).Add(FName(*Item->AsString()));
 		}
 	}
 }
 
-void UFlareSaveReaderV1::LoadFloatArray(TSharedPtr< FJsonObject > Object, FString Key, TArray<float>* Data)
+void UFlareSaveReaderV1::LoadFloatArray(const TSharedPtr< FJsonObject >& Object, const FString& Key, TArray<float>* Data)
 {
 	const TArray<TSharedPtr<FJsonValue>>* Array;
 	if(Object->TryGetArrayField(Key, Array))
 	{
-		for (TSharedPtr<FJsonValue> Item : *Array)
+		Data->Reserve(Data->Num() + Array->Num());
+		for (const TSharedPtr<FJsonValue>& Item : *Array)
 		{
 			float Value = Item->AsNumber();
 			Data->Add(Value);
@@ -1200,25 +1235,44 @@ void UFlareSaveReaderV1::LoadFloatArray(TSharedPtr< FJsonObject > Object, FStrin
 	}
 }
 
+/** Parse exactly Count comma-separated floats from String without allocating, skipping empty entries */
+static bool ParseFloatList(const FString& DataString, float* Values, int32 Count)
+{
+	const TCHAR* Cursor = *DataString;
+	int32 ValueCount = 0;
+
+	while (*Cursor)
+	{
+		const TCHAR* Separator = FCString::Strchr(Cursor, TEXT(','));
+
+		if (Separator != Cursor)
+		{
+			if (ValueCount >= Count)
+			{
+				return false;
+			}
+			Values[ValueCount++] = FCString::Atof(Cursor);
+		}
+
+		if (!Separator)
+		{
+			break;
+		}
+		Cursor = Separator + 1;
+	}
+
+	return ValueCount == Count;
+}
+
 static bool ParseTransform(const FString& DataString, FTransform* Data)
 {
-	TArray<FString> Values;
-	if (DataString.ParseIntoArray(Values, TEXT(",")) == 10)
+	float Values[10];
+	if (ParseFloatList(DataString, Values, 10))
 	{
 		*Data = FTransform(
-					FQuat(
-				FCString::Atof(*Values[0]),
-				FCString::Atof(*Values[1]),
-				FCString::Atof(*Values[2]),
-				FCString::Atof(*Values[3])),
-					FVector(
-				FCString::Atof(*Values[4]),
-				FCString::Atof(*Values[5]),
-				FCString::Atof(*Values[6])),
-					FVector(
-				FCString::Atof(*Values[7]),
-				FCString::Atof(*Values[8]),
-				FCString::Atof(*Values[9])));
+					FQuat(Values[0], Values[1], Values[2], Values[3]),
+					FVector(Values[4], Values[5], Values[6]),
+					FVector(Values[7], Values[8], Values[9]));
 		return true;
 	}
 	else
@@ -1227,7 +1281,7 @@ static bool ParseTransform(const FString& DataString, FTransform* Data)
 	}
 }
 
-void UFlareSaveReaderV1::LoadTransform(TSharedPtr< FJsonObject > Object, FString Key, FTransform* Data)
+void UFlareSaveReaderV1::LoadTransform(const TSharedPtr< FJsonObject >& Object, const FString& Key, FTransform* Data)
 {
 	FString DataString;
 	if(Object->TryGetStringField(Key, DataString))
@@ -1245,13 +1299,10 @@ void UFlareSaveReaderV1::LoadTransform(TSharedPtr< FJsonObject > Object, FString
 
 static bool ParseVector(const FString& DataString, FVector* Data)
 {
-	TArray<FString> Values;
-	if (DataString.ParseIntoArray(Values, TEXT(",")) == 3)
+	float Values[3];
+	if (ParseFloatList(DataString, Values, 3))
 	{
-		*Data = FVector(
-				FCString::Atof(*Values[0]),
-				FCString::Atof(*Values[1]),
-				FCString::Atof(*Values[2]));
+		*Data = FVector(Values[0], Values[1], Values[2]);
 		return true;
 	}
 	else
@@ -1261,7 +1312,7 @@ static bool ParseVector(const FString& DataString, FVector* Data)
 }
 
 
-bool UFlareSaveReaderV1::LoadVector(TSharedPtr< FJsonObject > Object, FString Key, FVector* Data)
+bool UFlareSaveReaderV1::LoadVector(const TSharedPtr< FJsonObject >& Object, const FString& Key, FVector* Data)
 {
 	FString DataString;
 	if(Object->TryGetStringField(Key, DataString))
@@ -1281,18 +1332,15 @@ bool UFlareSaveReaderV1::LoadVector(TSharedPtr< FJsonObject > Object, FString Ke
 	return true;
 }
 
-void UFlareSaveReaderV1::LoadRotator(TSharedPtr< FJsonObject > Object, FString Key, FRotator* Data)
+void UFlareSaveReaderV1::LoadRotator(const TSharedPtr< FJsonObject >& Object, const FString& Key, FRotator* Data)
 {
 	FString DataString;
 	if(Object->TryGetStringField(Key, DataString))
 	{
-		TArray<FString> Values;
-		if (DataString.ParseIntoArray(Values, TEXT(",")) == 3)
+		float Values[3];
+		if (ParseFloatList(DataString, Values, 3))
 		{
-			*Data = FRotator(
-					FCString::Atof(*Values[0]),
-					FCString::Atof(*Values[1]),
-					FCString::Atof(*Values[2]));
+			*Data = FRotator(Values[0], Values[1], Values[2]);
 		}
 		else
 		{
@@ -1305,7 +1353,7 @@ void UFlareSaveReaderV1::LoadRotator(TSharedPtr< FJsonObject > Object, FString K
 	}
 }
 
-void UFlareSaveReaderV1::LoadFloatBuffer(TSharedPtr< FJsonObject > Object, FString Key, FFlareFloatBuffer* Data)
+void UFlareSaveReaderV1::LoadFloatBuffer(const TSharedPtr< FJsonObject >& Object, const FString& Key, FFlareFloatBuffer* Data)
 {
 	const TSharedPtr< FJsonObject >* FloatBuffer;
 	if(Object->TryGetObjectField(Key, FloatBuffer))
@@ -1323,7 +1371,7 @@ void UFlareSaveReaderV1::LoadFloatBuffer(TSharedPtr< FJsonObject > Object, FStri
 }
 
 
-void UFlareSaveReaderV1::LoadBundle(const TSharedPtr<FJsonObject> Object, FString Key, FFlareBundle* Data)
+void UFlareSaveReaderV1::LoadBundle(const TSharedPtr<FJsonObject>& Object, const FString& Key, FFlareBundle* Data)
 {
 	Data->Clear();
 	const TSharedPtr< FJsonObject >* Bundle;
@@ -1376,7 +1424,7 @@ void UFlareSaveReaderV1::LoadBundle(const TSharedPtr<FJsonObject> Object, FStrin
 				const TArray< TSharedPtr<FJsonValue> >& Array = Pair.Value->AsArray();
 				TArray<FVector>	VectorArray;
 
-				for (TSharedPtr<FJsonValue> Item : Array)
+				for (const TSharedPtr<FJsonValue>& Item : Array)
 				{
 					FVector Vector;
 					if(ParseVector(Item->AsString(), &Vector))
@@ -1412,7 +1460,7 @@ void UFlareSaveReaderV1::LoadBundle(const TSharedPtr<FJsonObject> Object, FStrin
 				const TArray< TSharedPtr<FJsonValue> >& Array = Pair.Value->AsArray();
 				TArray<FName>	NameArray;
 
-				for (TSharedPtr<FJsonValue> Item : Array)
+				for (const TSharedPtr<FJsonValue>& Item : Array)
 				{
 					FName NameValue = FName(*Item->AsString());
 					NameArray.Add(NameValue);
@@ -1433,7 +1481,14 @@ void UFlareSaveReaderV1::LoadBundle(const TSharedPtr<FJsonObject> Object, FStrin
 			}
 		}
 
-		LoadFNameArray(*Bundle, "Tags", &Data->Tags);
+		const TArray<TSharedPtr<FJsonValue>>* Tags;
+		if ((*Bundle)->TryGetArrayField("Tags", Tags))
+		{
+			for (const TSharedPtr<FJsonValue>& Item : *Tags)
+			{
+				Data->PutTag(FName(*Item->AsString()));
+			}
+		}
 	}
 	else
 	{
@@ -1447,3 +1502,2376 @@ LoadTransform(Object, "InitialTransform", &Data->InitialTransform);
 LoadFloat(Object, "InitialVelocity", &Data->InitialVelocity);*/
 
 }
+
+
+/*----------------------------------------------------
+	Streaming
+----------------------------------------------------*/
+
+/** Skip the value starting with the current token */
+static bool SkipValue(const FFlareSaveStream& Reader, EJsonNotation Notation)
+{
+	int32 Depth = (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart) ? 1 : 0;
+
+	while (Depth > 0 && Reader->ReadNext(Notation))
+	{
+		if (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart)
+		{
+			Depth++;
+		}
+		else if (Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd)
+		{
+			Depth--;
+		}
+	}
+
+	return (Depth == 0);
+}
+
+/** Read the fields of an object with StreamField, which must consume each value. The reader is after the opening brace. */
+template<typename FieldType>
+static bool StreamObject(const FFlareSaveStream& Reader, FieldType StreamField)
+{
+	EJsonNotation Notation = EJsonNotation::Error;
+	while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+	{
+		if (!StreamField(Reader->GetIdentifier(), Notation))
+		{
+			return false;
+		}
+	}
+
+	return (Notation == EJsonNotation::ObjectEnd);
+}
+
+/** Read the items of an array with StreamItem, which must consume each value. Other values are skipped. */
+template<typename ItemType>
+static bool StreamArray(const FFlareSaveStream& Reader, EJsonNotation Notation, ItemType StreamItem)
+{
+	if (Notation != EJsonNotation::ArrayStart)
+	{
+		return SkipValue(Reader, Notation);
+	}
+
+	while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ArrayEnd)
+	{
+		if (!StreamItem(Notation))
+		{
+			return false;
+		}
+	}
+
+	return (Notation == EJsonNotation::ArrayEnd);
+}
+
+/** Read an object used as a map, StreamValue gets each key and must consume each value */
+template<typename ValueType>
+static bool StreamMap(const FFlareSaveStream& Reader, EJsonNotation Notation, ValueType StreamValue)
+{
+	if (Notation != EJsonNotation::ObjectStart)
+	{
+		return SkipValue(Reader, Notation);
+	}
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation ValueNotation)
+	{
+		return StreamValue(FName(*Key), ValueNotation);
+	});
+}
+
+static bool StreamInt32(const FFlareSaveStream& Reader, EJsonNotation Notation, int32* Data)
+{
+	// Integers are saved as strings by FormatInt32, parse them from the token buffer
+	if (Notation == EJsonNotation::String)
+	{
+		*Data = FCString::Atoi(*Reader->GetValueAsString());
+		return true;
+	}
+	else if (Notation == EJsonNotation::Number)
+	{
+		*Data = (int32) Reader->GetValueAsNumber();
+		return true;
+	}
+
+	FLOGV("WARNING: Fail to load int32 key '%s'. Save corrupted", *Reader->GetIdentifier());
+	return SkipValue(Reader, Notation);
+}
+
+static bool StreamInt64(const FFlareSaveStream& Reader, EJsonNotation Notation, int64* Data)
+{
+	if (Notation == EJsonNotation::String)
+	{
+		*Data = FCString::Atoi64(*Reader->GetValueAsString());
+		return true;
+	}
+	else if (Notation == EJsonNotation::Number)
+	{
+		*Data = (int64) Reader->GetValueAsNumber();
+		return true;
+	}
+
+	FLOGV("WARNING: Fail to load int64 key '%s'. Save corrupted", *Reader->GetIdentifier());
+	return SkipValue(Reader, Notation);
+}
+
+static bool StreamFloat(const FFlareSaveStream& Reader, EJsonNotation Notation, float* Data)
+{
+	if (Notation == EJsonNotation::Number)
+	{
+		*Data = Reader->GetValueAsNumber();
+		return true;
+	}
+	else if (Notation == EJsonNotation::String && Reader->GetValueAsString().IsNumeric())
+	{
+		*Data = FCString::Atof(*Reader->GetValueAsString());
+		return true;
+	}
+
+	FLOGV("WARNING: Fail to load float key '%s'. Save corrupted", *Reader->GetIdentifier());
+	return SkipValue(Reader, Notation);
+}
+
+static bool StreamBool(const FFlareSaveStream& Reader, EJsonNotation Notation, bool* Data)
+{
+	if (Notation == EJsonNotation::Boolean)
+	{
+		*Data = Reader->GetValueAsBoolean();
+		return true;
+	}
+
+	return SkipValue(Reader, Notation);
+}
+
+static bool StreamFName(const FFlareSaveStream& Reader, EJsonNotation Notation, FName* Data)
+{
+	if (Notation == EJsonNotation::String)
+	{
+		*Data = FName(*Reader->GetValueAsString());
+		return true;
+	}
+
+	FLOGV("WARNING: Fail to load FName key '%s'. Save corrupted", *Reader->GetIdentifier());
+	return SkipValue(Reader, Notation);
+}
+
+static bool StreamFText(const FFlareSaveStream& Reader, EJsonNotation Notation, FText* Data)
+{
+	if (Notation == EJsonNotation::String)
+	{
+		*Data = FText::FromString(Reader->GetValueAsString());
+		return true;
+	}
+
+	FLOGV("WARNING: Fail to load FText key '%s'. Save corrupted", *Reader->GetIdentifier());
+	return SkipValue(Reader, Notation);
+}
+
+static bool StreamString(const FFlareSaveStream& Reader, EJsonNotation Notation, FString* Data)
+{
+	if (Notation == EJsonNotation::String)
+	{
+		*Data = Reader->GetValueAsString();
+		return true;
+	}
+
+	return SkipValue(Reader, Notation);
+}
+
+static bool StreamVector(const FFlareSaveStream& Reader, EJsonNotation Notation, FVector* Data)
+{
+	if (Notation == EJsonNotation::String)
+	{
+		if (!ParseVector(Reader->GetValueAsString(), Data))
+		{
+			FLOGV("WARNING: Fail to load FVector key '%s'. No 3 values in '%s'. Save corrupted", *Reader->GetIdentifier(), *Reader->GetValueAsString());
+		}
+		return true;
+	}
+
+	FLOGV("WARNING: Fail to load FVector key '%s'. Save corrupted", *Reader->GetIdentifier());
+	return SkipValue(Reader, Notation);
+}
+
+/** Read a color saved as a vector, the color is only changed by a valid value */
+static bool StreamColor(const FFlareSaveStream& Reader, EJsonNotation Notation, FLinearColor* Data)
+{
+	FVector Temp;
+	if (Notation == EJsonNotation::String && ParseVector(Reader->GetValueAsString(), &Temp))
+	{
+		*Data = FLinearColor(Temp);
+		return true;
+	}
+
+	FLOGV("WARNING: Fail to load FVector key '%s'. Save corrupted", *Reader->GetIdentifier());
+	return SkipValue(Reader, Notation);
+}
+
+static bool StreamRotator(const FFlareSaveStream& Reader, EJsonNotation Notation, FRotator* Data)
+{
+	if (Notation == EJsonNotation::String)
+	{
+		float Values[3];
+		if (ParseFloatList(Reader->GetValueAsString(), Values, 3))
+		{
+			*Data = FRotator(Values[0], Values[1], Values[2]);
+		}
+		else
+		{
+			FLOGV("WARNING: Fail to load FRotator key '%s'. No 3 values in '%s'. Save corrupted", *Reader->GetIdentifier(), *Reader->GetValueAsString());
+		}
+		return true;
+	}
+
+	FLOGV("WARNING: Fail to load FRotator key '%s'. Save corrupted", *Reader->GetIdentifier());
+	return SkipValue(Reader, Notation);
+}
+
+template <typename EnumType, typename TargetType>
+static bool StreamEnum(const FFlareSaveStream& Reader, EJsonNotation Notation, const TCHAR* EnumName, TargetType* Data)
+{
+	static UEnum* Enum = NULL;
+
+	if (Notation == EJsonNotation::String)
+	{
+		if (!Enum)
+		{
+			Enum = FindObject<UEnum>(ANY_PACKAGE, EnumName, true);
+		}
+		*Data = Enum ? (EnumType) Enum->GetIndexByName(FName(*Reader->GetValueAsString())) : EnumType(0);
+		return true;
+	}
+
+	return SkipValue(Reader, Notation);
+}
+
+static bool StreamFNameArray(const FFlareSaveStream& Reader, EJsonNotation Notation, TArray<FName>* Data)
+{
+	return StreamArray(Reader, Notation, [&](EJsonNotation ItemNotation)
+	{
+		if (ItemNotation == EJsonNotation::String)
+		{
+			Data->Add(FName(*Reader->GetValueAsString()));
+		}
+		return SkipValue(Reader, ItemNotation);
+	});
+}
+
+static bool StreamFloatBuffer(const FFlareSaveStream& Reader, EJsonNotation Notation, FFlareFloatBuffer* Data)
+{
+	if (Notation != EJsonNotation::ObjectStart)
+	{
+		FLOGV("WARNING: Fail to load float key '%s'. Save corrupted", *Reader->GetIdentifier());
+		Data->Init(1);
+		return SkipValue(Reader, Notation);
+	}
+
+	Data->MaxSize = 0;
+	Data->WriteIndex = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation FieldNotation)
+	{
+		if (Key == TEXT("MaxSize"))
+		{
+			return StreamInt32(Reader, FieldNotation, &Data->MaxSize);
+		}
+		else if (Key == TEXT("WriteIndex"))
+		{
+			return StreamInt32(Reader, FieldNotation, &Data->WriteIndex);
+		}
+		else if (Key == TEXT("Values"))
+		{
+			return StreamArray(Reader, FieldNotation, [&](EJsonNotation ItemNotation)
+			{
+				if (ItemNotation == EJsonNotation::Number)
+				{
+					Data->Values.Add(Reader->GetValueAsNumber());
+				}
+				else if (ItemNotation == EJsonNotation::String)
+				{
+					Data->Values.Add(FCString::Atof(*Reader->GetValueAsString()));
+				}
+				return SkipValue(Reader, ItemNotation);
+			});
+		}
+
+		return SkipValue(Reader, FieldNotation);
+	});
+}
+
+static bool StreamBundle(const FFlareSaveStream& Reader, EJsonNotation Notation, FFlareBundle* Data)
+{
+	Data->Clear();
+
+	if (Notation != EJsonNotation::ObjectStart)
+	{
+		FLOGV("WARNING: Fail to load bundle key '%s'. Save corrupted", *Reader->GetIdentifier());
+		return SkipValue(Reader, Notation);
+	}
+
+	// Each value is added even when invalid, like the document loader does
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation FieldNotation)
+	{
+		if (Key == TEXT("FloatValues"))
+		{
+			return StreamMap(Reader, FieldNotation, [&](FName ValueKey, EJsonNotation ValueNotation)
+			{
+				float Value = 0;
+				if (ValueNotation == EJsonNotation::Number)
+				{
+					Value = Reader->GetValueAsNumber();
+				}
+				else if (ValueNotation == EJsonNotation::String)
+				{
+					Value = FCString::Atof(*Reader->GetValueAsString());
+				}
+				Data->FloatValues.Add(ValueKey, Value);
+				return SkipValue(Reader, ValueNotation);
+			});
+		}
+		else if (Key == TEXT("Int32Values"))
+		{
+			return StreamMap(Reader, FieldNotation, [&](FName ValueKey, EJsonNotation ValueNotation)
+			{
+				int32 Value = 0;
+				if (ValueNotation == EJsonNotation::String || ValueNotation == EJsonNotation::Number)
+				{
+					StreamInt32(Reader, ValueNotation, &Value);
+				}
+				Data->Int32Values.Add(ValueKey, Value);
+				return SkipValue(Reader, ValueNotation);
+			});
+		}
+		else if (Key == TEXT("TransformValues"))
+		{
+			return StreamMap(Reader, FieldNotation, [&](FName ValueKey, EJsonNotation ValueNotation)
+			{
+				FTransform Value;
+				if (ValueNotation == EJsonNotation::String)
+				{
+					ParseTransform(Reader->GetValueAsString(), &Value);
+				}
+				Data->TransformValues.Add(ValueKey, Value);
+				return SkipValue(Reader, ValueNotation);
+			});
+		}
+		else if (Key == TEXT("VectorArrayValues"))
+		{
+			return StreamMap(Reader, FieldNotation, [&](FName ValueKey, EJsonNotation ValueNotation)
+			{
+				TArray<FVector> VectorArray;
+				bool Success = StreamArray(Reader, ValueNotation, [&](EJsonNotation ItemNotation)
+				{
+					FVector Vector;
+					if (ItemNotation == EJsonNotation::String && ParseVector(Reader->GetValueAsString(), &Vector))
+					{
+						VectorArray.Add(Vector);
+					}
+					return SkipValue(Reader, ItemNotation);
+				});
+
+				Data->PutVectorArray(ValueKey, VectorArray);
+				return Success;
+			});
+		}
+		else if (Key == TEXT("NameValues"))
+		{
+			return StreamMap(Reader, FieldNotation, [&](FName ValueKey, EJsonNotation ValueNotation)
+			{
+				FName Value = (ValueNotation == EJsonNotation::String) ? FName(*Reader->GetValueAsString()) : NAME_None;
+				Data->NameValues.Add(ValueKey, Value);
+				return SkipValue(Reader, ValueNotation);
+			});
+		}
+		else if (Key == TEXT("NameArrayValues"))
+		{
+			return StreamMap(Reader, FieldNotation, [&](FName ValueKey, EJsonNotation ValueNotation)
+			{
+				TArray<FName> NameArray;
+				bool Success = StreamArray(Reader, ValueNotation, [&](EJsonNotation ItemNotation)
+				{
+					NameArray.Add((ItemNotation == EJsonNotation::String) ? FName(*Reader->GetValueAsString()) : NAME_None);
+					return SkipValue(Reader, ItemNotation);
+				});
+
+				Data->PutNameArray(ValueKey, NameArray);
+				return Success;
+			});
+		}
+		else if (Key == TEXT("StringValues"))
+		{
+			return StreamMap(Reader, FieldNotation, [&](FName ValueKey, EJsonNotation ValueNotation)
+			{
+				Data->StringValues.Add(ValueKey, (ValueNotation == EJsonNotation::String) ? Reader->GetValueAsString() : FString());
+				return SkipValue(Reader, ValueNotation);
+			});
+		}
+		else if (Key == TEXT("Tags"))
+		{
+			return StreamArray(Reader, FieldNotation, [&](EJsonNotation ItemNotation)
+			{
+				Data->PutTag((ItemNotation == EJsonNotation::String) ? FName(*Reader->GetValueAsString()) : NAME_None);
+				return SkipValue(Reader, ItemNotation);
+			});
+		}
+
+		return SkipValue(Reader, FieldNotation);
+	});
+}
+
+template<typename SaveType>
+bool UFlareSaveReaderV1::StreamRecords(const FFlareSaveStream& Reader, EJsonNotation Notation, TArray<SaveType>& Array,
+	bool (UFlareSaveReaderV1::*Loader)(const FFlareSaveStream&, SaveType*))
+{
+	return StreamArray(Reader, Notation, [&](EJsonNotation ItemNotation)
+	{
+		if (ItemNotation != EJsonNotation::ObjectStart)
+		{
+			return SkipValue(Reader, ItemNotation);
+		}
+
+		int32 Index = Array.AddDefaulted();
+		return (this->*Loader)(Reader, &Array[Index]);
+	});
+}
+
+template<typename SaveType>
+bool UFlareSaveReaderV1::StreamChild(const FFlareSaveStream& Reader, EJsonNotation Notation, SaveType* Data,
+	bool (UFlareSaveReaderV1::*Loader)(const FFlareSaveStream&, SaveType*))
+{
+	if (Notation != EJsonNotation::ObjectStart)
+	{
+		return SkipValue(Reader, Notation);
+	}
+
+	return (this->*Loader)(Reader, Data);
+}
+
+
+UFlareSaveGame* UFlareSaveReaderV1::LoadGameStream(const FString& SaveString)
+{
+	FFlareSaveStream Reader = TJsonReaderFactory<>::Create(SaveString);
+	EJsonNotation Notation = EJsonNotation::Error;
+	if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+	{
+		FLOGV("WARNING: Fail to read save root object: %s", *Reader->GetErrorMessage());
+		return NULL;
+	}
+
+	FString Game;
+	FString SaveFormat;
+	bool HasGame = false;
+	bool HasSaveFormat = false;
+	UFlareSaveGame* SaveGame = NULL;
+
+	// Check the version before reading any game data, the writer puts these fields first
+	auto CheckHeader = [&]()
+	{
+		if (!HasGame)
+		{
+			FLOG("WARNING: Fail to read game name. Save corrupted");
+			return false;
+		}
+
+		if (!HasSaveFormat)
+		{
+			FLOG("WARNING: Fail to read save format. Save corrupted");
+			return false;
+		}
+
+		if (Game != "Helium Rain" || SaveFormat != UFlareSaveWriter::FormatInt32(1))
+		{
+			FLOGV("WARNING: Invalid save version. Game is '%s' ('%s' excepted). Save format is '%s' ('%s' excepted)",
+				  *Game, "Helium Rain",
+				  *SaveFormat, *UFlareSaveWriter::FormatInt32(1));
+		}
+
+		SaveGame = NewObject<UFlareSaveGame>(this, UFlareSaveGame::StaticClass());
+		SaveGame->AutoSave = true;
+		return true;
+	};
+
+	bool Success = StreamObject(Reader, [&](const FString& Key, EJsonNotation FieldNotation)
+	{
+		if (!SaveGame)
+		{
+			if (Key == TEXT("Game"))
+			{
+				HasGame = StreamString(Reader, FieldNotation, &Game) && FieldNotation == EJsonNotation::String;
+				return true;
+			}
+			else if (Key == TEXT("SaveFormat"))
+			{
+				HasSaveFormat = StreamString(Reader, FieldNotation, &SaveFormat) && FieldNotation == EJsonNotation::String;
+				return true;
+			}
+			else if (!CheckHeader())
+			{
+				return false;
+			}
+		}
+
+		if (Key == TEXT("AutoSave"))
+		{
+			return StreamBool(Reader, FieldNotation, &SaveGame->AutoSave);
+		}
+		else if (Key == TEXT("Player"))
+		{
+			return StreamChild(Reader, FieldNotation, &SaveGame->PlayerData, &UFlareSaveReaderV1::StreamPlayer);
+		}
+		else if (Key == TEXT("PlayerCompanyDescription"))
+		{
+			return StreamChild(Reader, FieldNotation, &SaveGame->PlayerCompanyDescription, &UFlareSaveReaderV1::StreamCompanyDescription);
+		}
+		else if (Key == TEXT("CurrentImmatriculationIndex"))
+		{
+			return StreamInt32(Reader, FieldNotation, &SaveGame->CurrentImmatriculationIndex);
+		}
+		else if (Key == TEXT("CurrentIdentifierIndex"))
+		{
+			return StreamInt32(Reader, FieldNotation, &SaveGame->CurrentIdentifierIndex);
+		}
+		else if (Key == TEXT("World"))
+		{
+			return StreamChild(Reader, FieldNotation, &SaveGame->WorldData, &UFlareSaveReaderV1::StreamWorld);
+		}
+
+		return SkipValue(Reader, FieldNotation);
+	});
+
+	// A save with nothing but a header
+	if (Success && !SaveGame)
+	{
+		Success = CheckHeader();
+	}
+
+	if (!Success)
+	{
+		if (!Reader->GetErrorMessage().IsEmpty())
+		{
+			FLOGV("WARNING: Fail to read save: %s", *Reader->GetErrorMessage());
+		}
+		return NULL;
+	}
+
+	return SaveGame;
+}
+
+bool UFlareSaveReaderV1::StreamPlayer(const FFlareSaveStream& Reader, FFlarePlayerSave* Data)
+{
+	Data->UUID = NAME_None;
+	Data->ScenarioId = 0;
+	Data->PlayerEmblemIndex = 0;
+	Data->CompanyIdentifier = NAME_None;
+	Data->PlayerFleetIdentifier = NAME_None;
+	Data->LastFlownShipIdentifier = NAME_None;
+
+	bool Success = StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("UUID"))
+		{
+			return StreamFName(Reader, Notation, &Data->UUID);
+		}
+		else if (Key == TEXT("ScenarioId"))
+		{
+			return StreamInt32(Reader, Notation, &Data->ScenarioId);
+		}
+		else if (Key == TEXT("PlayerEmblemIndex"))
+		{
+			return StreamInt32(Reader, Notation, &Data->PlayerEmblemIndex);
+		}
+		else if (Key == TEXT("CompanyIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->CompanyIdentifier);
+		}
+		else if (Key == TEXT("PlayerFleetIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->PlayerFleetIdentifier);
+		}
+		else if (Key == TEXT("LastFlownShipIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->LastFlownShipIdentifier);
+		}
+		else if (Key == TEXT("Quest"))
+		{
+			return StreamChild(Reader, Notation, &Data->QuestData, &UFlareSaveReaderV1::StreamQuest);
+		}
+		else if (Key == TEXT("UnlockedScannables"))
+		{
+			return StreamArray(Reader, Notation, [&](EJsonNotation ItemNotation)
+			{
+				if (ItemNotation == EJsonNotation::String)
+				{
+					Data->UnlockedScannables.AddUnique(FName(*Reader->GetValueAsString()));
+				}
+				return SkipValue(Reader, ItemNotation);
+			});
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+
+	// LEGACY alpha 3
+	if(Data->UUID == NAME_None)
+	{
+		Data->UUID = FName(*FGuid::NewGuid().ToString());
+	}
+
+	return Success;
+}
+
+bool UFlareSaveReaderV1::StreamQuest(const FFlareSaveStream& Reader, FFlareQuestSave* Data)
+{
+	Data->SelectedQuest = NAME_None;
+	Data->NextGeneratedQuestIndex = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("SelectedQuest"))
+		{
+			return StreamFName(Reader, Notation, &Data->SelectedQuest);
+		}
+		else if (Key == TEXT("PlayTutorial"))
+		{
+			return StreamBool(Reader, Notation, &Data->PlayTutorial);
+		}
+		else if (Key == TEXT("NextGeneratedQuestIndex"))
+		{
+			return StreamInt64(Reader, Notation, &Data->NextGeneratedQuestIndex);
+		}
+		else if (Key == TEXT("QuestProgresses"))
+		{
+			return StreamRecords(Reader, Notation, Data->QuestProgresses, &UFlareSaveReaderV1::StreamQuestProgress);
+		}
+		else if (Key == TEXT("GeneratedQuests"))
+		{
+			return StreamRecords(Reader, Notation, Data->GeneratedQuests, &UFlareSaveReaderV1::StreamGeneratedQuest);
+		}
+		else if (Key == TEXT("SuccessfulQuests"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->SuccessfulQuests);
+		}
+		else if (Key == TEXT("AbandonedQuests"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->AbandonedQuests);
+		}
+		else if (Key == TEXT("FailedQuests"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->FailedQuests);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamQuestProgress(const FFlareSaveStream& Reader, FFlareQuestProgressSave* Data)
+{
+	Data->QuestIdentifier = NAME_None;
+	Data->Status = EFlareQuestStatus::Type(0);
+	Data->AvailableDate = 0;
+	Data->AcceptationDate = 0;
+	Data->Data.Clear();
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("QuestIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->QuestIdentifier);
+		}
+		else if (Key == TEXT("Status"))
+		{
+			return StreamEnum<EFlareQuestStatus::Type>(Reader, Notation, TEXT("EFlareQuestStatus"), &Data->Status);
+		}
+		else if (Key == TEXT("AvailableDate"))
+		{
+			return StreamInt64(Reader, Notation, &Data->AvailableDate);
+		}
+		else if (Key == TEXT("AcceptationDate"))
+		{
+			return StreamInt64(Reader, Notation, &Data->AcceptationDate);
+		}
+		else if (Key == TEXT("SuccessfullSteps"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->SuccessfullSteps);
+		}
+		else if (Key == TEXT("Data"))
+		{
+			return StreamBundle(Reader, Notation, &Data->Data);
+		}
+		else if (Key == TEXT("CurrentStepProgress"))
+		{
+			return StreamRecords(Reader, Notation, Data->CurrentStepProgress, &UFlareSaveReaderV1::StreamQuestStepProgress);
+		}
+		else if (Key == TEXT("TriggerConditionsSave"))
+		{
+			return StreamRecords(Reader, Notation, Data->TriggerConditionsSave, &UFlareSaveReaderV1::StreamQuestStepProgress);
+		}
+		else if (Key == TEXT("ExpirationConditionsSave"))
+		{
+			return StreamRecords(Reader, Notation, Data->ExpirationConditionsSave, &UFlareSaveReaderV1::StreamQuestStepProgress);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamGeneratedQuest(const FFlareSaveStream& Reader, FFlareGeneratedQuestSave* Data)
+{
+	Data->QuestClass = NAME_None;
+	Data->Data.Clear();
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("QuestClass"))
+		{
+			return StreamFName(Reader, Notation, &Data->QuestClass);
+		}
+		else if (Key == TEXT("Data"))
+		{
+			return StreamBundle(Reader, Notation, &Data->Data);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamQuestStepProgress(const FFlareSaveStream& Reader, FFlareQuestConditionSave* Data)
+{
+	Data->ConditionIdentifier = NAME_None;
+	Data->Data.Clear();
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("ConditionIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->ConditionIdentifier);
+		}
+		else if (Key == TEXT("Data"))
+		{
+			return StreamBundle(Reader, Notation, &Data->Data);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamCompanyDescription(const FFlareSaveStream& Reader, FFlareCompanyDescription* Data)
+{
+	Data->ShortName = NAME_None;
+	Data->CustomizationPatternIndex = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Name"))
+		{
+			return StreamFText(Reader, Notation, &Data->Name);
+		}
+		else if (Key == TEXT("ShortName"))
+		{
+			return StreamFName(Reader, Notation, &Data->ShortName);
+		}
+		else if (Key == TEXT("Description"))
+		{
+			return StreamFText(Reader, Notation, &Data->Description);
+		}
+		else if (Key == TEXT("CustomizationBasePaintColor"))
+		{
+			return StreamColor(Reader, Notation, &Data->CustomizationBasePaintColor);
+		}
+		else if (Key == TEXT("CustomizationPaintColor"))
+		{
+			return StreamColor(Reader, Notation, &Data->CustomizationPaintColor);
+		}
+		else if (Key == TEXT("CustomizationOverlayColor"))
+		{
+			return StreamColor(Reader, Notation, &Data->CustomizationOverlayColor);
+		}
+		else if (Key == TEXT("CustomizationLightColor"))
+		{
+			return StreamColor(Reader, Notation, &Data->CustomizationLightColor);
+		}
+		else if (Key == TEXT("CustomizationPatternIndex"))
+		{
+			return StreamInt32(Reader, Notation, &Data->CustomizationPatternIndex);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamWorld(const FFlareSaveStream& Reader, FFlareWorldSave* Data)
+{
+	Data->Date = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Date"))
+		{
+			return StreamInt64(Reader, Notation, &Data->Date);
+		}
+		else if (Key == TEXT("Companies"))
+		{
+			return StreamRecords(Reader, Notation, Data->CompanyData, &UFlareSaveReaderV1::StreamCompany);
+		}
+		else if (Key == TEXT("Sectors"))
+		{
+			return StreamRecords(Reader, Notation, Data->SectorData, &UFlareSaveReaderV1::StreamSector);
+		}
+		else if (Key == TEXT("Travels"))
+		{
+			return StreamRecords(Reader, Notation, Data->TravelData, &UFlareSaveReaderV1::StreamTravel);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamCompany(const FFlareSaveStream& Reader, FFlareCompanySave* Data)
+{
+	Data->Identifier = NAME_None;
+	Data->CatalogIdentifier = 0;
+	Data->Money = 0;
+	Data->CompanyValue = 0;
+	Data->PlayerLastPeaceDate = 0;
+	Data->PlayerLastWarDate = 0;
+	Data->PlayerLastTributeDate = 0;
+	Data->FleetImmatriculationIndex = 0;
+	Data->TradeRouteImmatriculationIndex = 0;
+	Data->ResearchAmount = 0;
+	Data->ResearchSpent = 0;
+	Data->ResearchRatio = 0;
+	Data->Retaliation = 0;
+	Data->PlayerReputation = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Identifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->Identifier);
+		}
+		else if (Key == TEXT("CatalogIdentifier"))
+		{
+			return StreamInt32(Reader, Notation, &Data->CatalogIdentifier);
+		}
+		else if (Key == TEXT("Money"))
+		{
+			return StreamInt64(Reader, Notation, &Data->Money);
+		}
+		else if (Key == TEXT("CompanyValue"))
+		{
+			return StreamInt64(Reader, Notation, &Data->CompanyValue);
+		}
+		else if (Key == TEXT("PlayerLastPeaceDate"))
+		{
+			return StreamInt64(Reader, Notation, &Data->PlayerLastPeaceDate);
+		}
+		else if (Key == TEXT("PlayerLastWarDate"))
+		{
+			return StreamInt64(Reader, Notation, &Data->PlayerLastWarDate);
+		}
+		else if (Key == TEXT("PlayerLastTributeDate"))
+		{
+			return StreamInt64(Reader, Notation, &Data->PlayerLastTributeDate);
+		}
+		else if (Key == TEXT("FleetImmatriculationIndex"))
+		{
+			return StreamInt32(Reader, Notation, &Data->FleetImmatriculationIndex);
+		}
+		else if (Key == TEXT("TradeRouteImmatriculationIndex"))
+		{
+			return StreamInt32(Reader, Notation, &Data->TradeRouteImmatriculationIndex);
+		}
+		else if (Key == TEXT("ResearchAmount"))
+		{
+			return StreamInt32(Reader, Notation, &Data->ResearchAmount);
+		}
+		else if (Key == TEXT("ResearchSpent"))
+		{
+			return StreamInt32(Reader, Notation, &Data->ResearchSpent);
+		}
+		else if (Key == TEXT("ResearchRatio"))
+		{
+			return StreamFloat(Reader, Notation, &Data->ResearchRatio);
+		}
+		else if (Key == TEXT("Retaliation"))
+		{
+			return StreamFloat(Reader, Notation, &Data->Retaliation);
+		}
+		else if (Key == TEXT("UnlockedTechnologies"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->UnlockedTechnologies);
+		}
+		else if (Key == TEXT("CaptureOrders"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->CaptureOrders);
+		}
+		else if (Key == TEXT("AI"))
+		{
+			return StreamChild(Reader, Notation, &Data->AI, &UFlareSaveReaderV1::StreamCompanyAI);
+		}
+		else if (Key == TEXT("HostileCompanies"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->HostileCompanies);
+		}
+		else if (Key == TEXT("Ships"))
+		{
+			return StreamRecords(Reader, Notation, Data->ShipData, &UFlareSaveReaderV1::StreamSpacecraft);
+		}
+		else if (Key == TEXT("ChildStations"))
+		{
+			return StreamRecords(Reader, Notation, Data->ChildStationData, &UFlareSaveReaderV1::StreamSpacecraft);
+		}
+		else if (Key == TEXT("Stations"))
+		{
+			return StreamRecords(Reader, Notation, Data->StationData, &UFlareSaveReaderV1::StreamSpacecraft);
+		}
+		else if (Key == TEXT("DestroyedSpacecrafts"))
+		{
+			return StreamRecords(Reader, Notation, Data->DestroyedSpacecraftData, &UFlareSaveReaderV1::StreamSpacecraft);
+		}
+		else if (Key == TEXT("Fleets"))
+		{
+			return StreamRecords(Reader, Notation, Data->Fleets, &UFlareSaveReaderV1::StreamFleet);
+		}
+		else if (Key == TEXT("TradeRoutes"))
+		{
+			return StreamRecords(Reader, Notation, Data->TradeRoutes, &UFlareSaveReaderV1::StreamTradeRoute);
+		}
+		else if (Key == TEXT("SectorsKnowledge"))
+		{
+			return StreamRecords(Reader, Notation, Data->SectorsKnowledge, &UFlareSaveReaderV1::StreamSectorKnowledge);
+		}
+		else if (Key == TEXT("TransactionLog"))
+		{
+			return StreamRecords(Reader, Notation, Data->TransactionLog, &UFlareSaveReaderV1::StreamTransactionLogEntry);
+		}
+		else if (Key == TEXT("TransactionSummaries"))
+		{
+			return StreamRecords(Reader, Notation, Data->TransactionSummaries, &UFlareSaveReaderV1::StreamTransactionLogSummary);
+		}
+		else if (Key == TEXT("PlayerReputation"))
+		{
+			return StreamFloat(Reader, Notation, &Data->PlayerReputation);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamSpacecraft(const FFlareSaveStream& Reader, FFlareSpacecraftSave* Data)
+{
+	Data->Immatriculation = NAME_None;
+	Data->Identifier = NAME_None;
+	Data->CompanyIdentifier = NAME_None;
+	Data->SpawnMode = EFlareSpawnMode::Type(0);
+	Data->DockedTo = NAME_None;
+	Data->DockedAt = 0;
+	Data->Heat = 0;
+	Data->PowerOutageDelay = 0;
+	Data->PowerOutageAcculumator = 0;
+	Data->DynamicComponentStateIdentifier = NAME_None;
+	Data->DynamicComponentStateProgress = 0;
+	Data->HarpoonCompany = NAME_None;
+	Data->AttachActorName = NAME_None;
+	Data->AttachComplexStationName = NAME_None;
+	Data->AttachComplexConnectorName = NAME_None;
+	Data->Level = 0;
+
+	// LEGACY alpha 3
+	Data->IsTrading = false;
+	Data->IsIntercepted = false;
+	Data->RefillStock = 0;
+	Data->RepairStock = 0;
+	Data->IsReserve = false;
+
+	// LEGACY early access
+	Data->AllowExternalOrder = true;
+	Data->DockedAngle = 0.f;
+
+	// Compatibility data, merged once IsUnderConstruction is known
+	TArray<FFlareCargoSave> Cargo;
+	TArray<FFlareCargoSave> CargoBackup;
+	TArray<FFlareShipyardOrderSave> LegacyOrders;
+
+	bool Success = StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("IsDestroyed"))
+		{
+			return StreamBool(Reader, Notation, &Data->IsDestroyed);
+		}
+		else if (Key == TEXT("IsUnderConstruction"))
+		{
+			return StreamBool(Reader, Notation, &Data->IsUnderConstruction);
+		}
+		else if (Key == TEXT("Immatriculation"))
+		{
+			return StreamFName(Reader, Notation, &Data->Immatriculation);
+		}
+		else if (Key == TEXT("NickName"))
+		{
+			return StreamFText(Reader, Notation, &Data->NickName);
+		}
+		else if (Key == TEXT("Identifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->Identifier);
+		}
+		else if (Key == TEXT("CompanyIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->CompanyIdentifier);
+		}
+		else if (Key == TEXT("Location"))
+		{
+			return StreamVector(Reader, Notation, &Data->Location);
+		}
+		else if (Key == TEXT("Rotation"))
+		{
+			return StreamRotator(Reader, Notation, &Data->Rotation);
+		}
+		else if (Key == TEXT("SpawnMode"))
+		{
+			return StreamEnum<EFlareSpawnMode::Type>(Reader, Notation, TEXT("EFlareSpawnMode"), &Data->SpawnMode);
+		}
+		else if (Key == TEXT("LinearVelocity"))
+		{
+			return StreamVector(Reader, Notation, &Data->LinearVelocity);
+		}
+		else if (Key == TEXT("AngularVelocity"))
+		{
+			return StreamVector(Reader, Notation, &Data->AngularVelocity);
+		}
+		else if (Key == TEXT("DockedTo"))
+		{
+			return StreamFName(Reader, Notation, &Data->DockedTo);
+		}
+		else if (Key == TEXT("DockedAt"))
+		{
+			return StreamInt32(Reader, Notation, &Data->DockedAt);
+		}
+		else if (Key == TEXT("Heat"))
+		{
+			return StreamFloat(Reader, Notation, &Data->Heat);
+		}
+		else if (Key == TEXT("PowerOutageDelay"))
+		{
+			return StreamFloat(Reader, Notation, &Data->PowerOutageDelay);
+		}
+		else if (Key == TEXT("PowerOutageAcculumator"))
+		{
+			return StreamFloat(Reader, Notation, &Data->PowerOutageAcculumator);
+		}
+		else if (Key == TEXT("DynamicComponentStateIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->DynamicComponentStateIdentifier);
+		}
+		else if (Key == TEXT("DynamicComponentStateProgress"))
+		{
+			return StreamFloat(Reader, Notation, &Data->DynamicComponentStateProgress);
+		}
+		else if (Key == TEXT("HarpoonCompany"))
+		{
+			return StreamFName(Reader, Notation, &Data->HarpoonCompany);
+		}
+		else if (Key == TEXT("AttachActorName"))
+		{
+			return StreamFName(Reader, Notation, &Data->AttachActorName);
+		}
+		else if (Key == TEXT("AttachComplexStationName"))
+		{
+			return StreamFName(Reader, Notation, &Data->AttachComplexStationName);
+		}
+		else if (Key == TEXT("AttachComplexConnectorName"))
+		{
+			return StreamFName(Reader, Notation, &Data->AttachComplexConnectorName);
+		}
+		else if (Key == TEXT("IsTrading"))
+		{
+			return StreamBool(Reader, Notation, &Data->IsTrading);
+		}
+		else if (Key == TEXT("IsIntercepted"))
+		{
+			return StreamBool(Reader, Notation, &Data->IsIntercepted);
+		}
+		else if (Key == TEXT("RefillStock"))
+		{
+			return StreamFloat(Reader, Notation, &Data->RefillStock);
+		}
+		else if (Key == TEXT("RepairStock"))
+		{
+			return StreamFloat(Reader, Notation, &Data->RepairStock);
+		}
+		else if (Key == TEXT("DockedAngle"))
+		{
+			return StreamFloat(Reader, Notation, &Data->DockedAngle);
+		}
+		else if (Key == TEXT("IsReserve"))
+		{
+			return StreamBool(Reader, Notation, &Data->IsReserve);
+		}
+		else if (Key == TEXT("AllowExternalOrder"))
+		{
+			return StreamBool(Reader, Notation, &Data->AllowExternalOrder);
+		}
+		else if (Key == TEXT("Level"))
+		{
+			return StreamInt32(Reader, Notation, &Data->Level);
+		}
+		else if (Key == TEXT("Pilot"))
+		{
+			return StreamChild(Reader, Notation, &Data->Pilot, &UFlareSaveReaderV1::StreamPilot);
+		}
+		else if (Key == TEXT("Asteroid"))
+		{
+			return StreamChild(Reader, Notation, &Data->AsteroidData, &UFlareSaveReaderV1::StreamAsteroid);
+		}
+		else if (Key == TEXT("Components"))
+		{
+			return StreamRecords(Reader, Notation, Data->Components, &UFlareSaveReaderV1::StreamSpacecraftComponent);
+		}
+		else if (Key == TEXT("ConstructionCargoBay"))
+		{
+			return StreamRecords(Reader, Notation, Data->ConstructionCargoBay, &UFlareSaveReaderV1::StreamCargo);
+		}
+		else if (Key == TEXT("ProductionCargoBay"))
+		{
+			return StreamRecords(Reader, Notation, Data->ProductionCargoBay, &UFlareSaveReaderV1::StreamCargo);
+		}
+		else if (Key == TEXT("Cargo"))
+		{
+			return StreamRecords(Reader, Notation, Cargo, &UFlareSaveReaderV1::StreamCargo);
+		}
+		else if (Key == TEXT("CargoBackup"))
+		{
+			return StreamRecords(Reader, Notation, CargoBackup, &UFlareSaveReaderV1::StreamCargo);
+		}
+		else if (Key == TEXT("FactoryStates"))
+		{
+			return StreamArray(Reader, Notation, [&](EJsonNotation ItemNotation)
+			{
+				if (ItemNotation != EJsonNotation::ObjectStart)
+				{
+					return SkipValue(Reader, ItemNotation);
+				}
+
+				int32 Index = Data->FactoryStates.AddDefaulted();
+				return StreamFactory(Reader, &Data->FactoryStates[Index], LegacyOrders);
+			});
+		}
+		else if (Key == TEXT("ShipyardOrderQueue"))
+		{
+			return StreamRecords(Reader, Notation, Data->ShipyardOrderQueue, &UFlareSaveReaderV1::StreamShipyardOrder);
+		}
+		else if (Key == TEXT("ConnectedStations"))
+		{
+			return StreamRecords(Reader, Notation, Data->ConnectedStations, &UFlareSaveReaderV1::StreamStationConnection);
+		}
+		else if (Key == TEXT("SalesExcludedResources"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->SalesExcludedResources);
+		}
+		else if (Key == TEXT("CapturePoints"))
+		{
+			return StreamArray(Reader, Notation, [&](EJsonNotation ItemNotation)
+			{
+				if (ItemNotation != EJsonNotation::ObjectStart)
+				{
+					return SkipValue(Reader, ItemNotation);
+				}
+
+				// Object with 2 field, the company name, and the point count
+				FName Company = NAME_None;
+				int32 Points = 0;
+				bool ItemSuccess = StreamObject(Reader, [&](const FString& ItemKey, EJsonNotation ItemFieldNotation)
+				{
+					if (ItemKey == TEXT("Company"))
+					{
+						return StreamFName(Reader, ItemFieldNotation, &Company);
+					}
+					else if (ItemKey == TEXT("Points"))
+					{
+						return StreamInt32(Reader, ItemFieldNotation, &Points);
+					}
+
+					return SkipValue(Reader, ItemFieldNotation);
+				});
+
+				Data->CapturePoints.Add(Company, Points);
+				return ItemSuccess;
+			});
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+
+	if(Data->RepairStock < 0)
+	{
+		FLOGV("WARNING: UFlareSaveReaderV1::LoadSpacecraft fix invalid RepairStock (%f) for %s", Data->RepairStock, *Data->Immatriculation.ToString());
+		Data->RepairStock = 0;
+	}
+
+	if(Data->RefillStock < 0)
+	{
+		FLOGV("WARNING: UFlareSaveReaderV1::LoadSpacecraft fix invalid RefillStock (%f) for %s", Data->RefillStock, *Data->Immatriculation.ToString());
+		Data->RefillStock = 0;
+	}
+
+	if (Data->Level == 0)
+	{
+		Data->Level = 1;
+	}
+
+	// Compatibity code
+	if (Cargo.Num() > 0)
+	{
+		TArray<FFlareCargoSave>& targetCargoBay = Data->IsUnderConstruction ? Data->ConstructionCargoBay : Data->ProductionCargoBay;
+		targetCargoBay.Append(Cargo);
+	}
+
+	// Compatibity code
+	if (CargoBackup.Num() > 0)
+	{
+		TArray<FFlareCargoSave>& targetCargoBay = Data->IsUnderConstruction ? Data->ProductionCargoBay : Data->ConstructionCargoBay;
+		targetCargoBay.Append(CargoBackup);
+	}
+
+	// Compatibility code, factory orders come before the saved queue
+	if (LegacyOrders.Num() > 0)
+	{
+		Data->ShipyardOrderQueue.Insert(LegacyOrders, 0);
+	}
+
+	return Success;
+}
+
+bool UFlareSaveReaderV1::StreamPilot(const FFlareSaveStream& Reader, FFlareShipPilotSave* Data)
+{
+	Data->Identifier = NAME_None;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Identifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->Identifier);
+		}
+		else if (Key == TEXT("Name"))
+		{
+			return StreamString(Reader, Notation, &Data->Name);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamAsteroid(const FFlareSaveStream& Reader, FFlareAsteroidSave* Data)
+{
+	Data->Identifier = NAME_None;
+	Data->AsteroidMeshID = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Identifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->Identifier);
+		}
+		else if (Key == TEXT("Location"))
+		{
+			return StreamVector(Reader, Notation, &Data->Location);
+		}
+		else if (Key == TEXT("Rotation"))
+		{
+			return StreamRotator(Reader, Notation, &Data->Rotation);
+		}
+		else if (Key == TEXT("LinearVelocity"))
+		{
+			return StreamVector(Reader, Notation, &Data->LinearVelocity);
+		}
+		else if (Key == TEXT("AngularVelocity"))
+		{
+			return StreamVector(Reader, Notation, &Data->AngularVelocity);
+		}
+		else if (Key == TEXT("Scale"))
+		{
+			return StreamVector(Reader, Notation, &Data->Scale);
+		}
+		else if (Key == TEXT("AsteroidMeshID"))
+		{
+			return StreamInt32(Reader, Notation, &Data->AsteroidMeshID);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamMeteorite(const FFlareSaveStream& Reader, FFlareMeteoriteSave* Data)
+{
+	Data->MeteoriteMeshID = 0;
+	Data->BrokenDamage = 0;
+	Data->Damage = 0;
+	Data->TargetStation = NAME_None;
+	Data->DaysBeforeImpact = 0;
+	Data->IsMetal = false;
+	Data->HasMissed = false;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Location"))
+		{
+			return StreamVector(Reader, Notation, &Data->Location);
+		}
+		else if (Key == TEXT("TargetOffset"))
+		{
+			return StreamVector(Reader, Notation, &Data->TargetOffset);
+		}
+		else if (Key == TEXT("Rotation"))
+		{
+			return StreamRotator(Reader, Notation, &Data->Rotation);
+		}
+		else if (Key == TEXT("LinearVelocity"))
+		{
+			return StreamVector(Reader, Notation, &Data->LinearVelocity);
+		}
+		else if (Key == TEXT("AngularVelocity"))
+		{
+			return StreamVector(Reader, Notation, &Data->AngularVelocity);
+		}
+		else if (Key == TEXT("MeteoriteMeshID"))
+		{
+			return StreamInt32(Reader, Notation, &Data->MeteoriteMeshID);
+		}
+		else if (Key == TEXT("BrokenDamage"))
+		{
+			return StreamFloat(Reader, Notation, &Data->BrokenDamage);
+		}
+		else if (Key == TEXT("Damage"))
+		{
+			return StreamFloat(Reader, Notation, &Data->Damage);
+		}
+		else if (Key == TEXT("TargetStation"))
+		{
+			return StreamFName(Reader, Notation, &Data->TargetStation);
+		}
+		else if (Key == TEXT("DaysBeforeImpact"))
+		{
+			return StreamInt32(Reader, Notation, &Data->DaysBeforeImpact);
+		}
+		else if (Key == TEXT("IsMetal"))
+		{
+			return StreamBool(Reader, Notation, &Data->IsMetal);
+		}
+		else if (Key == TEXT("HasMissed"))
+		{
+			return StreamBool(Reader, Notation, &Data->HasMissed);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamSpacecraftComponent(const FFlareSaveStream& Reader, FFlareSpacecraftComponentSave* Data)
+{
+	Data->ComponentIdentifier = NAME_None;
+	Data->ShipSlotIdentifier = NAME_None;
+	Data->Damage = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("ComponentIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->ComponentIdentifier);
+		}
+		else if (Key == TEXT("ShipSlotIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->ShipSlotIdentifier);
+		}
+		else if (Key == TEXT("Damage"))
+		{
+			return StreamFloat(Reader, Notation, &Data->Damage);
+		}
+		else if (Key == TEXT("Turret"))
+		{
+			return StreamChild(Reader, Notation, &Data->Turret, &UFlareSaveReaderV1::StreamSpacecraftComponentTurret);
+		}
+		else if (Key == TEXT("Weapon"))
+		{
+			return StreamChild(Reader, Notation, &Data->Weapon, &UFlareSaveReaderV1::StreamSpacecraftComponentWeapon);
+		}
+		else if (Key == TEXT("Pilot"))
+		{
+			return StreamChild(Reader, Notation, &Data->Pilot, &UFlareSaveReaderV1::StreamTurretPilot);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamStationConnection(const FFlareSaveStream& Reader, FFlareConnectionSave* Data)
+{
+	Data->ConnectorName = NAME_None;
+	Data->StationIdentifier = NAME_None;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("ConnectorName"))
+		{
+			return StreamFName(Reader, Notation, &Data->ConnectorName);
+		}
+		else if (Key == TEXT("StationIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->StationIdentifier);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamSpacecraftComponentTurret(const FFlareSaveStream& Reader, FFlareSpacecraftComponentTurretSave* Data)
+{
+	Data->TurretAngle = 0;
+	Data->BarrelsAngle = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("TurretAngle"))
+		{
+			return StreamFloat(Reader, Notation, &Data->TurretAngle);
+		}
+		else if (Key == TEXT("BarrelsAngle"))
+		{
+			return StreamFloat(Reader, Notation, &Data->BarrelsAngle);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamSpacecraftComponentWeapon(const FFlareSaveStream& Reader, FFlareSpacecraftComponentWeaponSave* Data)
+{
+	Data->FiredAmmo = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("FiredAmmo"))
+		{
+			return StreamInt32(Reader, Notation, &Data->FiredAmmo);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamTurretPilot(const FFlareSaveStream& Reader, FFlareTurretPilotSave* Data)
+{
+	Data->Identifier = NAME_None;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Identifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->Identifier);
+		}
+		else if (Key == TEXT("Name"))
+		{
+			return StreamString(Reader, Notation, &Data->Name);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamTradeOperation(const FFlareSaveStream& Reader, FFlareTradeRouteSectorOperationSave* Data)
+{
+	Data->ResourceIdentifier = NAME_None;
+	Data->MaxQuantity = 0;
+	Data->InventoryLimit = -1;
+	Data->MaxWait = 0;
+	Data->Type = EFlareTradeRouteOperation::Type(0);
+	Data->CanTradeWithStorages = false;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("ResourceIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->ResourceIdentifier);
+		}
+		else if (Key == TEXT("MaxQuantity"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->MaxQuantity);
+		}
+		else if (Key == TEXT("InventoryLimit"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->InventoryLimit);
+		}
+		else if (Key == TEXT("MaxWait"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->MaxWait);
+		}
+		else if (Key == TEXT("Type"))
+		{
+			return StreamEnum<EFlareTradeRouteOperation::Type>(Reader, Notation, TEXT("EFlareTradeRouteOperation"), &Data->Type);
+		}
+		else if (Key == TEXT("CanTradeWithStorages"))
+		{
+			return StreamBool(Reader, Notation, &Data->CanTradeWithStorages);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamCargo(const FFlareSaveStream& Reader, FFlareCargoSave* Data)
+{
+	Data->ResourceIdentifier = NAME_None;
+	Data->Quantity = 0;
+	Data->Lock = EFlareResourceLock::Type(0);
+	Data->Restriction = EFlareResourceRestriction::Type(0);
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("ResourceIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->ResourceIdentifier);
+		}
+		else if (Key == TEXT("Quantity"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->Quantity);
+		}
+		else if (Key == TEXT("Lock"))
+		{
+			return StreamEnum<EFlareResourceLock::Type>(Reader, Notation, TEXT("EFlareResourceLock"), &Data->Lock);
+		}
+		else if (Key == TEXT("Restriction"))
+		{
+			return StreamEnum<EFlareResourceRestriction::Type>(Reader, Notation, TEXT("EFlareResourceRestriction"), &Data->Restriction);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamShipyardOrder(const FFlareSaveStream& Reader, FFlareShipyardOrderSave* Data)
+{
+	Data->ShipClass = NAME_None;
+	Data->Company = NAME_None;
+	Data->AdvancePayment = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("ShipClass"))
+		{
+			return StreamFName(Reader, Notation, &Data->ShipClass);
+		}
+		else if (Key == TEXT("Company"))
+		{
+			return StreamFName(Reader, Notation, &Data->Company);
+		}
+		else if (Key == TEXT("AdvancePayment"))
+		{
+			return StreamInt32(Reader, Notation, &Data->AdvancePayment);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamFactory(const FFlareSaveStream& Reader, FFlareFactorySave* Data, TArray<FFlareShipyardOrderSave>& LegacyOrders)
+{
+	Data->CostReserved = 0;
+	Data->ProductedDuration = 0;
+	Data->CycleCount = 0;
+	Data->TargetShipClass = NAME_None;
+	Data->TargetShipCompany = NAME_None;
+
+	// Compatibility code
+	bool HasLegacyOrder = false;
+	FFlareShipyardOrderSave OrderData;
+	OrderData.ShipClass = NAME_None;
+	OrderData.Company = NAME_None;
+	OrderData.AdvancePayment = 0;
+
+	bool Success = StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Active"))
+		{
+			return StreamBool(Reader, Notation, &Data->Active);
+		}
+		else if (Key == TEXT("CostReserved"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->CostReserved);
+		}
+		else if (Key == TEXT("ProductedDuration"))
+		{
+			return StreamInt64(Reader, Notation, &Data->ProductedDuration);
+		}
+		else if (Key == TEXT("InfiniteCycle"))
+		{
+			return StreamBool(Reader, Notation, &Data->InfiniteCycle);
+		}
+		else if (Key == TEXT("CycleCount"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->CycleCount);
+		}
+		else if (Key == TEXT("TargetShipClass"))
+		{
+			return StreamFName(Reader, Notation, &Data->TargetShipClass);
+		}
+		else if (Key == TEXT("TargetShipCompany"))
+		{
+			return StreamFName(Reader, Notation, &Data->TargetShipCompany);
+		}
+		else if (Key == TEXT("OrderShipClass"))
+		{
+			HasLegacyOrder = true;
+			return StreamFName(Reader, Notation, &OrderData.ShipClass);
+		}
+		else if (Key == TEXT("OrderShipCompany"))
+		{
+			return StreamFName(Reader, Notation, &OrderData.Company);
+		}
+		else if (Key == TEXT("OrderShipAdvancePayment"))
+		{
+			return StreamInt32(Reader, Notation, &OrderData.AdvancePayment);
+		}
+		else if (Key == TEXT("ResourceReserved"))
+		{
+			return StreamRecords(Reader, Notation, Data->ResourceReserved, &UFlareSaveReaderV1::StreamCargo);
+		}
+		else if (Key == TEXT("OutputCargoLimit"))
+		{
+			return StreamRecords(Reader, Notation, Data->OutputCargoLimit, &UFlareSaveReaderV1::StreamCargo);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+
+	if (HasLegacyOrder && OrderData.ShipClass != NAME_None)
+	{
+		LegacyOrders.Add(OrderData);
+	}
+
+	return Success;
+}
+
+bool UFlareSaveReaderV1::StreamFleet(const FFlareSaveStream& Reader, FFlareFleetSave* Data)
+{
+	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
+
+	Data->Identifier = NAME_None;
+	Data->FleetColor = Theme.NeutralColor;
+	Data->AutoTrade = false;
+	Data->AutoTradeStatsDays = 0;
+	Data->AutoTradeStatsLoadResources = 0;
+	Data->AutoTradeStatsUnloadResources = 0;
+	Data->AutoTradeStatsMoneySell = 0;
+	Data->AutoTradeStatsMoneyBuy = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Name"))
+		{
+			return StreamFText(Reader, Notation, &Data->Name);
+		}
+		else if (Key == TEXT("Identifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->Identifier);
+		}
+		else if (Key == TEXT("ShipImmatriculations"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->ShipImmatriculations);
+		}
+		else if (Key == TEXT("FleetColor"))
+		{
+			return StreamColor(Reader, Notation, &Data->FleetColor);
+		}
+		else if (Key == TEXT("AutoTrade"))
+		{
+			return StreamBool(Reader, Notation, &Data->AutoTrade);
+		}
+		else if (Key == TEXT("AutoTradeStatsDays"))
+		{
+			return StreamInt32(Reader, Notation, &Data->AutoTradeStatsDays);
+		}
+		else if (Key == TEXT("AutoTradeStatsLoadResources"))
+		{
+			return StreamInt32(Reader, Notation, &Data->AutoTradeStatsLoadResources);
+		}
+		else if (Key == TEXT("AutoTradeStatsUnloadResources"))
+		{
+			return StreamInt32(Reader, Notation, &Data->AutoTradeStatsUnloadResources);
+		}
+		else if (Key == TEXT("AutoTradeStatsMoneySell"))
+		{
+			return StreamInt64(Reader, Notation, &Data->AutoTradeStatsMoneySell);
+		}
+		else if (Key == TEXT("AutoTradeStatsMoneyBuy"))
+		{
+			return StreamInt64(Reader, Notation, &Data->AutoTradeStatsMoneyBuy);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamTradeRoute(const FFlareSaveStream& Reader, FFlareTradeRouteSave* Data)
+{
+	Data->Identifier = NAME_None;
+	Data->FleetIdentifier = NAME_None;
+	Data->TargetSectorIdentifier = NAME_None;
+	Data->CurrentOperationIndex = 0;
+	Data->CurrentOperationProgress = 0;
+	Data->CurrentOperationDuration = 0;
+	Data->StatsDays = 0;
+	Data->StatsLoadResources = 0;
+	Data->StatsUnloadResources = 0;
+	Data->StatsMoneySell = 0;
+	Data->StatsMoneyBuy = 0;
+	Data->StatsOperationSuccessCount = 0;
+	Data->StatsOperationFailCount = 0;
+	Data->IsPaused = false;
+
+	// LEGACY alpha 3
+	TArray<FName> FleetIdentifiers;
+
+	bool Success = StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Name"))
+		{
+			return StreamFText(Reader, Notation, &Data->Name);
+		}
+		else if (Key == TEXT("Identifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->Identifier);
+		}
+		else if (Key == TEXT("FleetIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->FleetIdentifier);
+		}
+		else if (Key == TEXT("TargetSectorIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->TargetSectorIdentifier);
+		}
+		else if (Key == TEXT("CurrentOperationIndex"))
+		{
+			return StreamInt32(Reader, Notation, &Data->CurrentOperationIndex);
+		}
+		else if (Key == TEXT("CurrentOperationProgress"))
+		{
+			return StreamInt32(Reader, Notation, &Data->CurrentOperationProgress);
+		}
+		else if (Key == TEXT("CurrentOperationDuration"))
+		{
+			return StreamInt32(Reader, Notation, &Data->CurrentOperationDuration);
+		}
+		else if (Key == TEXT("StatsDays"))
+		{
+			return StreamInt32(Reader, Notation, &Data->StatsDays);
+		}
+		else if (Key == TEXT("StatsLoadResources"))
+		{
+			return StreamInt32(Reader, Notation, &Data->StatsLoadResources);
+		}
+		else if (Key == TEXT("StatsUnloadResources"))
+		{
+			return StreamInt32(Reader, Notation, &Data->StatsUnloadResources);
+		}
+		else if (Key == TEXT("StatsMoneySell"))
+		{
+			return StreamInt64(Reader, Notation, &Data->StatsMoneySell);
+		}
+		else if (Key == TEXT("StatsMoneyBuy"))
+		{
+			return StreamInt64(Reader, Notation, &Data->StatsMoneyBuy);
+		}
+		else if (Key == TEXT("StatsOperationSuccessCount"))
+		{
+			return StreamInt32(Reader, Notation, &Data->StatsOperationSuccessCount);
+		}
+		else if (Key == TEXT("StatsOperationFailCount"))
+		{
+			return StreamInt32(Reader, Notation, &Data->StatsOperationFailCount);
+		}
+		else if (Key == TEXT("IsPaused"))
+		{
+			return StreamBool(Reader, Notation, &Data->IsPaused);
+		}
+		else if (Key == TEXT("FleetIdentifiers"))
+		{
+			return StreamFNameArray(Reader, Notation, &FleetIdentifiers);
+		}
+		else if (Key == TEXT("Sectors"))
+		{
+			return StreamRecords(Reader, Notation, Data->Sectors, &UFlareSaveReaderV1::StreamTradeRouteSector);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+
+	// LEGACY alpha 3
+	if(FleetIdentifiers.Num() > 0)
+	{
+		Data->FleetIdentifier = FleetIdentifiers[0];
+	}
+
+	return Success;
+}
+
+bool UFlareSaveReaderV1::StreamTradeRouteSector(const FFlareSaveStream& Reader, FFlareTradeRouteSectorSave* Data)
+{
+	Data->SectorIdentifier = NAME_None;
+
+	// LEGACY alpha 3
+	TArray<FFlareCargoSave> ResourcesToUnload;
+	TArray<FFlareCargoSave> ResourcesToLoad;
+	TArray<FFlareTradeRouteSectorOperationSave> Operations;
+
+	bool Success = StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("SectorIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->SectorIdentifier);
+		}
+		else if (Key == TEXT("ResourcesToUnload"))
+		{
+			return StreamRecords(Reader, Notation, ResourcesToUnload, &UFlareSaveReaderV1::StreamCargo);
+		}
+		else if (Key == TEXT("ResourcesToLoad"))
+		{
+			return StreamRecords(Reader, Notation, ResourcesToLoad, &UFlareSaveReaderV1::StreamCargo);
+		}
+		else if (Key == TEXT("Operations"))
+		{
+			return StreamRecords(Reader, Notation, Operations, &UFlareSaveReaderV1::StreamTradeOperation);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+
+	// LEGACY alpha 3, unload operations come first, then load, then the saved operations
+	for (const FFlareCargoSave& Cargo : ResourcesToUnload)
+	{
+		FFlareTradeRouteSectorOperationSave Operation;
+		Operation.Type = EFlareTradeRouteOperation::Unload;
+		Operation.ResourceIdentifier = Cargo.ResourceIdentifier;
+		Operation.MaxQuantity = (Cargo.Quantity == 0 ? -1: Cargo.Quantity);
+		Operation.MaxWait = -1;
+
+		Data->Operations.Add(Operation);
+	}
+
+	for (const FFlareCargoSave& Cargo : ResourcesToLoad)
+	{
+		FFlareTradeRouteSectorOperationSave Operation;
+		Operation.Type = EFlareTradeRouteOperation::Load;
+		Operation.ResourceIdentifier = Cargo.ResourceIdentifier;
+		Operation.MaxQuantity = (Cargo.Quantity == 0 ? -1: Cargo.Quantity);
+		Operation.MaxWait = -1;
+
+		Data->Operations.Add(Operation);
+	}
+
+	Data->Operations.Append(Operations);
+
+	return Success;
+}
+
+bool UFlareSaveReaderV1::StreamSectorKnowledge(const FFlareSaveStream& Reader, FFlareCompanySectorKnowledge* Data)
+{
+	Data->SectorIdentifier = NAME_None;
+	Data->Knowledge = EFlareSectorKnowledge::Type(0);
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("SectorIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->SectorIdentifier);
+		}
+		else if (Key == TEXT("Knowledge"))
+		{
+			return StreamEnum<EFlareSectorKnowledge::Type>(Reader, Notation, TEXT("EFlareSectorKnowledge"), &Data->Knowledge);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamTransactionLogEntry(const FFlareSaveStream& Reader, FFlareTransactionLogEntry* Data)
+{
+	Data->Date = 0;
+	Data->Amount = 0;
+	Data->Type = EFlareTransactionLogEntry::Type(0);
+	Data->Spacecraft = NAME_None;
+	Data->Sector = NAME_None;
+	Data->OtherCompany = NAME_None;
+	Data->OtherSpacecraft = NAME_None;
+	Data->Resource = NAME_None;
+	Data->ResourceQuantity = 0;
+	Data->ExtraIdentifier1 = NAME_None;
+	Data->ExtraIdentifier2 = NAME_None;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Date"))
+		{
+			return StreamInt64(Reader, Notation, &Data->Date);
+		}
+		else if (Key == TEXT("Amount"))
+		{
+			return StreamInt64(Reader, Notation, &Data->Amount);
+		}
+		else if (Key == TEXT("Type"))
+		{
+			return StreamEnum<EFlareTransactionLogEntry::Type>(Reader, Notation, TEXT("EFlareTransactionLogEntry"), &Data->Type);
+		}
+		else if (Key == TEXT("Spacecraft"))
+		{
+			return StreamFName(Reader, Notation, &Data->Spacecraft);
+		}
+		else if (Key == TEXT("Sector"))
+		{
+			return StreamFName(Reader, Notation, &Data->Sector);
+		}
+		else if (Key == TEXT("OtherCompany"))
+		{
+			return StreamFName(Reader, Notation, &Data->OtherCompany);
+		}
+		else if (Key == TEXT("OtherSpacecraft"))
+		{
+			return StreamFName(Reader, Notation, &Data->OtherSpacecraft);
+		}
+		else if (Key == TEXT("Resource"))
+		{
+			return StreamFName(Reader, Notation, &Data->Resource);
+		}
+		else if (Key == TEXT("ResourceQuantity"))
+		{
+			return StreamInt32(Reader, Notation, &Data->ResourceQuantity);
+		}
+		else if (Key == TEXT("ExtraIdentifier1"))
+		{
+			return StreamFName(Reader, Notation, &Data->ExtraIdentifier1);
+		}
+		else if (Key == TEXT("ExtraIdentifier2"))
+		{
+			return StreamFName(Reader, Notation, &Data->ExtraIdentifier2);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamTransactionLogSummary(const FFlareSaveStream& Reader, FFlareTransactionLogSummary* Data)
+{
+	Data->Year = 0;
+	Data->Amounts.SetNumZeroed(EFlareTransactionLogEntry::TYPE_COUNT);
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Year"))
+		{
+			return StreamInt64(Reader, Notation, &Data->Year);
+		}
+		else if (Key == TEXT("Amounts") && Notation == EJsonNotation::String)
+		{
+			// Walk the comma-separated block in the token buffer, indexed by transaction type
+			const TCHAR* Cursor = *Reader->GetValueAsString();
+			for (int32 Type = 0; Type < Data->Amounts.Num() && *Cursor; Type++)
+			{
+				Data->Amounts[Type] = FCString::Atoi64(Cursor);
+				while (*Cursor && *Cursor != TEXT(','))
+				{
+					Cursor++;
+				}
+				if (*Cursor)
+				{
+					Cursor++;
+				}
+			}
+			return true;
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamCompanyAI(const FFlareSaveStream& Reader, FFlareCompanyAISave* Data)
+{
+	Data->BudgetMilitary = 0;
+	Data->BudgetStation = 0;
+	Data->BudgetTechnology = 0;
+	Data->BudgetTrade = 0;
+	Data->Caution = 0;
+	Data->Pacifism = 0;
+	Data->ResearchProject = NAME_None;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("BudgetMilitary"))
+		{
+			return StreamInt64(Reader, Notation, &Data->BudgetMilitary);
+		}
+		else if (Key == TEXT("BudgetStation"))
+		{
+			return StreamInt64(Reader, Notation, &Data->BudgetStation);
+		}
+		else if (Key == TEXT("BudgetTechnology"))
+		{
+			return StreamInt64(Reader, Notation, &Data->BudgetTechnology);
+		}
+		else if (Key == TEXT("BudgetTrade"))
+		{
+			return StreamInt64(Reader, Notation, &Data->BudgetTrade);
+		}
+		else if (Key == TEXT("Caution"))
+		{
+			return StreamFloat(Reader, Notation, &Data->Caution);
+		}
+		else if (Key == TEXT("Pacifism"))
+		{
+			return StreamFloat(Reader, Notation, &Data->Pacifism);
+		}
+		else if (Key == TEXT("ResearchProject"))
+		{
+			return StreamFName(Reader, Notation, &Data->ResearchProject);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamCompanyReputation(const FFlareSaveStream& Reader, FFlareCompanyReputationSave* Data)
+{
+	Data->CompanyIdentifier = NAME_None;
+	Data->Reputation = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("CompanyIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->CompanyIdentifier);
+		}
+		else if (Key == TEXT("Reputation"))
+		{
+			return StreamFloat(Reader, Notation, &Data->Reputation);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamSector(const FFlareSaveStream& Reader, FFlareSectorSave* Data)
+{
+	Data->Identifier = NAME_None;
+	Data->LocalTime = 0;
+	Data->IsTravelSector = false;
+	Data->DailyFleetSupplyConsumption = 0;
+
+	bool HasFleetSupplyConsumptionStats = false;
+
+	bool Success = StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("GivenName"))
+		{
+			return StreamFText(Reader, Notation, &Data->GivenName);
+		}
+		else if (Key == TEXT("Identifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->Identifier);
+		}
+		else if (Key == TEXT("LocalTime"))
+		{
+			return StreamInt64(Reader, Notation, &Data->LocalTime);
+		}
+		else if (Key == TEXT("People"))
+		{
+			return StreamChild(Reader, Notation, &Data->PeopleData, &UFlareSaveReaderV1::StreamPeople);
+		}
+		else if (Key == TEXT("Bombs"))
+		{
+			return StreamRecords(Reader, Notation, Data->BombData, &UFlareSaveReaderV1::StreamBomb);
+		}
+		else if (Key == TEXT("Asteroids"))
+		{
+			return StreamRecords(Reader, Notation, Data->AsteroidData, &UFlareSaveReaderV1::StreamAsteroid);
+		}
+		else if (Key == TEXT("Meteorites"))
+		{
+			return StreamRecords(Reader, Notation, Data->MeteoriteData, &UFlareSaveReaderV1::StreamMeteorite);
+		}
+		else if (Key == TEXT("FleetIdentifiers"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->FleetIdentifiers);
+		}
+		else if (Key == TEXT("SpacecraftIdentifiers"))
+		{
+			return StreamFNameArray(Reader, Notation, &Data->SpacecraftIdentifiers);
+		}
+		else if (Key == TEXT("ResourcePrices"))
+		{
+			return StreamRecords(Reader, Notation, Data->ResourcePrices, &UFlareSaveReaderV1::StreamResourcePrice);
+		}
+		else if (Key == TEXT("IsTravelSector"))
+		{
+			return StreamBool(Reader, Notation, &Data->IsTravelSector);
+		}
+		else if (Key == TEXT("FleetSupplyConsumptionStats"))
+		{
+			HasFleetSupplyConsumptionStats = true;
+			return StreamFloatBuffer(Reader, Notation, &Data->FleetSupplyConsumptionStats);
+		}
+		else if (Key == TEXT("DailyFleetSupplyConsumption"))
+		{
+			return StreamInt32(Reader, Notation, &Data->DailyFleetSupplyConsumption);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+
+	if (!HasFleetSupplyConsumptionStats)
+	{
+		Data->FleetSupplyConsumptionStats.Init(1);
+	}
+
+	return Success;
+}
+
+bool UFlareSaveReaderV1::StreamPeople(const FFlareSaveStream& Reader, FFlarePeopleSave* Data)
+{
+	Data->Population = 0;
+	Data->FoodStock = 0;
+	Data->FuelStock = 0;
+	Data->ToolStock = 0;
+	Data->TechStock = 0;
+	Data->FoodConsumption = 0;
+	Data->FuelConsumption = 0;
+	Data->ToolConsumption = 0;
+	Data->TechConsumption = 0;
+	Data->Money = 0;
+	Data->Dept = 0;
+	Data->BirthPoint = 0;
+	Data->DeathPoint = 0;
+	Data->HungerPoint = 0;
+	Data->HappinessPoint = 0;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Population"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->Population);
+		}
+		else if (Key == TEXT("FoodStock"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->FoodStock);
+		}
+		else if (Key == TEXT("FuelStock"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->FuelStock);
+		}
+		else if (Key == TEXT("ToolStock"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->ToolStock);
+		}
+		else if (Key == TEXT("TechStock"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->TechStock);
+		}
+		else if (Key == TEXT("FoodConsumption"))
+		{
+			return StreamFloat(Reader, Notation, &Data->FoodConsumption);
+		}
+		else if (Key == TEXT("FuelConsumption"))
+		{
+			return StreamFloat(Reader, Notation, &Data->FuelConsumption);
+		}
+		else if (Key == TEXT("ToolConsumption"))
+		{
+			return StreamFloat(Reader, Notation, &Data->ToolConsumption);
+		}
+		else if (Key == TEXT("TechConsumption"))
+		{
+			return StreamFloat(Reader, Notation, &Data->TechConsumption);
+		}
+		else if (Key == TEXT("Money"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->Money);
+		}
+		else if (Key == TEXT("Dept"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->Dept);
+		}
+		else if (Key == TEXT("BirthPoint"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->BirthPoint);
+		}
+		else if (Key == TEXT("DeathPoint"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->DeathPoint);
+		}
+		else if (Key == TEXT("HungerPoint"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->HungerPoint);
+		}
+		else if (Key == TEXT("HappinessPoint"))
+		{
+			return StreamInt32(Reader, Notation, (int32*) &Data->HappinessPoint);
+		}
+		else if (Key == TEXT("CompanyReputations"))
+		{
+			return StreamRecords(Reader, Notation, Data->CompanyReputations, &UFlareSaveReaderV1::StreamCompanyReputation);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamBomb(const FFlareSaveStream& Reader, FFlareBombSave* Data)
+{
+	Data->Identifier = NAME_None;
+	Data->WeaponSlotIdentifier = NAME_None;
+	Data->ParentSpacecraft = NAME_None;
+	Data->AttachTarget = NAME_None;
+	Data->DropParentDistance = 0;
+	Data->LifeTime = 0;
+	Data->BurnDuration = 0;
+	Data->AimTargetSpacecraft = NAME_None;
+
+	return StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("Identifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->Identifier);
+		}
+		else if (Key == TEXT("Location"))
+		{
+			return StreamVector(Reader, Notation, &Data->Location);
+		}
+		else if (Key == TEXT("Rotation"))
+		{
+			return StreamRotator(Reader, Notation, &Data->Rotation);
+		}
+		else if (Key == TEXT("LinearVelocity"))
+		{
+			return StreamVector(Reader, Notation, &Data->LinearVelocity);
+		}
+		else if (Key == TEXT("AngularVelocity"))
+		{
+			return StreamVector(Reader, Notation, &Data->AngularVelocity);
+		}
+		else if (Key == TEXT("WeaponSlotIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->WeaponSlotIdentifier);
+		}
+		else if (Key == TEXT("ParentSpacecraft"))
+		{
+			return StreamFName(Reader, Notation, &Data->ParentSpacecraft);
+		}
+		else if (Key == TEXT("AttachTarget"))
+		{
+			return StreamFName(Reader, Notation, &Data->AttachTarget);
+		}
+		else if (Key == TEXT("Activated"))
+		{
+			return StreamBool(Reader, Notation, &Data->Activated);
+		}
+		else if (Key == TEXT("Dropped"))
+		{
+			return StreamBool(Reader, Notation, &Data->Dropped);
+		}
+		else if (Key == TEXT("Locked"))
+		{
+			return StreamBool(Reader, Notation, &Data->Locked);
+		}
+		else if (Key == TEXT("DropParentDistance"))
+		{
+			return StreamFloat(Reader, Notation, &Data->DropParentDistance);
+		}
+		else if (Key == TEXT("LifeTime"))
+		{
+			return StreamFloat(Reader, Notation, &Data->LifeTime);
+		}
+		else if (Key == TEXT("BurnDuration"))
+		{
+			return StreamFloat(Reader, Notation, &Data->BurnDuration);
+		}
+		else if (Key == TEXT("AimTargetSpacecraft"))
+		{
+			return StreamFName(Reader, Notation, &Data->AimTargetSpacecraft);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+}
+
+bool UFlareSaveReaderV1::StreamResourcePrice(const FFlareSaveStream& Reader, FFFlareResourcePrice* Data)
+{
+	Data->ResourceIdentifier = NAME_None;
+	Data->Price = 0;
+
+	bool HasPrices = false;
+
+	bool Success = StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("ResourceIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->ResourceIdentifier);
+		}
+		else if (Key == TEXT("Price"))
+		{
+			return StreamFloat(Reader, Notation, &Data->Price);
+		}
+		else if (Key == TEXT("Prices"))
+		{
+			HasPrices = true;
+			return StreamFloatBuffer(Reader, Notation, &Data->Prices);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+
+	if (!HasPrices)
+	{
+		Data->Prices.Init(1);
+	}
+
+	return Success;
+}
+
+bool UFlareSaveReaderV1::StreamTravel(const FFlareSaveStream& Reader, FFlareTravelSave* Data)
+{
+	Data->FleetIdentifier = NAME_None;
+	Data->OriginSectorIdentifier = NAME_None;
+	Data->DestinationSectorIdentifier = NAME_None;
+	Data->DepartureDate = 0;
+
+	bool HasSectorData = false;
+
+	bool Success = StreamObject(Reader, [&](const FString& Key, EJsonNotation Notation)
+	{
+		if (Key == TEXT("FleetIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->FleetIdentifier);
+		}
+		else if (Key == TEXT("OriginSectorIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->OriginSectorIdentifier);
+		}
+		else if (Key == TEXT("DestinationSectorIdentifier"))
+		{
+			return StreamFName(Reader, Notation, &Data->DestinationSectorIdentifier);
+		}
+		else if (Key == TEXT("DepartureDate"))
+		{
+			return StreamInt64(Reader, Notation, &Data->DepartureDate);
+		}
+		else if (Key == TEXT("SectorData") && Notation == EJsonNotation::ObjectStart)
+		{
+			HasSectorData = true;
+			return StreamSector(Reader, &Data->SectorData);
+		}
+
+		return SkipValue(Reader, Notation);
+	});
+
+	if (!HasSectorData)
+	{
+		UFlareTravel::InitTravelSector(Data->SectorData);
+	}
+
+	return Success;
+}
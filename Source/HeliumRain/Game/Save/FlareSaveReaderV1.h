@@ -9,6 +9,9 @@ class UFlareSaveGame;
 struct FFlareTradeRouteSectorOperationSave;
 struct FFlareFloatBuffer;
 
+/** Pull parser over a save text, shared by the streaming loaders */
+typedef TSharedRef<TJsonReader<>> FFlareSaveStream;
+
 UCLASS()
 class HELIUMRAIN_API UFlareSaveReaderV1: public UObject
 {
@@ -17,54 +20,123 @@ class HELIUMRAIN_API UFlareSaveReaderV1: public UObject
 public:
 	UFlareSaveGame* LoadGame(TSharedPtr< FJsonObject > GameObject);
 
+	/** Load a save from its JSON text with a pull parser, reading each field straight into the save structures without building a document */
+	UFlareSaveGame* LoadGameStream(const FString& SaveString);
+
 protected:
+
+	/*----------------------------------------------------
+	  Streaming
+	----------------------------------------------------*/
+
+	/** Load each object of an array with Loader, the reader is on the array start */
+	template<typename SaveType>
+	bool StreamRecords(const FFlareSaveStream& Reader, EJsonNotation Notation, TArray<SaveType>& Array,
+		bool (UFlareSaveReaderV1::*Loader)(const FFlareSaveStream&, SaveType*));
+
+	/** Load an object with Loader, the reader is on the object start */
+	template<typename SaveType>
+	bool StreamChild(const FFlareSaveStream& Reader, EJsonNotation Notation, SaveType* Data,
+		bool (UFlareSaveReaderV1::*Loader)(const FFlareSaveStream&, SaveType*));
+
+	/* Streaming loaders read the fields of an object, the reader is after its opening brace.
+	   Fields missing from the save get the same values as with the document loaders. */
+
+	bool StreamPlayer(const FFlareSaveStream& Reader, FFlarePlayerSave* Data);
+	bool StreamQuest(const FFlareSaveStream& Reader, FFlareQuestSave* Data);
+	bool StreamQuestProgress(const FFlareSaveStream& Reader, FFlareQuestProgressSave* Data);
+	bool StreamGeneratedQuest(const FFlareSaveStream& Reader, FFlareGeneratedQuestSave* Data);
+
+	bool StreamQuestStepProgress(const FFlareSaveStream& Reader, FFlareQuestConditionSave* Data);
+
+	bool StreamCompanyDescription(const FFlareSaveStream& Reader, FFlareCompanyDescription* Data);
+	bool StreamWorld(const FFlareSaveStream& Reader, FFlareWorldSave* Data);
+
+
+	bool StreamCompany(const FFlareSaveStream& Reader, FFlareCompanySave* Data);
+
+	bool StreamSpacecraft(const FFlareSaveStream& Reader, FFlareSpacecraftSave* Data);
+	bool StreamPilot(const FFlareSaveStream& Reader, FFlareShipPilotSave* Data);
+	bool StreamAsteroid(const FFlareSaveStream& Reader, FFlareAsteroidSave* Data);
+	bool StreamMeteorite(const FFlareSaveStream& Reader, FFlareMeteoriteSave* Data);
+	bool StreamSpacecraftComponent(const FFlareSaveStream& Reader, FFlareSpacecraftComponentSave* Data);
+	bool StreamSpacecraftComponentTurret(const FFlareSaveStream& Reader, FFlareSpacecraftComponentTurretSave* Data);
+	bool StreamSpacecraftComponentWeapon(const FFlareSaveStream& Reader, FFlareSpacecraftComponentWeaponSave* Data);
+	bool StreamTurretPilot(const FFlareSaveStream& Reader, FFlareTurretPilotSave* Data);
+	bool StreamStationConnection(const FFlareSaveStream& Reader, FFlareConnectionSave* Data);
+
+	bool StreamTradeOperation(const FFlareSaveStream& Reader, FFlareTradeRouteSectorOperationSave* Data);
+	bool StreamCargo(const FFlareSaveStream& Reader, FFlareCargoSave* Data);
+	bool StreamFactory(const FFlareSaveStream& Reader, FFlareFactorySave* Data, TArray<FFlareShipyardOrderSave>& LegacyOrders);
+	bool StreamShipyardOrder(const FFlareSaveStream& Reader, FFlareShipyardOrderSave* Data);
+
+
+	bool StreamFleet(const FFlareSaveStream& Reader, FFlareFleetSave* Data);
+	bool StreamTradeRoute(const FFlareSaveStream& Reader, FFlareTradeRouteSave* Data);
+	bool StreamTradeRouteSector(const FFlareSaveStream& Reader, FFlareTradeRouteSectorSave* Data);
+	bool StreamSectorKnowledge(const FFlareSaveStream& Reader, FFlareCompanySectorKnowledge* Data);
+	bool StreamTransactionLogEntry(const FFlareSaveStream& Reader, FFlareTransactionLogEntry* Data);
+
+	bool StreamTransactionLogSummary(const FFlareSaveStream& Reader, FFlareTransactionLogSummary* Data);
+	bool StreamCompanyAI(const FFlareSaveStream& Reader, FFlareCompanyAISave* Data);
+	bool StreamCompanyReputation(const FFlareSaveStream& Reader, FFlareCompanyReputationSave* Data);
+
+
+	bool StreamSector(const FFlareSaveStream& Reader, FFlareSectorSave* Data);
+	bool StreamPeople(const FFlareSaveStream& Reader, FFlarePeopleSave* Data);
+	bool StreamBomb(const FFlareSaveStream& Reader, FFlareBombSave* Data);
+	bool StreamResourcePrice(const FFlareSaveStream& Reader, FFFlareResourcePrice* Data);
+	bool StreamTravel(const FFlareSaveStream& Reader, FFlareTravelSave* Data);
+
 	/*----------------------------------------------------
 	  Loaders
 	----------------------------------------------------*/
 
-	void LoadPlayer(const TSharedPtr<FJsonObject> Object, FFlarePlayerSave* Data);
-	void LoadQuest(const TSharedPtr<FJsonObject> Object, FFlareQuestSave* Data);
-	void LoadQuestProgress(const TSharedPtr<FJsonObject> Object, FFlareQuestProgressSave* Data);
-	void LoadGeneratedQuest(const TSharedPtr<FJsonObject> Object, FFlareGeneratedQuestSave* Data);
+	void LoadPlayer(const TSharedPtr<FJsonObject>& Object, FFlarePlayerSave* Data);
+	void LoadQuest(const TSharedPtr<FJsonObject>& Object, FFlareQuestSave* Data);
+	void LoadQuestProgress(const TSharedPtr<FJsonObject>& Object, FFlareQuestProgressSave* Data);
+	void LoadGeneratedQuest(const TSharedPtr<FJsonObject>& Object, FFlareGeneratedQuestSave* Data);
+
+	void LoadQuestStepProgress(const TSharedPtr<FJsonObject>& Object, FFlareQuestConditionSave* Data);
 
-	void LoadQuestStepProgress(const TSharedPtr<FJsonObject> Object, FFlareQuestConditionSave* Data);
+	void LoadCompanyDescription(const TSharedPtr<FJsonObject>& Object, FFlareCompanyDescription* Data);
+	void LoadWorld(const TSharedPtr<FJsonObject>& Object, FFlareWorldSave* Data);
 
-	void LoadCompanyDescription(const TSharedPtr<FJsonObject> Object, FFlareCompanyDescription* Data);
-	void LoadWorld(const TSharedPtr<FJsonObject> Object, FFlareWorldSave* Data);
 
+	void LoadCompany(const TSharedPtr<FJsonObject>& Object, FFlareCompanySave* Data);
 
-	void LoadCompany(const TSharedPtr<FJsonObject> Object, FFlareCompanySave* Data);
+	void LoadSpacecraft(const TSharedPtr<FJsonObject>& Object, FFlareSpacecraftSave* Data);
+	void LoadPilot(const TSharedPtr<FJsonObject>& Object, FFlareShipPilotSave* Data);
+	void LoadAsteroid(const TSharedPtr<FJsonObject>& Object, FFlareAsteroidSave* Data);
+	void LoadMeteorite(const TSharedPtr<FJsonObject>& Object, FFlareMeteoriteSave* Data);
+	void LoadSpacecraftComponent(const TSharedPtr<FJsonObject>& Object, FFlareSpacecraftComponentSave* Data);
+	void LoadSpacecraftComponentTurret(const TSharedPtr<FJsonObject>& Object, FFlareSpacecraftComponentTurretSave* Data);
+	void LoadSpacecraftComponentWeapon(const TSharedPtr<FJsonObject>& Object, FFlareSpacecraftComponentWeaponSave* Data);
+	void LoadTurretPilot(const TSharedPtr<FJsonObject>& Object, FFlareTurretPilotSave* Data);
+	void LoadStationConnection(const TSharedPtr<FJsonObject>& Object, FFlareConnectionSave* Data);
 
-	void LoadSpacecraft(const TSharedPtr<FJsonObject> Object, FFlareSpacecraftSave* Data);
-	void LoadPilot(const TSharedPtr<FJsonObject> Object, FFlareShipPilotSave* Data);
-	void LoadAsteroid(const TSharedPtr<FJsonObject> Object, FFlareAsteroidSave* Data);
-	void LoadMeteorite(const TSharedPtr<FJsonObject> Object, FFlareMeteoriteSave* Data);
-	void LoadSpacecraftComponent(const TSharedPtr<FJsonObject> Object, FFlareSpacecraftComponentSave* Data);
-	void LoadSpacecraftComponentTurret(const TSharedPtr<FJsonObject> Object, FFlareSpacecraftComponentTurretSave* Data);
-	void LoadSpacecraftComponentWeapon(const TSharedPtr<FJsonObject> Object, FFlareSpacecraftComponentWeaponSave* Data);
-	void LoadTurretPilot(const TSharedPtr<FJsonObject> Object, FFlareTurretPilotSave* Data);
-	void LoadStationConnection(const TSharedPtr<FJsonObject> Object, FFlareConnectionSave* Data);
+	void LoadTradeOperation(const TSharedPtr<FJsonObject>& Object, FFlareTradeRouteSectorOperationSave* Data);
+	void LoadCargo(const TSharedPtr<FJsonObject>& Object, FFlareCargoSave* Data);
+	void LoadFactory(const TSharedPtr<FJsonObject>& Object, FFlareFactorySave* Data, FFlareSpacecraftSave* SpacecraftData);
+	void LoadShipyardOrder(const TSharedPtr<FJsonObject>& Object, FFlareShipyardOrderSave* Data);
 
-	void LoadTradeOperation(const TSharedPtr<FJsonObject> Object, FFlareTradeRouteSectorOperationSave* Data);
-	void LoadCargo(const TSharedPtr<FJsonObject> Object, FFlareCargoSave* Data);
-	void LoadFactory(const TSharedPtr<FJsonObject> Object, FFlareFactorySave* Data, FFlareSpacecraftSave* SpacecraftData);
-	void LoadShipyardOrder(const TSharedPtr<FJsonObject> Object, FFlareShipyardOrderSave* Data);
 
+	void LoadFleet(const TSharedPtr<FJsonObject>& Object, FFlareFleetSave* Data);
+	void LoadTradeRoute(const TSharedPtr<FJsonObject>& Object, FFlareTradeRouteSave* Data);
+	void LoadTradeRouteSector(const TSharedPtr<FJsonObject>& Object, FFlareTradeRouteSectorSave* Data);
+	void LoadSectorKnowledge(const TSharedPtr<FJsonObject>& Object, FFlareCompanySectorKnowledge* Data);
+	void LoadTransactionLogEntry(const TSharedPtr<FJsonObject>& Object, FFlareTransactionLogEntry* Data);
 
-	void LoadFleet(const TSharedPtr<FJsonObject> Object, FFlareFleetSave* Data);
-	void LoadTradeRoute(const TSharedPtr<FJsonObject> Object, FFlareTradeRouteSave* Data);
-	void LoadTradeRouteSector(const TSharedPtr<FJsonObject> Object, FFlareTradeRouteSectorSave* Data);
-	void LoadSectorKnowledge(const TSharedPtr<FJsonObject> Object, FFlareCompanySectorKnowledge* Data);
-	void LoadTransactionLogEntry(const TSharedPtr<FJsonObject> Object, FFlareTransactionLogEntry* Data);
-	void LoadCompanyAI(const TSharedPtr<FJsonObject> Object, FFlareCompanyAISave* Data);
-	void LoadCompanyReputation(const TSharedPtr<FJsonObject> Object, FFlareCompanyReputationSave* Data);
+	void LoadTransactionLogSummary(const TSharedPtr<FJsonObject>& Object, FFlareTransactionLogSummary* Data);
+	void LoadCompanyAI(const TSharedPtr<FJsonObject>& Object, FFlareCompanyAISave* Data);
+	void LoadCompanyReputation(const TSharedPtr<FJsonObject>& Object, FFlareCompanyReputationSave* Data);
 
 
-	void LoadSector(const TSharedPtr<FJsonObject> Object, FFlareSectorSave* Data);
-	void LoadPeople(const TSharedPtr<FJsonObject> Object, FFlarePeopleSave* Data);
-	void LoadBomb(const TSharedPtr<FJsonObject> Object, FFlareBombSave* Data);
-	void LoadResourcePrice(const TSharedPtr<FJsonObject> Object, FFFlareResourcePrice* Data);
-	void LoadTravel(const TSharedPtr<FJsonObject> Object, FFlareTravelSave* Data);
+	void LoadSector(const TSharedPtr<FJsonObject>& Object, FFlareSectorSave* Data);
+	void LoadPeople(const TSharedPtr<FJsonObject>& Object, FFlarePeopleSave* Data);
+	void LoadBomb(const TSharedPtr<FJsonObject>& Object, FFlareBombSave* Data);
+	void LoadResourcePrice(const TSharedPtr<FJsonObject>& Object, FFFlareResourcePrice* Data);
+	void LoadTravel(const TSharedPtr<FJsonObject>& Object, FFlareTravelSave* Data);
 
 	/*----------------------------------------------------
 		Protected data
@@ -78,24 +150,24 @@ public:
 		Getters
 	----------------------------------------------------*/
 
-	void LoadInt32(TSharedPtr< FJsonObject > Object, FString Key, int32* Data, int32 DefaultValue = 0);
-	void LoadInt64(TSharedPtr< FJsonObject > Object, FString Key, int64* Data);
-	void LoadFloat(TSharedPtr< FJsonObject > Object, FString Key, float* Data);
-	void LoadFName(TSharedPtr< FJsonObject > Object, FString Key, FName* Data);
-	void LoadFText(TSharedPtr< FJsonObject > Object, FString Key, FText* Data);
-	void LoadFNameArray(TSharedPtr< FJsonObject > Object, FString Key, TArray<FName>* Data);
-	void LoadFloatArray(TSharedPtr< FJsonObject > Object, FString Key, TArray<float>* Data);
-	void LoadTransform(TSharedPtr< FJsonObject > Object, FString Key, FTransform* Data);
-	bool LoadVector(TSharedPtr< FJsonObject > Object, FString Key, FVector* Data);
-	void LoadRotator(TSharedPtr< FJsonObject > Object, FString Key, FRotator* Data);
-	void LoadFloatBuffer(TSharedPtr< FJsonObject > Object, FString Key, FFlareFloatBuffer* Data);
-	void LoadBundle(const TSharedPtr<FJsonObject> Object, FString Key, FFlareBundle* Data);
+	void LoadInt32(const TSharedPtr< FJsonObject >& Object, const FString& Key, int32* Data, int32 DefaultValue = 0);
+	void LoadInt64(const TSharedPtr< FJsonObject >& Object, const FString& Key, int64* Data);
+	void LoadFloat(const TSharedPtr< FJsonObject >& Object, const FString& Key, float* Data);
+	void LoadFName(const TSharedPtr< FJsonObject >& Object, const FString& Key, FName* Data);
+	void LoadFText(const TSharedPtr< FJsonObject >& Object, const FString& Key, FText* Data);
+	void LoadFNameArray(const TSharedPtr< FJsonObject >& Object, const FString& Key, TArray<FName>* Data);
+	void LoadFloatArray(const TSharedPtr< FJsonObject >& Object, const FString& Key, TArray<float>* Data);
+	void LoadTransform(const TSharedPtr< FJsonObject >& Object, const FString& Key, FTransform* Data);
+	bool LoadVector(const TSharedPtr< FJsonObject >& Object, const FString& Key, FVector* Data);
+	void LoadRotator(const TSharedPtr< FJsonObject >& Object, const FString& Key, FRotator* Data);
+	void LoadFloatBuffer(const TSharedPtr< FJsonObject >& Object, const FString& Key, FFlareFloatBuffer* Data);
+	void LoadBundle(const TSharedPtr<FJsonObject>& Object, const FString& Key, FFlareBundle* Data);
 
 
 
 
 	template <typename EnumType>
-	static FORCEINLINE EnumType LoadEnum(TSharedPtr< FJsonObject > Object, FString Key, const FString& EnumName)
+	static FORCEINLINE EnumType LoadEnum(const TSharedPtr< FJsonObject >& Object, const FString& Key, const FString& EnumName)
 	{
 		FString DataString;
 		if(Object->TryGetStringField(Key, DataString))
@@ -318,6 +318,13 @@ TSharedRef<FJsonObject> UFlareSaveWriter::SaveCompany(FFlareCompanySave* Data)
 	}
 	JsonObject->SetArrayField("TransactionLog", TransactionLog);
 
+	TArray< TSharedPtr<FJsonValue> > TransactionSummaries;
+	for(int i = 0; i < Data->TransactionSummaries.Num(); i++)
+	{
+		TransactionSummaries.Add(MakeShareable(new FJsonValueObject(SaveTransactionLogSummary(&Data->TransactionSummaries[i]))));
+	}
+	JsonObject->SetArrayField("TransactionSummaries", TransactionSummaries);
+
 
 	return JsonObject;
 }
@@ -709,6 +716,26 @@ TSharedRef<FJsonObject> UFlareSaveWriter::SaveTransactionLogEntry(FFlareTransact
 	return JsonObject;
 }
 
+TSharedRef<FJsonObject> UFlareSaveWriter::SaveTransactionLogSummary(FFlareTransactionLogSummary* Data)
+{
+	TSharedRef<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
+
+	JsonObject->SetStringField("Year", FormatInt64(Data->Year));
+
+	FString Amounts;
+	for (int32 Type = 0; Type < Data->Amounts.Num(); Type++)
+	{
+		if (Type > 0)
+		{
+			Amounts += TEXT(",");
+		}
+		Amounts += FormatInt64(Data->Amounts[Type]);
+	}
+	JsonObject->SetStringField("Amounts", Amounts);
+
+	return JsonObject;
+}
+
 TSharedRef<FJsonObject> UFlareSaveWriter::SaveCompanyAI(FFlareCompanyAISave* Data)
 {
 	TSharedRef<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
@@ -91,6 +91,8 @@ protected:
 	TSharedRef<FJsonObject> SaveTradeRouteSector(FFlareTradeRouteSectorSave* Data);
 	TSharedRef<FJsonObject> SaveSectorKnowledge(FFlareCompanySectorKnowledge* Data);
 	TSharedRef<FJsonObject> SaveTransactionLogEntry(FFlareTransactionLogEntry* Data);
+
+	TSharedRef<FJsonObject> SaveTransactionLogSummary(FFlareTransactionLogSummary* Data);
 	TSharedRef<FJsonObject> SaveCompanyAI(FFlareCompanyAISave* Data);
 	TSharedRef<FJsonObject> SaveCompanyReputation(FFlareCompanyReputationSave* Data);
 
@@ -323,19 +323,17 @@ void AFlareCockpitManager::UpdateTarget(float DeltaSeconds)
 	// Lights are enabled on powered ships
 	if (PlayerShipIsPowered())
 	{
-		bool Targeted, FiredUpon, CollidingSoon, ExitingSoon, LowHealth;
-		UFlareSimulatedSpacecraft* Threat;
-		PC->GetPlayerShipThreatStatus(Targeted, FiredUpon, CollidingSoon, ExitingSoon, LowHealth, Threat);
+		const FFlarePlayerThreatStatus& ThreatStatus = PC->GetPlayerShipThreatStatus();
 
 		// Player ship is fired upon
-		if (FiredUpon)
+		if (ThreatStatus.IsFiredUpon)
 		{
 			IndicatorColor = Theme.DamageColor;
 			IndicatorIntensity = 1.0f;
 		}
 
 		// Player ship is being targeted
-		else if (Targeted)
+		else if (ThreatStatus.IsTargeted)
 		{
 			IndicatorColor = Theme.DamageColor;
 			IndicatorIntensity = (CockpitTargetLightTimer > CockpitTargetLightPeriod / 2) ? 1.0f : 0.0f;
@@ -27,6 +27,12 @@
 #include "Engine/Canvas.h"
 #include "Engine/Engine.h"
 
+DECLARE_CYCLE_STAT(TEXT("FlareHUD Designators"), STAT_FlareHUD_Designators, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlareHUD DesignatorCulling"), STAT_FlareHUD_DesignatorCulling, STATGROUP_Flare);
+
+// Frames before the cached icons of an undrawn spacecraft are dropped
+#define HUD_DESIGNATOR_ICONS_LIFETIME 300
+
 
 #define LOCTEXT_NAMESPACE "FlareNavigationHUD"
 
@@ -882,18 +888,16 @@ void AFlareHUD::DrawCockpitTarget(AFlareSpacecraft* PlayerShip)
 		CurrentPos += InstrumentLine;
 
 		// Get player threats
-		bool Targeted, FiredUpon, CollidingSoon, ExitingSoon, LowHealth;
-		UFlareSimulatedSpacecraft* Threat;
-		PC->GetPlayerShipThreatStatus(Targeted, FiredUpon, CollidingSoon, ExitingSoon, LowHealth, Threat);
+		const FFlarePlayerThreatStatus& ThreatStatus = PC->GetPlayerShipThreatStatus();
 
 		// Fired on ?
-		if (FiredUpon)
+		if (ThreatStatus.IsFiredUpon)
 		{
-			if (Threat)
+			if (ThreatStatus.Threat)
 			{
 				FText WarningText = FText::Format(LOCTEXT("ThreatFiredUponFormat", "UNDER FIRE FROM {0} ({1})"),
-					UFlareGameTools::DisplaySpacecraftName(Threat),
-					FText::FromString(Threat->GetCompany()->GetShortName().ToString()));
+					UFlareGameTools::DisplaySpacecraftName(ThreatStatus.Threat),
+					FText::FromString(ThreatStatus.Threat->GetCompany()->GetShortName().ToString()));
 				FlareDrawText(WarningText, CurrentPos, Theme.EnemyColor, false);
 			}
 			else
@@ -904,30 +908,30 @@ void AFlareHUD::DrawCockpitTarget(AFlareSpacecraft* PlayerShip)
 		}
 
 		// Collision ?
-		else if (CollidingSoon)
+		else if (ThreatStatus.CollidingSoon)
 		{
 			FText WarningText = LOCTEXT("ThreatCollisionFormat", "IMMINENT COLLISION");
 			FlareDrawText(WarningText, CurrentPos, Theme.EnemyColor, false);
 		}
 
 		// Leaving sector ?
-		else if (ExitingSoon)
+		else if (ThreatStatus.ExitingSoon)
 		{
 			FText WarningText = LOCTEXT("ThreatLeavingFormat", "LEAVING SECTOR");
 			FlareDrawText(WarningText, CurrentPos, Theme.EnemyColor, false);
 		}
 
 		// Targeted ?
-		else if (Targeted)
+		else if (ThreatStatus.IsTargeted)
 		{
 			FText WarningText = FText::Format(LOCTEXT("ThreatTargetFormat", "TARGETED BY {0} ({1})"),
-				UFlareGameTools::DisplaySpacecraftName(Threat),
-				FText::FromString(Threat->GetCompany()->GetShortName().ToString()));
+				UFlareGameTools::DisplaySpacecraftName(ThreatStatus.Threat),
+				FText::FromString(ThreatStatus.Threat->GetCompany()->GetShortName().ToString()));
 			FlareDrawText(WarningText, CurrentPos, Theme.EnemyColor, false);
 		}
 
 		// Low health
-		else if (LowHealth)
+		else if (ThreatStatus.LowHealth)
 		{
 			FText WarningText = LOCTEXT("ThreatHealthFormat", "LIFE SUPPORT COMPROMISED");
 			FlareDrawText(WarningText, CurrentPos, Theme.EnemyColor, false);
@@ -1167,29 +1171,38 @@ void AFlareHUD::DrawHUDInternal()
 	// Draw docking helper
 	DrawDockingHelper();
 
-	// Iterate on all 'other' ships to show designators, markings, etc
-	for (int SpacecraftIndex = 0; SpacecraftIndex < ActiveSector->GetSpacecrafts().Num(); SpacecraftIndex ++)
+	// Draw designators for all 'other' ships, grouped by texture
 	{
-		AFlareSpacecraft* Spacecraft = ActiveSector->GetSpacecrafts()[SpacecraftIndex];
-		if (Spacecraft != PlayerShip && !Spacecraft->IsComplexElement())
+		SCOPE_CYCLE_COUNTER(STAT_FlareHUD_Designators);
+
+		UpdateHUDDesignators(PC, PlayerShip, ActiveSector);
+		for (const FFlareHUDDesignator& Designator : Designators)
 		{
-			// Draw designators
-			bool ShouldDrawSearchMarker = DrawHUDDesignator(Spacecraft);
-						
-			// Get more info
-			bool Highlighted = (PlayerShip && PlayerShip->GetCurrentTarget().Is(Spacecraft));
-			bool IsObjective = (PC->GetCurrentObjective() && PC->GetCurrentObjective()->TargetSpacecrafts.Find(Spacecraft->GetParent()) != INDEX_NONE);
-
-			// Draw search markers for alive ships or highlighted stations when not in external camera
-			if (!IsExternalCamera && ShouldDrawSearchMarker
-				&& PlayerShip->GetParent()->GetDamageSystem()->IsAlive()
-				&& Spacecraft->GetParent()->GetDamageSystem()->IsAlive()
-				&& (Highlighted || IsObjective || !Spacecraft->IsStation())
-			)
+			if (Designator.InViewport)
 			{
-				DrawSearchArrow(Spacecraft->GetActorLocation(), GetHostilityColor(PC, Spacecraft), Highlighted, FocusDistance);
+				DrawHUDDesignator(Designator);
 			}
 		}
+		FlushHUDDesignatorTiles();
+	}
+
+	// Draw target helpers and search markers
+	for (const FFlareHUDDesignator& Designator : Designators)
+	{
+		if (Designator.Highlighted)
+		{
+			DrawHUDDesignatorTargetHelper(Designator);
+		}
+
+		// Draw search markers for alive ships or highlighted stations when not in external camera
+		bool ShouldDrawSearchMarker = (!Designator.ScreenPositionValid || !IsInScreen(Designator.ScreenPosition));
+		if (!IsExternalCamera && ShouldDrawSearchMarker
+			&& PlayerShip->GetParent()->GetDamageSystem()->IsAlive()
+			&& (Designator.Highlighted || Designator.IsObjective || !Designator.Spacecraft->IsStation())
+		)
+		{
+			DrawSearchArrow(Designator.Spacecraft->GetActorLocation(), Designator.Color, Designator.Highlighted, FocusDistance);
+		}
 	}
 
 	// Draw inertial vectors
@@ -1590,133 +1603,206 @@ void AFlareHUD::DrawSearchArrow(FVector TargetLocation, FLinearColor Color, bool
 	}
 }
 
-bool AFlareHUD::DrawHUDDesignator(AFlareSpacecraft* Spacecraft)
+void AFlareHUD::UpdateHUDDesignators(AFlarePlayerController* PC, AFlareSpacecraft* PlayerShip, UFlareSector* ActiveSector)
 {
-	// Calculation data
-	FVector2D ScreenPosition;
-	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
-	FVector PlayerLocation = PC->GetShipPawn()->GetActorLocation();
-	FVector TargetLocation = Spacecraft->GetActorLocation();
-	bool ScreenPositionValid = false;
+	SCOPE_CYCLE_COUNTER(STAT_FlareHUD_DesignatorCulling);
+
+	Designators.Reset();
 
-	if (ProjectWorldLocationToCockpit(TargetLocation, ScreenPosition) && Spacecraft != ContextMenuSpacecraft)
+	// Camera data, shared by all designators
+	const FFlarePlayerObjectiveData* Objective = PC->GetCurrentObjective();
+	FVector PlayerLocation = PlayerShip->GetActorLocation();
+	FVector CameraLocation = PlayerShip->GetCamera()->GetComponentLocation();
+	FVector CameraAimDirection = PlayerShip->GetCamera()->GetComponentRotation().Vector().GetSafeNormal();
+	float FOV = PC->PlayerCameraManager->GetFOVAngle();
+	float CornerSize = 8;
+
+	auto IsInViewport = [&](FVector2D Min, FVector2D Max)
 	{
-		ScreenPositionValid = true;
+		return (Max.X > 0 && Min.X < CurrentViewportSize.X && Max.Y > 0 && Min.Y < CurrentViewportSize.Y);
+	};
 
-		// Compute apparent size in screenspace
-		float ShipSize = 2 * Spacecraft->GetMeshScale();
-		float Distance = (TargetLocation - PlayerLocation).Size();
-		float ApparentAngle = FMath::RadiansToDegrees(FMath::Atan(ShipSize / Distance));
-		float Size = (ApparentAngle / PC->PlayerCameraManager->GetFOVAngle()) * CurrentViewportSize.X;
-		FVector2D ObjectSize = FMath::Min(0.66f * Size, 300.0f) * FVector2D(1, 1);
+	for (AFlareSpacecraft* Spacecraft : ActiveSector->GetSpacecrafts())
+	{
+		if (Spacecraft == PlayerShip || Spacecraft->IsComplexElement() || !Spacecraft->GetParent()->GetDamageSystem()->IsAlive())
+		{
+			continue;
+		}
 
-		// Draw the HUD designator
-		if (Spacecraft->GetParent()->GetDamageSystem()->IsAlive())
+		FFlareHUDDesignator Designator;
+		Designator.Spacecraft = Spacecraft;
+		Designator.Highlighted = PlayerShip->GetCurrentTarget().Is(Spacecraft);
+		Designator.IsObjective = (Objective && Objective->TargetSpacecrafts.Find(Spacecraft->GetParent()) != INDEX_NONE);
+		Designator.Color = Designator.IsObjective ? HudColorObjective : GetHostilityColor(PC, Spacecraft);
+		Designator.ScreenPosition = FVector2D::ZeroVector;
+		Designator.ObjectSize = FVector2D::ZeroVector;
+		Designator.ScreenPositionValid = false;
+		Designator.InViewport = false;
+
+		FVector TargetLocation = Spacecraft->GetActorLocation();
+		Designator.Distance = (TargetLocation - PlayerLocation).Size();
+
+		// Same view cone as ProjectWorldLocationToCockpit, with the camera data computed once
+		FVector SpacecraftDirection = (TargetLocation - CameraLocation).GetSafeNormal();
+		FVector2D Screen;
+		if (Spacecraft != ContextMenuSpacecraft
+		 && FVector::DotProduct(CameraAimDirection, SpacecraftDirection) >= 0.3f
+		 && PC->ProjectWorldLocationToScreen(TargetLocation, Screen))
 		{
-			float CornerSize = 8;
-			AFlareSpacecraft* PlayerShip = PC->GetShipPawn();
-			FVector2D CenterPos = ScreenPosition - ObjectSize / 2;
-			FLinearColor Color = GetHostilityColor(PC, Spacecraft);
-
-			// Draw designator corners
-			bool Highlighted = (PlayerShip && PlayerShip->GetCurrentTarget().Is(Spacecraft));
-			bool Dangerous = PilotHelper::IsTargetDangerous(PilotHelper::PilotTarget(Spacecraft));
-			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, -1), 0,     Color, Dangerous, Highlighted);
-			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, +1), -90,   Color, Dangerous, Highlighted);
-			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(+1, +1), -180,  Color, Dangerous, Highlighted);
-			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(+1, -1), -270,  Color, Dangerous, Highlighted);
-
-			// Draw the target's distance if selected
-			if (PlayerShip->GetCurrentTarget().Is(Spacecraft))
+			Designator.ScreenPositionValid = true;
+			Designator.ScreenPosition = (CurrentViewportSize / ViewportSize) * Screen;
+
+			// Compute apparent size in screenspace from the cached mesh bounds
+			float ShipSize = 2 * Spacecraft->GetMeshScale();
+			float ApparentAngle = FMath::RadiansToDegrees(FMath::Atan(ShipSize / Designator.Distance));
+			float Size = (ApparentAngle / FOV) * CurrentViewportSize.X;
+			Designator.ObjectSize = FMath::Min(0.66f * Size, 300.0f) * FVector2D(1, 1);
+
+			// Skip the designator block if neither the corners nor the icon row can overlap the viewport
+			FVector2D CornerExtent = Designator.ObjectSize / 2 + 2 * CornerSize * FVector2D::UnitVector;
+			Designator.InViewport = IsInViewport(Designator.ScreenPosition - CornerExtent, Designator.ScreenPosition + CornerExtent);
+			if (!Designator.InViewport)
 			{
-				FText DistanceText = FormatDistance(Distance / 100);
-				FVector2D DistanceTextPosition = ScreenPosition - (CurrentViewportSize / 2)
-					+ FVector2D(-ObjectSize.X / 2, ObjectSize.Y / 2)
-					+ FVector2D(2 * CornerSize, 3 * CornerSize);
-				FlareDrawText(DistanceText, DistanceTextPosition, Color);
+				// Same layout as DrawHUDDesignator, status icons included
+				const FFlareHUDDesignatorIcons& Icons = GetHUDDesignatorIcons(Spacecraft, Designator.IsObjective);
+				int32 NumberOfIcons = Spacecraft->GetParent()->IsMilitary() ? 3 : 2;
+				FVector2D RowMin = Designator.ScreenPosition + FVector2D(-0.5 * NumberOfIcons * IconSize, -Designator.ObjectSize.Y / 2 - IconSize - 0.5 * CornerSize);
+				FVector2D RowSize = FVector2D((Icons.HintIcons.Num() + Icons.StatusIcons.Num()) * IconSize, IconSize);
+				Designator.InViewport = IsInViewport(RowMin, RowMin + RowSize);
 			}
+		}
 
-			// Prepare icon layout
-			FVector2D StatusPos = CenterPos;
-			int32 NumberOfIcons = Spacecraft->GetParent()->IsMilitary() ? 3 : 2;
-			StatusPos.X += 0.5 * (ObjectSize.X - NumberOfIcons * IconSize);
-			StatusPos.Y -= (IconSize + 0.5 * CornerSize);
+		Designators.Add(Designator);
+	}
 
-			// Draw the status for close targets or highlighted
-			FVector2D TempPos = DrawHUDDesignatorHint(StatusPos, IconSize, Spacecraft, Color);
-			if (!Spacecraft->GetParent()->IsStation() && (ObjectSize.X > 0.15 * IconSize || Highlighted))
-			{
-				DrawHUDDesignatorStatus(TempPos, IconSize, Spacecraft);
-			}
+	// Forget the icons of spacecrafts that were destroyed or not drawn recently
+	for (auto It = DesignatorIcons.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Spacecraft.IsValid() || It.Value().LastUsedFrame + HUD_DESIGNATOR_ICONS_LIFETIME < GFrameCounter)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void AFlareHUD::DrawHUDDesignator(const FFlareHUDDesignator& Designator)
+{
+	AFlareSpacecraft* Spacecraft = Designator.Spacecraft;
+	FVector2D ScreenPosition = Designator.ScreenPosition;
+	FVector2D ObjectSize = Designator.ObjectSize;
+	FLinearColor Color = Designator.Color;
+	const FFlareHUDDesignatorIcons& Icons = GetHUDDesignatorIcons(Spacecraft, Designator.IsObjective);
+
+	float CornerSize = 8;
+	FVector2D CenterPos = ScreenPosition - ObjectSize / 2;
+
+	// Draw designator corners
+	DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, -1), 0,     Color, Icons.Dangerous, Designator.Highlighted);
+	DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, +1), -90,   Color, Icons.Dangerous, Designator.Highlighted);
+	DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(+1, +1), -180,  Color, Icons.Dangerous, Designator.Highlighted);
+	DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(+1, -1), -270,  Color, Icons.Dangerous, Designator.Highlighted);
+
+	// Prepare icon layout
+	FVector2D StatusPos = CenterPos;
+	int32 NumberOfIcons = Spacecraft->GetParent()->IsMilitary() ? 3 : 2;
+	StatusPos.X += 0.5 * (ObjectSize.X - NumberOfIcons * IconSize);
+	StatusPos.Y -= (IconSize + 0.5 * CornerSize);
+
+	// Draw the hints
+	for (UTexture2D* Icon : Icons.HintIcons)
+	{
+		DesignatorTiles.Add(FFlareHUDDesignatorTile(Icon, StatusPos, IconSize, 0, Color));
+		StatusPos.X += IconSize;
+	}
+
+	// Draw the status for close targets or highlighted
+	if (!Spacecraft->GetParent()->IsStation() && (ObjectSize.X > 0.15 * IconSize || Designator.Highlighted))
+	{
+		const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
+		FLinearColor DamageColor = Theme.DamageColor;
+		DamageColor.A = Theme.DefaultAlpha;
+
+		for (UTexture2D* Icon : Icons.StatusIcons)
+		{
+			DesignatorTiles.Add(FFlareHUDDesignatorTile(Icon, StatusPos, IconSize, 0, DamageColor));
+			StatusPos.X += IconSize;
 		}
 	}
+}
+
+void AFlareHUD::DrawHUDDesignatorTargetHelper(const FFlareHUDDesignator& Designator)
+{
+	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
+	AFlareSpacecraft* PlayerShip = PC->GetShipPawn();
+	AFlareSpacecraft* Spacecraft = Designator.Spacecraft;
+	FVector2D ScreenPosition = Designator.ScreenPosition;
+	bool ScreenPositionValid = Designator.ScreenPositionValid;
+
+	if (Spacecraft == ContextMenuSpacecraft)
+	{
+		return;
+	}
 
-	if (Spacecraft != ContextMenuSpacecraft && Spacecraft->GetParent()->GetDamageSystem()->IsAlive())
+	// Draw the target's distance
+	if (ScreenPositionValid)
 	{
-		AFlareSpacecraft* PlayerShip = PC->GetShipPawn();
-		float Distance = (TargetLocation - PlayerLocation).Size();
+		float CornerSize = 8;
+		FText DistanceText = FormatDistance(Designator.Distance / 100);
+		FVector2D DistanceTextPosition = ScreenPosition - (CurrentViewportSize / 2)
+			+ FVector2D(-Designator.ObjectSize.X / 2, Designator.ObjectSize.Y / 2)
+			+ FVector2D(2 * CornerSize, 3 * CornerSize);
+		FlareDrawText(DistanceText, DistanceTextPosition, Designator.Color);
+	}
 
-		// Combat helper
-		if (PlayerShip->GetCurrentTarget().Is(Spacecraft)
-		 && PlayerShip && PlayerShip->GetWeaponsSystem()->GetActiveWeaponType() != EFlareWeaponGroupType::WG_NONE)
+	// Combat helper
+	if (PlayerShip->GetWeaponsSystem()->GetActiveWeaponType() != EFlareWeaponGroupType::WG_NONE)
+	{
+		FFlareWeaponGroup* WeaponGroup = PlayerShip->GetWeaponsSystem()->GetActiveWeaponGroup();
+		if (WeaponGroup)
 		{
-			FFlareWeaponGroup* WeaponGroup = PlayerShip->GetWeaponsSystem()->GetActiveWeaponGroup();
-			if (WeaponGroup)
+			FVector2D HelperScreenPosition;
+			FVector AmmoIntersectionLocation;
+			float AmmoVelocity = WeaponGroup->Weapons[0]->GetAmmoVelocity();
+			float Range = WeaponGroup->Weapons[0]->GetDescription()->WeaponCharacteristics.GunCharacteristics.AmmoRange;
+			float AmmoLifeTime = Range / AmmoVelocity;
+			float InterceptTime = PilotHelper::PilotTarget(Spacecraft).GetAimPosition(PlayerShip, AmmoVelocity, 0.0, &AmmoIntersectionLocation);
+
+			if (InterceptTime > 0 && ProjectWorldLocationToCockpit(AmmoIntersectionLocation, HelperScreenPosition) && (Range == 0 || InterceptTime < AmmoLifeTime))
 			{
-				FVector2D HelperScreenPosition;
-				FVector AmmoIntersectionLocation;
-				float AmmoVelocity = WeaponGroup->Weapons[0]->GetAmmoVelocity();
-				float Range = WeaponGroup->Weapons[0]->GetDescription()->WeaponCharacteristics.GunCharacteristics.AmmoRange;
-				float AmmoLifeTime = Range / AmmoVelocity;
-				float InterceptTime = PilotHelper::PilotTarget(Spacecraft).GetAimPosition(PlayerShip, AmmoVelocity, 0.0, &AmmoIntersectionLocation);
+				FLinearColor HUDAimHelperColor = Designator.Color;
 
-				if (InterceptTime > 0 && ProjectWorldLocationToCockpit(AmmoIntersectionLocation, HelperScreenPosition) && (Range == 0 || InterceptTime < AmmoLifeTime))
+				// Draw aiming helper for ships
+				if (!Spacecraft->IsStation())
 				{
-					FLinearColor HUDAimHelperColor = GetHostilityColor(PC, Spacecraft);
-
-					// Draw aiming helper for ships
-					if (!Spacecraft->IsStation())
+					DrawHUDIcon(HelperScreenPosition, IconSize, HUDAimHelperIcon, HUDAimHelperColor, true);
+					if (ScreenPositionValid)
 					{
-						DrawHUDIcon(HelperScreenPosition, IconSize, HUDAimHelperIcon, HUDAimHelperColor, true);
-						if (ScreenPositionValid)
-						{
-							FlareDrawLine(ScreenPosition, HelperScreenPosition, HUDAimHelperColor);
-						}
+						FlareDrawLine(ScreenPosition, HelperScreenPosition, HUDAimHelperColor);
 					}
+				}
 
-					// Snip helpers
-					float ZoomAlpha = PC->GetShipPawn()->GetStateManager()->GetCombatZoomAlpha();
-					if (ScreenPositionValid && !Spacecraft->IsStation() && Spacecraft->GetSize() == EFlarePartSize::L && ZoomAlpha > 0
-						&& PlayerShip->GetWeaponsSystem()->GetActiveWeaponType() == EFlareWeaponGroupType::WG_GUN)
-					{
-						FVector2D AimOffset = ScreenPosition - HelperScreenPosition;
-						UTexture2D* NoseIcon = (HasPlayerHit) ? HUDAimHitIcon : HUDAimIcon;
+				// Snip helpers
+				float ZoomAlpha = PlayerShip->GetStateManager()->GetCombatZoomAlpha();
+				if (ScreenPositionValid && !Spacecraft->IsStation() && Spacecraft->GetSize() == EFlarePartSize::L && ZoomAlpha > 0
+					&& PlayerShip->GetWeaponsSystem()->GetActiveWeaponType() == EFlareWeaponGroupType::WG_GUN)
+				{
+					FVector2D AimOffset = ScreenPosition - HelperScreenPosition;
+					UTexture2D* NoseIcon = (HasPlayerHit) ? HUDAimHitIcon : HUDAimIcon;
 
-						DrawHUDIcon(AimOffset + CurrentViewportSize / 2, IconSize *0.75 , NoseIcon, HUDAimHelperColor, true);
-					}
-					
-					// Bomber UI (time display)
-					EFlareWeaponGroupType::Type WeaponType = PlayerShip->GetWeaponsSystem()->GetActiveWeaponType();
-					if (WeaponType == EFlareWeaponGroupType::WG_BOMB)
-					{
-						FText TimeText = FText::FromString(FString::FromInt(InterceptTime) + FString(".") + FString::FromInt( (InterceptTime - (int) InterceptTime ) *10) + FString(" s"));
-						FVector2D TimePosition = ScreenPosition - CurrentViewportSize / 2 - FVector2D(42,0);
-						FlareDrawText(TimeText, TimePosition, HUDAimHelperColor);
-					}
+					DrawHUDIcon(AimOffset + CurrentViewportSize / 2, IconSize *0.75 , NoseIcon, HUDAimHelperColor, true);
+				}
+				
+				// Bomber UI (time display)
+				EFlareWeaponGroupType::Type WeaponType = PlayerShip->GetWeaponsSystem()->GetActiveWeaponType();
+				if (WeaponType == EFlareWeaponGroupType::WG_BOMB)
+				{
+					FText TimeText = FText::FromString(FString::FromInt(InterceptTime) + FString(".") + FString::FromInt( (InterceptTime - (int) InterceptTime ) *10) + FString(" s"));
+					FVector2D TimePosition = ScreenPosition - CurrentViewportSize / 2 - FVector2D(42,0);
+					FlareDrawText(TimeText, TimePosition, HUDAimHelperColor);
 				}
 			}
 		}
 	}
-
-	// Tell the HUD to draw the search marker only if we are outside this
-	if (ScreenPositionValid)
-	{
-		return !IsInScreen(ScreenPosition);
-	}
-	else
-	{
-		return true;
-	}
 }
 
 void AFlareHUD::DrawHUDDesignatorCorner(FVector2D Position, FVector2D ObjectSize, float DesignatorIconSize, FVector2D MainOffset, float Rotation, FLinearColor HudColor, bool Dangerous, bool Highlighted)
@@ -1734,71 +1820,131 @@ void AFlareHUD::DrawHUDDesignatorCorner(FVector2D Position, FVector2D ObjectSize
 		Texture = HUDDesignatorMilCornerTexture;
 	}
 
-	FlareDrawTexture(Texture,
+	FVector2D CornerPosition(
 		Position.X + (ObjectSize.X + DesignatorIconSize) * MainOffset.X / 2,
-		Position.Y + (ObjectSize.Y + DesignatorIconSize) * MainOffset.Y / 2,
-		ScaledDesignatorIconSize, ScaledDesignatorIconSize, 0, 0, 1, 1,
-		HudColor,
-		BLEND_Translucent, 1.0f, false,
-		Rotation);
+		Position.Y + (ObjectSize.Y + DesignatorIconSize) * MainOffset.Y / 2);
+	DesignatorTiles.Add(FFlareHUDDesignatorTile(Texture, CornerPosition, ScaledDesignatorIconSize, Rotation, HudColor));
 }
 
-FVector2D AFlareHUD::DrawHUDDesignatorHint(FVector2D Position, float DesignatorIconSize, AFlareSpacecraft* TargetSpacecraft, FLinearColor Color)
+void AFlareHUD::FlushHUDDesignatorTiles()
 {
-	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
+	// The canvas merges consecutive tiles sharing a texture into a single batch
+	DesignatorTiles.StableSort([](const FFlareHUDDesignatorTile& A, const FFlareHUDDesignatorTile& B)
+	{
+		return A.Texture < B.Texture;
+	});
+
+	for (const FFlareHUDDesignatorTile& Tile : DesignatorTiles)
+	{
+		FlareDrawTexture(Tile.Texture, Tile.Position.X, Tile.Position.Y, Tile.Size, Tile.Size, 0, 0, 1, 1,
+			Tile.Color,
+			BLEND_Translucent, 1.0f, false,
+			Tile.Rotation);
+	}
+
+	DesignatorTiles.Reset();
+}
+
+const FFlareHUDDesignatorIcons& AFlareHUD::GetHUDDesignatorIcons(AFlareSpacecraft* Ship, bool IsObjective)
+{
+	UFlareSimulatedSpacecraft* Parent = Ship->GetParent();
+	int32 DamageRevision = Parent->GetDamageSystem()->GetDamageRevision();
+
+	// Cheap state that the damage revision doesn't track
+	uint32 StateFlags = (IsObjective ? 1 : 0)
+		| (Parent->IsHarpooned() ? 2 : 0)
+		| (Ship->IsStation() && Parent->IsUnderConstruction(true) ? 4 : 0)
+		| (Ship->IsOutsideSector() ? 8 : 0);
 
-	if (PC->GetCurrentObjective() && PC->GetCurrentObjective()->TargetSpacecrafts.Find(TargetSpacecraft->GetParent()) != INDEX_NONE)
+	FFlareHUDDesignatorIcons* Icons = DesignatorIcons.Find(Ship);
+	if (!Icons || Icons->Spacecraft.Get() != Ship)
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDContractIcon, Color);
+		Icons = &DesignatorIcons.Add(Ship);
+		Icons->Spacecraft = Ship;
+		Icons->DamageRevision = DamageRevision - 1;
+	}
+
+	// Regenerate icons only when the ship's state changed
+	if (Icons->DamageRevision != DamageRevision || Icons->StateFlags != StateFlags)
+	{
+		Icons->DamageRevision = DamageRevision;
+		Icons->StateFlags = StateFlags;
+		Icons->Dangerous = PilotHelper::IsTargetDangerous(PilotHelper::PilotTarget(Ship));
+
+		Icons->HintIcons.Reset();
+		GetHUDDesignatorHintIcons(Ship, IsObjective, Icons->HintIcons);
+
+		Icons->StatusIcons.Reset();
+		GetHUDDesignatorStatusIcons(Ship, Icons->StatusIcons);
+	}
+
+	Icons->LastUsedFrame = GFrameCounter;
+	return *Icons;
+}
+
+void AFlareHUD::GetHUDDesignatorHintIcons(AFlareSpacecraft* TargetSpacecraft, bool IsObjective, TArray<UTexture2D*>& Icons)
+{
+	if (IsObjective)
+	{
+		Icons.Add(HUDContractIcon);
 	}
 
 	if (TargetSpacecraft->IsStation() && TargetSpacecraft->GetParent()->IsUnderConstruction(true))
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDConstructionIcon, Color);
+		Icons.Add(HUDConstructionIcon);
 	}
 	
 	if (TargetSpacecraft->GetParent()->IsShipyard())
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDShipyardIcon, Color);
+		Icons.Add(HUDShipyardIcon);
 	}
 	else if (TargetSpacecraft->GetParent()->HasCapability(EFlareSpacecraftCapability::Upgrade))
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDUpgradeIcon, Color);
+		Icons.Add(HUDUpgradeIcon);
 	}
 
 	if (TargetSpacecraft->IsStation() && TargetSpacecraft->GetParent()->HasCapability(EFlareSpacecraftCapability::Consumer))
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDConsumerIcon, Color);
+		Icons.Add(HUDConsumerIcon);
 	}
-
-	return Position;
 }
 
-FVector2D AFlareHUD::DrawHUDDesignatorStatus(FVector2D Position, float DesignatorIconSize, AFlareSpacecraft* Ship)
+void AFlareHUD::GetHUDDesignatorStatusIcons(AFlareSpacecraft* Ship, TArray<UTexture2D*>& Icons)
 {
 	UFlareSimulatedSpacecraftDamageSystem* DamageSystem = Ship->GetParent()->GetDamageSystem();
-	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
-	FLinearColor Color = Theme.DamageColor;
-	Color.A = FFlareStyleSet::GetDefaultTheme().DefaultAlpha;
 
 	if (DamageSystem->IsStranded())
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDPropulsionIcon, Color);
+		Icons.Add(HUDPropulsionIcon);
 	}
 
 	if (DamageSystem->IsUncontrollable())
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDRCSIcon, Color);
+		Icons.Add(HUDRCSIcon);
 	}
 
 	if (Ship->GetParent()->IsMilitary() && DamageSystem->IsDisarmed())
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDWeaponIcon, Color);
+		Icons.Add(HUDWeaponIcon);
 	}
 
 	if (Ship->GetParent()->IsHarpooned() && Ship->GetParent()->GetCompany()->GetPlayerHostility() != EFlareHostility::Owned)
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDHarpoonedIcon, Color);
+		Icons.Add(HUDHarpoonedIcon);
+	}
+}
+
+FVector2D AFlareHUD::DrawHUDDesignatorStatus(FVector2D Position, float DesignatorIconSize, AFlareSpacecraft* Ship)
+{
+	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
+	FLinearColor Color = Theme.DamageColor;
+	Color.A = FFlareStyleSet::GetDefaultTheme().DefaultAlpha;
+
+	TArray<UTexture2D*> Icons;
+	GetHUDDesignatorStatusIcons(Ship, Icons);
+	for (UTexture2D* Icon : Icons)
+	{
+		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, Icon, Color);
 	}
 
 	return Position;
@@ -12,6 +12,52 @@ class SFlareContextMenu;
 class SFlareMouseMenu;
 class UFlareWeapon;
 class UCanvasRenderTarget2D;
+class UFlareSector;
+
+
+/** Visible designator, built by the HUD visibility pass */
+struct FFlareHUDDesignator
+{
+	AFlareSpacecraft*                       Spacecraft;
+	FVector2D                               ScreenPosition;
+	FVector2D                               ObjectSize;
+	FLinearColor                            Color;
+	float                                   Distance;
+	bool                                    ScreenPositionValid;
+	bool                                    InViewport;
+	bool                                    Highlighted;
+	bool                                    IsObjective;
+};
+
+/** Cached designator icons for a spacecraft */
+struct FFlareHUDDesignatorIcons
+{
+	TWeakObjectPtr<AFlareSpacecraft>        Spacecraft;
+	int32                                   DamageRevision;
+	uint32                                  StateFlags;
+	uint64                                  LastUsedFrame;
+	bool                                    Dangerous;
+	TArray<UTexture2D*>                     HintIcons;
+	TArray<UTexture2D*>                     StatusIcons;
+};
+
+/** Designator texture waiting to be drawn */
+struct FFlareHUDDesignatorTile
+{
+	UTexture2D*                             Texture;
+	FVector2D                               Position;
+	float                                   Size;
+	float                                   Rotation;
+	FLinearColor                            Color;
+
+	FFlareHUDDesignatorTile(UTexture2D* InTexture, FVector2D InPosition, float InSize, float InRotation, FLinearColor InColor)
+		: Texture(InTexture)
+		, Position(InPosition)
+		, Size(InSize)
+		, Rotation(InRotation)
+		, Color(InColor)
+	{}
+};
 
 
 /** Navigation HUD */
@@ -137,18 +183,33 @@ protected:
 	/** Draw a search arrow */
 	void DrawSearchArrow(FVector TargetLocation, FLinearColor Color, bool Highlighted, float MaxDistance = 10000000);
 
-	/** Draw a designator block around a spacecraft */
-	bool DrawHUDDesignator(AFlareSpacecraft* Spacecraft);
+	/** Cull spacecrafts and fill the designator list for this frame */
+	void UpdateHUDDesignators(AFlarePlayerController* PC, AFlareSpacecraft* PlayerShip, UFlareSector* ActiveSector);
+
+	/** Queue the designator block around a spacecraft */
+	void DrawHUDDesignator(const FFlareHUDDesignator& Designator);
+
+	/** Draw the aiming helpers for the current target */
+	void DrawHUDDesignatorTargetHelper(const FFlareHUDDesignator& Designator);
 
-	/** Draw a designator corner */
+	/** Queue a designator corner */
 	void DrawHUDDesignatorCorner(FVector2D Position, FVector2D ObjectSize, float IconSize, FVector2D MainOffset, float Rotation, FLinearColor HudColor, bool Dangerous, bool Highlighted);
 
+	/** Draw all queued designator textures, grouped by texture */
+	void FlushHUDDesignatorTiles();
+
+	/** Get the cached hint and status icons for a ship, updated when its state changes */
+	const FFlareHUDDesignatorIcons& GetHUDDesignatorIcons(AFlareSpacecraft* Ship, bool IsObjective);
+
+	/** Get the status icons for a ship */
+	void GetHUDDesignatorStatusIcons(AFlareSpacecraft* Ship, TArray<UTexture2D*>& Icons);
+
+	/** Get the hint icons for a ship */
+	void GetHUDDesignatorHintIcons(AFlareSpacecraft* Ship, bool IsObjective, TArray<UTexture2D*>& Icons);
+
 	/** Draw a status block for the ship */
 	FVector2D DrawHUDDesignatorStatus(FVector2D Position, float IconSize, AFlareSpacecraft* Ship);
 
-	/** Draw a hint block for the ship */
-	FVector2D DrawHUDDesignatorHint(FVector2D Position, float IconSize, AFlareSpacecraft* Ship, FLinearColor Color);
-
 	/** Draw a docking helper around the current best target */
 	void DrawDockingHelper();
 
@@ -265,6 +326,11 @@ protected:
 	UTexture2D*                             HUDDockingForbiddenTexture;
 	UTexture2D*                             HUDDockingMonitorIcon;
 
+	// Designators
+	TArray<FFlareHUDDesignator>             Designators;
+	TArray<FFlareHUDDesignatorTile>         DesignatorTiles;
+	TMap<AFlareSpacecraft*, FFlareHUDDesignatorIcons> DesignatorIcons;
+
 	// Ship status content
 	UTexture2D*                             HUDTemperatureIcon;
 	UTexture2D*                             HUDPowerIcon;
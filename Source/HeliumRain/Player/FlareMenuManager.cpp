@@ -479,6 +479,10 @@ bool AFlareMenuManager::Notify(FText Text, FText Info, FName Tag, EFlareNotifica
 		{
 			OrbitMenu->RequestStopFastForward();
 		}
+		else if (UFlareGameTools::FastFastForward)
+		{
+			OrbitMenu->RequestEndFastForwardBatch();
+		}
 		return Notifier->Notify(Text, Info, Tag, Type, Pinned, TargetMenu, TargetInfo);
 	}
 	return false;
@@ -46,12 +46,18 @@
 DECLARE_CYCLE_STAT(TEXT("FlarePlayerTick ControlGroups"), STAT_FlarePlayerTick_ControlGroups, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlarePlayerTick Battle"), STAT_FlarePlayerTick_Battle, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlarePlayerTick Sound"), STAT_FlarePlayerTick_Sound, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlarePlayer Threats"), STAT_FlarePlayer_Threats, STATGROUP_Flare);
 
 #define LOCTEXT_NAMESPACE "AFlarePlayerController"
 
 #define SCANNABLES_RESEARCH_GAIN_A 0.2f
 #define SCANNABLES_RESEARCH_GAIN_B 9.8f
 
+// Minimum time between two threat assessments, 0 to assess every frame
+#define THREAT_ASSESSMENT_PERIOD 0.0f
+#define THREAT_SMALL_SHIP_DISTANCE 250000
+#define THREAT_LARGE_SHIP_DISTANCE 500000
+
 /*----------------------------------------------------
 	Constructor
 ----------------------------------------------------*/
@@ -111,6 +117,12 @@ AFlarePlayerController::AFlarePlayerController(const class FObjectInitializer& P
 	HasCurrentObjective = false;
 	RightMousePressed = false;
 	LastBattleState.Init();
+	ThreatStatusFrame = 0;
+	ThreatStatusTime = 0;
+	ThreatCandidatesShip = NULL;
+	ThreatCandidatesSector = NULL;
+	ThreatCheckFrames = 0;
+	ThreatCheckMismatches = 0;
 
 	// Setup
 	ShipPawn = NULL;
@@ -569,6 +581,9 @@ void AFlarePlayerController::OnSectorDeactivated()
 
 	// Reset states
 	LastBattleState.Init();
+	ThreatCandidates.Empty();
+	ThreatCandidatesShip = NULL;
+	ThreatCandidatesSector = NULL;
 }
 
 void AFlarePlayerController::UpdateMusicTrack(FFlareSectorBattleState NewBattleState)
@@ -720,6 +735,7 @@ void AFlarePlayerController::Clean()
 
 	LastBattleState.Init();
 	LastSectorBattleStates.Empty();
+	LastSectorBattleStateVersions.Empty();
 
 	MenuManager->FlushNotifications();
 	MenuManager->ClearHistory();
@@ -1116,18 +1132,20 @@ bool AFlarePlayerController::SwitchToNextShip(bool Instant)
 	return false;
 }
 
-void AFlarePlayerController::GetPlayerShipThreatStatus(bool& IsTargeted, bool& IsFiredUpon, bool& CollidingSoon, bool& ExitingSoon, bool& LowHealth, UFlareSimulatedSpacecraft*& Threat) const
+const FFlarePlayerThreatStatus& AFlarePlayerController::GetPlayerShipThreatStatus() const
 {
-	IsTargeted = false;
-	IsFiredUpon = false;
-	Threat = NULL;
+	if (ThreatStatusFrame != GFrameCounter)
+	{
+		AFlarePlayerController* UnprotectedThis = const_cast<AFlarePlayerController*>(this);
+		UnprotectedThis->UpdatePlayerShipThreatStatus();
+	}
 
-	AFlareSpacecraft* DockSpacecraft = NULL;
-	FFlareDockingParameters DockParams;
-	FText DockInfo;
+	return ThreatStatus;
+}
 
-	float MaxSDangerDistance = 250000;
-	float MaxLDangerDistance = 500000;
+void AFlarePlayerController::ComputePlayerShipThreatStatus(FFlarePlayerThreatStatus& Status) const
+{
+	Status = FFlarePlayerThreatStatus();
 
 	if (GetShipPawn() && GetGame()->GetActiveSector())
 	{
@@ -1139,14 +1157,14 @@ void AFlarePlayerController::GetPlayerShipThreatStatus(bool& IsTargeted, bool& I
 			float ShipDistance = (Ship->GetActorLocation() - GetShipPawn()->GetActorLocation()).Size();
 			
 			// Small ship
-			if (ShipDistance < MaxSDangerDistance && Ship->GetDescription()->Size == EFlarePartSize::S)
+			if (ShipDistance < THREAT_SMALL_SHIP_DISTANCE && Ship->GetDescription()->Size == EFlarePartSize::S)
 			{
 				IsDangerous = (Ship->GetPilot()->GetPilotTarget().Is(GetShipPawn()));
 				IsFiring = IsDangerous && Ship->GetPilot()->IsWantFire();
 			}
 
 			// Large ship
-			else if (ShipDistance < MaxLDangerDistance && Ship->GetDescription()->Size == EFlarePartSize::L)
+			else if (ShipDistance < THREAT_LARGE_SHIP_DISTANCE && Ship->GetDescription()->Size == EFlarePartSize::L)
 			{
 				for (auto Weapon : Ship->GetWeaponsSystem()->GetWeaponList())
 				{
@@ -1167,57 +1185,223 @@ void AFlarePlayerController::GetPlayerShipThreatStatus(bool& IsTargeted, bool& I
 			// Confirm this ship is working, then flag it
 			if (IsDangerous && !Ship->GetParent()->GetDamageSystem()->IsDisarmed() && !Ship->GetParent()->GetDamageSystem()->IsUncontrollable())
 			{
-				// Is threat
-				IsTargeted = true;
-				if (!Threat)
-				{
-					Threat = Ship->GetParent();
-				}
+				AddPlayerShipThreat(Status, Ship, IsFiring);
+			}
+		}
 
-				// Is active threat
-				if (IsFiring)
-				{
-					IsFiredUpon = true;
-					Threat = Ship->GetParent();
-				}
+		ComputePlayerShipHazards(Status);
+	}
+}
+
+void AFlarePlayerController::NotifyPilotTargetChanged(AFlareSpacecraft* Ship, AFlareSpacecraft* Target)
+{
+	// Only track attackers of the ship the candidates were collected for, other changes are caught by the next full scan
+	if (Target && Target == ShipPawn && Target == ThreatCandidatesShip && !Ship->IsStation())
+	{
+		ThreatCandidates.AddUnique(Ship);
+	}
+}
+
+void AFlarePlayerController::StartThreatStatusCheck(int32 FrameCount)
+{
+	ThreatCheckFrames = FrameCount;
+	ThreatCheckMismatches = 0;
+}
+
+void AFlarePlayerController::UpdatePlayerShipThreatStatus()
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlarePlayer_Threats);
+
+	ThreatStatusFrame = GFrameCounter;
+
+	UFlareSector* ActiveSector = GetGame()->GetActiveSector();
+	bool SameTargets = (ThreatCandidatesShip == ShipPawn && ThreatCandidatesSector == ActiveSector);
+
+	// Keep the last assessment for a while if required
+	float Time = GetWorld()->GetTimeSeconds();
+	if (SameTargets && ShipPawn && Time - ThreatStatusTime < THREAT_ASSESSMENT_PERIOD)
+	{
+		return;
+	}
+	ThreatStatusTime = Time;
+	ThreatStatus = FFlarePlayerThreatStatus();
+
+	if (!ShipPawn || !ActiveSector)
+	{
+		ThreatCandidates.Empty();
+		ThreatCandidatesShip = NULL;
+		ThreatCandidatesSector = NULL;
+		return;
+	}
+
+	// Collect the attackers with a full scan when the player ship or the sector changed, target change notifications keep the list up to date after that
+	if (!SameTargets)
+	{
+		ThreatCandidates.Empty();
+		for (AFlareSpacecraft* Ship : ActiveSector->GetShips())
+		{
+			bool IsDangerous, IsFiring;
+			if (GetShipThreat(Ship, IsDangerous, IsFiring))
+			{
+				ThreatCandidates.Add(Ship);
 			}
 		}
 
-		// Bomb alarm
-		if (!IsFiredUpon)
+		ThreatCandidatesShip = ShipPawn;
+		ThreatCandidatesSector = ActiveSector;
+	}
+
+	// Threats
+	for (int32 CandidateIndex = 0; CandidateIndex < ThreatCandidates.Num(); CandidateIndex++)
+	{
+		AFlareSpacecraft* Ship = ThreatCandidates[CandidateIndex].Get();
+		bool IsDangerous, IsFiring;
+
+		// Forget ships that stopped targeting us
+		if (!Ship || !GetShipThreat(Ship, IsDangerous, IsFiring))
+		{
+			ThreatCandidates.RemoveAt(CandidateIndex);
+			CandidateIndex--;
+		}
+		else if (IsDangerous)
+		{
+			AddPlayerShipThreat(ThreatStatus, Ship, IsFiring);
+		}
+	}
+
+	ComputePlayerShipHazards(ThreatStatus);
+
+	// Compare with a full scan
+	if (ThreatCheckFrames > 0)
+	{
+		FFlarePlayerThreatStatus ReferenceStatus;
+		ComputePlayerShipThreatStatus(ReferenceStatus);
+
+		if (ThreatStatus.IsTargeted != ReferenceStatus.IsTargeted
+		 || ThreatStatus.IsFiredUpon != ReferenceStatus.IsFiredUpon
+		 || ThreatStatus.CollidingSoon != ReferenceStatus.CollidingSoon
+		 || ThreatStatus.ExitingSoon != ReferenceStatus.ExitingSoon
+		 || ThreatStatus.LowHealth != ReferenceStatus.LowHealth
+		 || (ThreatStatus.Threat == NULL) != (ReferenceStatus.Threat == NULL))
+		{
+			ThreatCheckMismatches++;
+		}
+
+		ThreatCheckFrames--;
+		if (ThreatCheckFrames == 0)
 		{
-			for (AFlareBomb* Bomb : GetGame()->GetActiveSector()->GetBombs())
+			FLOGV("AFlarePlayerController::UpdatePlayerShipThreatStatus : threat check done, %d mismatches", ThreatCheckMismatches);
+		}
+	}
+}
+
+bool AFlarePlayerController::GetShipThreat(AFlareSpacecraft* Ship, bool& IsDangerous, bool& IsFiring) const
+{
+	bool IsTargeting = false;
+	IsDangerous = false;
+	IsFiring = false;
+	float ShipDistance = (Ship->GetActorLocation() - ShipPawn->GetActorLocation()).Size();
+
+	// Small ship
+	if (Ship->GetDescription()->Size == EFlarePartSize::S)
+	{
+		IsTargeting = Ship->GetPilot()->GetPilotTarget().Is(ShipPawn);
+		IsDangerous = IsTargeting && ShipDistance < THREAT_SMALL_SHIP_DISTANCE;
+		IsFiring = IsDangerous && Ship->GetPilot()->IsWantFire();
+	}
+
+	// Large ship
+	else if (Ship->GetDescription()->Size == EFlarePartSize::L)
+	{
+		for (auto Weapon : Ship->GetWeaponsSystem()->GetWeaponList())
+		{
+			UFlareTurret* Turret = Cast<UFlareTurret>(Weapon);
+			FCHECK(Turret);
+
+			if (Turret->GetTurretPilot()->GetTurretTarget().Is(ShipPawn))
 			{
-				if (Bomb->GetTargetSpacecraft() == GetShipPawn() && Bomb->IsActive() && Bomb->GetDistanceTo(GetShipPawn()) < 200000)
+				IsTargeting = true;
+				if (Turret->GetTurretPilot()->IsWantFire())
 				{
-					IsFiredUpon = true;
-					break;
+					IsFiring = true;
 				}
 			}
 		}
 
-		// Low health
-		UFlareSimulatedSpacecraftDamageSystem* DamageSystem = GetShipPawn()->GetParent()->GetDamageSystem();
-		LowHealth = (DamageSystem->IsCrewEndangered() || DamageSystem->IsUncontrollable()) && DamageSystem->IsAlive();
+		IsDangerous = IsTargeting && ShipDistance < THREAT_LARGE_SHIP_DISTANCE;
+		IsFiring = IsDangerous && IsFiring;
+	}
+
+	// Confirm this ship is working
+	IsDangerous = IsDangerous && !Ship->GetParent()->GetDamageSystem()->IsDisarmed() && !Ship->GetParent()->GetDamageSystem()->IsUncontrollable();
 
-		// Collision
-		UFlareGameUserSettings* MyGameSettings = Cast<UFlareGameUserSettings>(GEngine->GetGameUserSettings());
-		bool NoCollisionRisk = (MyGameSettings->UseAnticollision || MenuManager->IsUIOpen());
-		bool DockingInProgress = GetShipPawn()->GetManualDockingProgress(DockSpacecraft, DockParams, DockInfo);
-		bool LowSpeed = GetShipPawn()->GetLinearVelocity().Size() < 20;
-		bool SafeDocking = DockingInProgress && LowSpeed;
+	return IsTargeting;
+}
 
-		// Other helpers
-		CollidingSoon = PilotHelper::IsAnticollisionImminent(GetShipPawn(), GetShipPawn()->GetAgressiveAnticollisionTime(), 200.f) && !NoCollisionRisk && !SafeDocking;
-		ExitingSoon = PilotHelper::IsSectorExitImminent(GetShipPawn(), 15.0f);
+void AFlarePlayerController::AddPlayerShipThreat(FFlarePlayerThreatStatus& Status, AFlareSpacecraft* Ship, bool IsFiring) const
+{
+	// Is threat
+	Status.IsTargeted = true;
+	if (!Status.Threat)
+	{
+		Status.Threat = Ship->GetParent();
 	}
+
+	// Is active threat
+	if (IsFiring)
+	{
+		Status.IsFiredUpon = true;
+		Status.Threat = Ship->GetParent();
+	}
+}
+
+void AFlarePlayerController::ComputePlayerShipHazards(FFlarePlayerThreatStatus& Status) const
+{
+	AFlareSpacecraft* DockSpacecraft = NULL;
+	FFlareDockingParameters DockParams;
+	FText DockInfo;
+
+	// Bomb alarm
+	if (!Status.IsFiredUpon)
+	{
+		for (AFlareBomb* Bomb : GetGame()->GetActiveSector()->GetBombs())
+		{
+			if (Bomb->GetTargetSpacecraft() == GetShipPawn() && Bomb->IsActive() && Bomb->GetDistanceTo(GetShipPawn()) < 200000)
+			{
+				Status.IsFiredUpon = true;
+				break;
+			}
+		}
+	}
+
+	// Low health
+	UFlareSimulatedSpacecraftDamageSystem* DamageSystem = GetShipPawn()->GetParent()->GetDamageSystem();
+	Status.LowHealth = (DamageSystem->IsCrewEndangered() || DamageSystem->IsUncontrollable()) && DamageSystem->IsAlive();
+
+	// Collision
+	UFlareGameUserSettings* MyGameSettings = Cast<UFlareGameUserSettings>(GEngine->GetGameUserSettings());
+	bool NoCollisionRisk = (MyGameSettings->UseAnticollision || MenuManager->IsUIOpen());
+	bool DockingInProgress = GetShipPawn()->GetManualDockingProgress(DockSpacecraft, DockParams, DockInfo);
+	bool LowSpeed = GetShipPawn()->GetLinearVelocity().Size() < 20;
+	bool SafeDocking = DockingInProgress && LowSpeed;
+
+	// Other helpers
+	Status.CollidingSoon = PilotHelper::IsAnticollisionImminent(GetShipPawn(), GetShipPawn()->GetAgressiveAnticollisionTime(), 200.f) && !NoCollisionRisk && !SafeDocking;
+	Status.ExitingSoon = PilotHelper::IsSectorExitImminent(GetShipPawn(), 15.0f);
 }
 
 void AFlarePlayerController::CheckSectorStateChanges(UFlareSimulatedSector* Sector)
 {
-	FFlareSectorBattleState BattleState = Sector->GetSectorBattleState(GetCompany());
-	FText BattleStateText = Sector->GetSectorBattleStateText(GetCompany());
+	// Skip sectors that didn't change since the last check. The active sector also depends on bombs, so it is always checked.
+	bool IsActiveSector = GetGame()->GetActiveSector() && GetGame()->GetActiveSector()->GetSimulatedSector() == Sector;
+	int32* LastVersion = LastSectorBattleStateVersions.Find(Sector);
+	if (!IsActiveSector && LastVersion && *LastVersion == Sector->GetBattleStateVersion())
+	{
+		return;
+	}
+	LastSectorBattleStateVersions.Add(Sector, Sector->GetBattleStateVersion());
 
+	FFlareSectorBattleState BattleState = Sector->GetSectorBattleState(GetCompany());
 
 	FFlareSectorBattleState LastSectorBattleState;
 	LastSectorBattleState.Init();
@@ -1240,6 +1424,7 @@ void AFlarePlayerController::CheckSectorStateChanges(UFlareSimulatedSector* Sect
 		NotificationIdStr += Sector->GetIdentifier().ToString();
 		FName NotificationId(*NotificationIdStr);
 
+		FText BattleStateText;
 		if(BattleState.InFight)
 		{
 			BattleStateText = FText::Format(LOCTEXT("BattleStateFightFormat", "Your personal fleet is engaged in battle in {0} !"),
@@ -1279,7 +1464,7 @@ void AFlarePlayerController::CheckSectorStateChanges(UFlareSimulatedSector* Sect
 		Data.Sector = Sector;
 		Notify(LOCTEXT("BattleStateInProgress", "Battle"),
 			FText::Format(LOCTEXT("BattleStateInProgressFormat", "{0} in {1}"),
-				BattleStateText,
+				Sector->GetSectorBattleStateText(GetCompany()),
 				Sector->GetSectorName()),
 			NotificationId,
 			EFlareNotification::NT_Military,
@@ -15,6 +15,27 @@ class AFlareMenuManager;
 class UFlareCameraShakeCatalog;
 
 
+/** Threat assessment of the player ship, shared by the HUD, cockpit and sounds */
+struct FFlarePlayerThreatStatus
+{
+	bool                                     IsTargeted;
+	bool                                     IsFiredUpon;
+	bool                                     CollidingSoon;
+	bool                                     ExitingSoon;
+	bool                                     LowHealth;
+	UFlareSimulatedSpacecraft*               Threat;
+
+	FFlarePlayerThreatStatus()
+		: IsTargeted(false)
+		, IsFiredUpon(false)
+		, CollidingSoon(false)
+		, ExitingSoon(false)
+		, LowHealth(false)
+		, Threat(NULL)
+	{}
+};
+
+
 UCLASS(MinimalAPI)
 class AFlarePlayerController : public APlayerController
 {
@@ -51,8 +72,17 @@ public:
 	/** Quick switch to another ship */
 	bool SwitchToNextShip(bool Instant = false);
 
-	/** Is the player ship being targeted ? Get one of the attackers too. */
-	void GetPlayerShipThreatStatus(bool& IsTargeted, bool& IsFiredUpon, bool& CollidingSoon, bool& ExitingSoon, bool& LowHealth, UFlareSimulatedSpacecraft*& Threat) const;
+	/** Is the player ship being targeted ? Get one of the attackers too. Assessed once per frame at most. */
+	const FFlarePlayerThreatStatus& GetPlayerShipThreatStatus() const;
+
+	/** Assess the player ship threats with a full scan of the sector */
+	void ComputePlayerShipThreatStatus(FFlarePlayerThreatStatus& Status) const;
+
+	/** A ship or one of its turrets picked a new target */
+	void NotifyPilotTargetChanged(AFlareSpacecraft* Ship, AFlareSpacecraft* Target);
+
+	/** Compare the threat assessment with a full scan for the next frames */
+	void StartThreatStatusCheck(int32 FrameCount);
 	
 	/** Update a sector */
 	void CheckSectorStateChanges(UFlareSimulatedSector* Sector);
@@ -400,6 +430,23 @@ public:
 
 
 protected:
+
+	/*----------------------------------------------------
+		Threat assessment
+	----------------------------------------------------*/
+
+	/** Assess the player ship threats from the known attackers */
+	void UpdatePlayerShipThreatStatus();
+
+	/** Check if a ship targets the player ship, and whether it is an active threat */
+	bool GetShipThreat(AFlareSpacecraft* Ship, bool& IsDangerous, bool& IsFiring) const;
+
+	/** Flag a ship as a threat */
+	void AddPlayerShipThreat(FFlarePlayerThreatStatus& Status, AFlareSpacecraft* Ship, bool IsFiring) const;
+
+	/** Assess the missile, health, collision and sector exit risks */
+	void ComputePlayerShipHazards(FFlarePlayerThreatStatus& Status) const;
+
 	
 	/*----------------------------------------------------
 		Gameplay data
@@ -511,6 +558,17 @@ protected:
 
 	FFlareSectorBattleState                  LastBattleState;
 	TMap<UFlareSimulatedSector*, FFlareSectorBattleState> LastSectorBattleStates;
+	TMap<UFlareSimulatedSector*, int32>      LastSectorBattleStateVersions;
+
+	// Threat assessment
+	FFlarePlayerThreatStatus                 ThreatStatus;
+	uint64                                   ThreatStatusFrame;
+	float                                    ThreatStatusTime;
+	TArray<TWeakObjectPtr<AFlareSpacecraft>> ThreatCandidates;
+	AFlareSpacecraft*                        ThreatCandidatesShip;
+	UFlareSector*                            ThreatCandidatesSector;
+	int32                                    ThreatCheckFrames;
+	int32                                    ThreatCheckMismatches;
 
 public:
 
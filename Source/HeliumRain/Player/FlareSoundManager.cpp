@@ -311,9 +311,7 @@ void UFlareSoundManager::Update(float DeltaSeconds)
 		}
 
 		// Get player threats
-		bool Targeted, FiredUpon, CollidingSoon, ExitingSoon, LowHealth;
-		UFlareSimulatedSpacecraft* Threat;
-		PC->GetPlayerShipThreatStatus(Targeted, FiredUpon, CollidingSoon, ExitingSoon, LowHealth, Threat);
+		const FFlarePlayerThreatStatus& ThreatStatus = PC->GetPlayerShipThreatStatus();
 		UFlareSimulatedSpacecraftDamageSystem* DamageSystem = PlayerShip->GetParent()->GetDamageSystem();
 		
 		// Update engine sounds
@@ -323,11 +321,11 @@ void UFlareSoundManager::Update(float DeltaSeconds)
 
 		// Update alarms
 		bool IsHeavy = (ShipPawn->GetParent()->GetDescription()->Size == EFlarePartSize::L);
-		UpdatePlayer(TargetWarningPlayer, (!IsHeavy && !FiredUpon & Targeted ?  1.0f : -1.0f) * DeltaSeconds);
-		UpdatePlayer(AttackWarningPlayer, (!IsHeavy &&  FiredUpon ?             1.0f : -1.0f) * DeltaSeconds);
-		UpdatePlayer(HealthWarningPlayer, (LowHealth ?                          1.0f : -1.0f) * DeltaSeconds);
-		UpdatePlayer(CollisionWarningPlayer, (CollidingSoon ?                   1.0f : -1.0f) * DeltaSeconds);
-		UpdatePlayer(SectorExitWarningPlayer, (ExitingSoon ?                    1.0f : -1.0f) * DeltaSeconds);
+		UpdatePlayer(TargetWarningPlayer, (!IsHeavy && !ThreatStatus.IsFiredUpon & ThreatStatus.IsTargeted ? 1.0f : -1.0f) * DeltaSeconds);
+		UpdatePlayer(AttackWarningPlayer, (!IsHeavy &&  ThreatStatus.IsFiredUpon ?                           1.0f : -1.0f) * DeltaSeconds);
+		UpdatePlayer(HealthWarningPlayer, (ThreatStatus.LowHealth ?                                          1.0f : -1.0f) * DeltaSeconds);
+		UpdatePlayer(CollisionWarningPlayer, (ThreatStatus.CollidingSoon ?                                   1.0f : -1.0f) * DeltaSeconds);
+		UpdatePlayer(SectorExitWarningPlayer, (ThreatStatus.ExitingSoon ?                                    1.0f : -1.0f) * DeltaSeconds);
 	}
 
 	// No ship : stop all ship sounds
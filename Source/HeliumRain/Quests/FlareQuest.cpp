@@ -585,7 +585,7 @@ TArray<EFlareQuestCallback::Type> UFlareQuest::GetCurrentCallbacks()
 			// Use trigger conditions
 			UFlareQuestCondition::AddConditionCallbacks(Callbacks, TriggerCondition->GetAllConditions());
 
-			if (Callbacks.Contains(EFlareQuestCallback::TICK_FLYING))
+			if (Callbacks.Contains(EFlareQuestCallback::TICK_FLYING) || Callbacks.Contains(EFlareQuestCallback::TICK_FLYING_THROTTLED))
 			{
 				FLOGV("WARNING: The quest %s need a TICK_FLYING callback as trigger", *GetIdentifier().ToString());
 			}
@@ -29,7 +29,8 @@ static FName WAYPOINTS_TAG("waypoints");
 
 UFlareQuestCondition::UFlareQuestCondition(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer),
-	  Quest(NULL)
+	  Quest(NULL),
+	  LastCheckedSpacecraft(NULL)
 {
 }
 
@@ -93,6 +94,18 @@ bool UFlareQuestCondition::IsCompleted()
 	return false;
 }
 
+bool UFlareQuestCondition::HasShipPassedWithin(AFlareSpacecraft* Spacecraft, FVector Location, float Radius)
+{
+	FVector CurrentLocation = Spacecraft->GetActorLocation();
+
+	// Test the path flown since the previous check, unless the player changed ship or sector
+	FVector PreviousLocation = (Spacecraft == LastCheckedSpacecraft) ? LastCheckedLocation : CurrentLocation;
+	LastCheckedSpacecraft = Spacecraft;
+	LastCheckedLocation = CurrentLocation;
+
+	return FMath::PointDistToSegment(Location, PreviousLocation, CurrentLocation) < Radius;
+}
+
 AFlareGame* UFlareQuestCondition::GetGame()
 {
 	return Quest->GetQuestManager()->GetGame();
@@ -1296,7 +1309,7 @@ void UFlareQuestConditionFollowRelativeWaypoints::Load(UFlareQuest* ParentQuest,
 		FLOG("WARNING: UFlareQuestConditionFollowRelativeWaypoints need identifier for state saving");
 	}
 	LoadInternal(ParentQuest, ConditionIdentifier);
-	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 	VectorList = VectorListParam;
 	TargetRequiresScan = RequiresScan;
 
@@ -1384,7 +1397,7 @@ bool UFlareQuestConditionFollowRelativeWaypoints::IsCompleted()
 				HasCompletedWaypoint = true;
 			}
 		}
-		else if (FVector::Dist(Spacecraft->GetActorLocation(), WorldTargetLocation) < MaxDistance)
+		else if (HasShipPassedWithin(Spacecraft, WorldTargetLocation, MaxDistance))
 		{
 			HasCompletedWaypoint = true;
 		}
@@ -1478,7 +1491,7 @@ void UFlareQuestConditionFollowRandomWaypoints::Load(UFlareQuest* ParentQuest, F
 		FLOG("WARNING: UFlareQuestConditionFollowWaypoints need identifier for state saving");
 	}
 	LoadInternal(ParentQuest, ConditionIdentifier);
-	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 	TargetRequiresScan = RequiresScan;
 
 	if (RequiresScan)
@@ -1584,7 +1597,7 @@ bool UFlareQuestConditionFollowRandomWaypoints::IsCompleted()
 				HasCompletedWaypoint = true;
 			}
 		}
-		else if (FVector::Dist(Spacecraft->GetActorLocation(), WorldTargetLocation) < MaxDistance)
+		else if (HasShipPassedWithin(Spacecraft, WorldTargetLocation, MaxDistance))
 		{
 			HasCompletedWaypoint = true;
 		}
@@ -2335,7 +2348,7 @@ UFlareQuestConditionMinArmyCombatPointsInSector* UFlareQuestConditionMinArmyComb
 void UFlareQuestConditionMinArmyCombatPointsInSector::Load(UFlareQuest* ParentQuest, UFlareSimulatedSector* TargetSectorParam, UFlareCompany* TargetCompanyParam, int32 TargetArmyPointsParam)
 {
 	LoadInternal(ParentQuest);
-	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 	Callbacks.AddUnique(EFlareQuestCallback::NEXT_DAY);
 	TargetSector = TargetSectorParam;
 	TargetCompany = TargetCompanyParam;
@@ -2395,7 +2408,7 @@ UFlareQuestConditionMaxArmyCombatPointsInSector* UFlareQuestConditionMaxArmyComb
 void UFlareQuestConditionMaxArmyCombatPointsInSector::Load(UFlareQuest* ParentQuest, UFlareSimulatedSector* TargetSectorParam, UFlareCompany* TargetCompanyParam, int32 TargetArmyPointsParam)
 {
 	LoadInternal(ParentQuest);
-	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 	Callbacks.AddUnique(EFlareQuestCallback::NEXT_DAY);
 	TargetSector = TargetSectorParam;
 	TargetCompany = TargetCompanyParam;
@@ -2463,7 +2476,7 @@ UFlareQuestConditionNoBattleInSector* UFlareQuestConditionNoBattleInSector::Crea
 void UFlareQuestConditionNoBattleInSector::Load(UFlareQuest* ParentQuest, UFlareSimulatedSector* TargetSectorParam, UFlareCompany* TargetCompanyParam)
 {
 	LoadInternal(ParentQuest);
-	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 	Callbacks.AddUnique(EFlareQuestCallback::NEXT_DAY);
 	TargetSector = TargetSectorParam;
 	TargetCompany = TargetCompanyParam;
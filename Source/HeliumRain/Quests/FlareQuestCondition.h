@@ -10,6 +10,7 @@ class UFlareCompany;
 class UFlareSimulatedSector;
 class UFlareSimulatedSpacecraft;
 class UFlareTravel;
+class AFlareSpacecraft;
 struct FFlarePlayerObjectiveData;
 struct FFlareBundle;
 struct FFlareResourceDescription;
@@ -57,6 +58,9 @@ protected:
 		  Quest = ParentQuest;
 	  }
 
+	/** Check if the player ship came within Radius of Location since the previous call, so that throttled checks don't miss a fast ship flying through */
+	bool HasShipPassedWithin(AFlareSpacecraft* Spacecraft, FVector Location, float Radius);
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -67,6 +71,11 @@ protected:
 
 
 	UFlareQuest* Quest;
+
+	// Ship position at the previous HasShipPassedWithin call
+	AFlareSpacecraft*           LastCheckedSpacecraft;
+	FVector                     LastCheckedLocation;
+
 public:
 
 	/*----------------------------------------------------
@@ -14,6 +14,8 @@
 
 DECLARE_CYCLE_STAT(TEXT("FlareQuestManager OnCallbackEvent"), STAT_FlareQuestManager_OnCallbackEvent, STATGROUP_Flare);
 
+#define QUEST_THROTTLED_TICK_INTERVAL 0.1f
+
 
 /*----------------------------------------------------
 	Constructor
@@ -21,6 +23,8 @@ DECLARE_CYCLE_STAT(TEXT("FlareQuestManager OnCallbackEvent"), STAT_FlareQuestMan
 
 UFlareQuestManager::UFlareQuestManager(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, ThrottledTickInterval(QUEST_THROTTLED_TICK_INTERVAL)
+	, ThrottledTickTimer(0)
 {
 }
 
@@ -346,9 +350,11 @@ void UFlareQuestManager::OnCallbackEvent(EFlareQuestCallback::Type EventType)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareQuestManager_OnCallbackEvent);
 	
-	if (CallbacksMap.Contains(EventType))
+	TArray<UFlareQuest*>* RegisteredQuests = CallbacksMap.Find(EventType);
+	if (RegisteredQuests && RegisteredQuests->Num() > 0)
 	{
-		TArray<UFlareQuest*> Callbacks = CallbacksMap[EventType];
+		// Quests may register or unregister while updating, iterate on a copy
+		TArray<UFlareQuest*, TInlineAllocator<32>> Callbacks(*RegisteredQuests);
 		for (UFlareQuest* Quest: Callbacks)
 		{
 			Quest->UpdateState();
@@ -356,12 +362,26 @@ void UFlareQuestManager::OnCallbackEvent(EFlareQuestCallback::Type EventType)
 	}
 }
 
+void UFlareQuestManager::SetThrottledTickInterval(float Interval)
+{
+	ThrottledTickInterval = FMath::Max(Interval, 0.f);
+	ThrottledTickTimer = 0;
+}
+
 void UFlareQuestManager::OnTick(float DeltaSeconds)
 {
 	if (GetGame()->GetActiveSector())
 	{
 		// Tick TickFlying callback only if there is an active sector
 		OnCallbackEvent(EFlareQuestCallback::TICK_FLYING);
+
+		// Distance and sector state checks don't need to run every frame
+		ThrottledTickTimer += DeltaSeconds;
+		if (ThrottledTickTimer >= ThrottledTickInterval)
+		{
+			ThrottledTickTimer = 0;
+			OnCallbackEvent(EFlareQuestCallback::TICK_FLYING_THROTTLED);
+		}
 	}
 }
 
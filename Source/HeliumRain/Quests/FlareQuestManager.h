@@ -44,6 +44,7 @@ namespace EFlareQuestCallback
 		SPACECRAFT_CAPTURED, // Trig when a spacecraft is captured
 		TRAVEL_STARTED, // Trig when a fleet start a travel
 		QUEST_EVENT, // Trig when a quest event is send
+		TICK_FLYING_THROTTLED, // Trig at a reduced rate while flying, for distance or sector state checks
 	};
 }
 
@@ -194,6 +195,9 @@ public:
 
 	void OnCallbackEvent(EFlareQuestCallback::Type EventType);
 
+	/** Set the period of the throttled flying tick, in seconds */
+	void SetThrottledTickInterval(float Interval);
+
 	virtual void OnFlyShip(AFlareSpacecraft* Ship);
 
 	virtual void OnSectorActivation(UFlareSimulatedSector* Sector);
@@ -255,6 +259,9 @@ protected:
 
 	TMap<EFlareQuestCallback::Type, TArray<UFlareQuest*>> CallbacksMap;
 
+	float                                    ThrottledTickInterval;
+	float                                    ThrottledTickTimer;
+
 	FFlareQuestSave			                 QuestData;
 
 	AFlareGame*                              Game;
@@ -418,7 +418,7 @@ void UFlareQuestConditionWaypoints::Load(UFlareQuest* ParentQuest, FName Conditi
 		FLOG("WARNING: UFlareQuestConditionWaypoints need identifier for state saving");
 	}
 	LoadInternal(ParentQuest, ConditionIdentifier);
-	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 	VectorList = VectorListParam;
 	TargetSector = Sector;
 	TargetRequiresScan = RequiresScan;
@@ -515,7 +515,7 @@ bool UFlareQuestConditionWaypoints::IsCompleted()
 					HasCompletedWaypoint = true;
 				}
 			}
-			else if (FVector::Dist(Spacecraft->GetActorLocation(), WorldTargetLocation) < MaxDistance)
+			else if (HasShipPassedWithin(Spacecraft, WorldTargetLocation, MaxDistance))
 			{
 				HasCompletedWaypoint = true;
 			}
@@ -755,7 +755,7 @@ UFlareCompanyMaxCombatValue* UFlareCompanyMaxCombatValue::Create(UFlareQuest* Pa
 void UFlareCompanyMaxCombatValue::Load(UFlareQuest* ParentQuest, UFlareCompany* TargetCompanyParam, int32 TargetArmyPointsParam)
 {
 	LoadInternal(ParentQuest);
-	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 	Callbacks.AddUnique(EFlareQuestCallback::NEXT_DAY);
 	TargetCompany = TargetCompanyParam;
 	TargetArmyPoints = TargetArmyPointsParam;
@@ -341,7 +341,7 @@ void UFlareQuestTutorialNavigation::Load(UFlareQuestManager* Parent)
 		},
 		[](UFlareQuestCondition* Condition)
 		{
-			Condition->Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+			Condition->Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 		});
 
 		DistanceCondition->AddConditionObjectivesFunc = [this, StationC, DistanceCondition, Distance](FFlarePlayerObjectiveData* ObjectiveData)
@@ -1649,7 +1649,7 @@ void UFlareQuestTutorialFighter::Load(UFlareQuestManager* Parent)
 		},
 		[](UFlareQuestCondition* Condition)
 		{
-			Condition->Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+			Condition->Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 		}));
 
 		Steps.Add(Step);
@@ -3004,7 +3004,7 @@ void UFlareQuestConditionTutorialTargetSpacecraft::Load(UFlareQuest* ParentQuest
 	}
 	LoadInternal(ParentQuest, ConditionIdentifierParam);
 	Callbacks.AddUnique(EFlareQuestCallback::QUEST_EVENT);
-	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 
 	TargetDuration = Duration;
 	TargetSpacecraft = Spacecraft;
@@ -3898,7 +3898,7 @@ UFlareQuestConditionTutorialShipNeedFs* UFlareQuestConditionTutorialShipNeedFs::
 void UFlareQuestConditionTutorialShipNeedFs::Load(UFlareQuest* ParentQuest, bool Refill)
 {
 	LoadInternal(ParentQuest);
-	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING);
+	Callbacks.AddUnique(EFlareQuestCallback::TICK_FLYING_THROTTLED);
 	Callbacks.AddUnique(EFlareQuestCallback::NEXT_DAY);
 	TargetRefill = Refill;
 }
@@ -19,6 +19,7 @@ DECLARE_CYCLE_STAT(TEXT("PilotHelper Anticollision"), STAT_PilotHelper_Anticolli
 DECLARE_CYCLE_STAT(TEXT("PilotHelper Anticollision Avoidance"), STAT_PilotHelper_AnticollisionCorrection_Avoidance, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("PilotHelper GetBestTarget"), STAT_PilotHelper_GetBestTarget, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("PilotHelper GetBestTargetComponent"), STAT_PilotHelper_GetBestTargetComponent, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("PilotHelper GetTargetCandidates"), STAT_PilotHelper_GetTargetCandidates, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("PilotHelper CheckRelativeDangerosity"), STAT_PilotHelper_CheckRelativeDangerosity, STATGROUP_Flare);
 
 
@@ -331,43 +332,117 @@ bool PilotHelper::IsSectorExitImminent(AFlareSpacecraft* Ship, float PreventionD
 
 PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct TargetPreferences Preferences)
 {
-	SCOPE_CYCLE_COUNTER(STAT_PilotHelper_GetBestTarget);
-
 	if (!Ship || !Ship->GetGame()->GetActiveSector())
 	{
 		return PilotHelper::PilotTarget();
 	}
 
-	PilotTarget BestTarget;
-	float BestScore = 0;
+	return GetBestTarget(Ship, Preferences, Ship->GetTargetCandidates());
+}
 
-	//FLOGV("GetBestTarget for %s", *Ship->GetImmatriculation().ToString());
+void PilotHelper::GetTargetCandidates(AFlareSpacecraft* Ship, TArray<TargetCandidate>& Candidates)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PilotHelper_GetTargetCandidates);
+
+	Candidates.Reset();
 
-	for (AFlareSpacecraft* ShipCandidate :Ship->GetGame()->GetActiveSector()->GetSpacecrafts())
+	UFlareSector* Sector = Ship->GetGame()->GetActiveSector();
+	if (!Sector)
 	{
-		if (Preferences.IgnoreList.Contains(PilotTarget(ShipCandidate)))
-		{
-			continue;
-		}
+		return;
+	}
 
+	for (AFlareSpacecraft* ShipCandidate : Sector->GetSpacecrafts())
+	{
 		if (Ship->GetParent()->GetCompany()->GetWarState(ShipCandidate->GetCompany()) != EFlareHostility::Hostile)
 		{
 			// Ignore not hostile ships
 			continue;
 		}
 
-		if (!ShipCandidate->GetParent()->GetDamageSystem()->IsAlive())
+		UFlareSimulatedSpacecraft* CandidateParent = ShipCandidate->GetParent();
+		UFlareSimulatedSpacecraftDamageSystem* CandidateDamageSystem = CandidateParent->GetDamageSystem();
+
+		if (!CandidateDamageSystem->IsAlive())
 		{
 			// Ignore destroyed ships
 			continue;
 		}
 
-		if (ShipCandidate->GetActorLocation().Size() > ShipCandidate->GetGame()->GetActiveSector()->GetSectorLimits())
+		if (ShipCandidate->GetActorLocation().Size() > Sector->GetSectorLimits())
 		{
 			// Ignore out limit ships
 			continue;
 		}
 
+		bool IsUncontrollable = CandidateDamageSystem->IsUncontrollable();
+		if (CandidateParent->IsHarpooned() && IsUncontrollable)
+		{
+			// Never target harponned uncontrollable ships
+			continue;
+		}
+
+		TargetCandidate Candidate;
+		Candidate.Spacecraft = ShipCandidate;
+		Candidate.IsLarge = (CandidateParent->GetSize() == EFlarePartSize::L);
+		Candidate.IsSmall = (CandidateParent->GetSize() == EFlarePartSize::S);
+		Candidate.IsStation = CandidateParent->IsStation();
+		Candidate.IsMilitary = CandidateParent->IsMilitary();
+		Candidate.IsDangerous = IsTargetDangerous(PilotTarget(ShipCandidate));
+		Candidate.IsStranded = CandidateDamageSystem->IsStranded();
+		Candidate.IsHarpooned = CandidateParent->IsHarpooned();
+		Candidate.IsUncontrollable = IsUncontrollable && CandidateDamageSystem->IsDisarmed();
+		Candidate.IncomingBombCount = 0;
+
+		// All non player company, attack player station if there is retaliation
+		Candidate.IsStationAllowed = Candidate.IsStation && (Ship->GetCompany()->IsPlayerCompany()
+			|| (ShipCandidate->GetCompany()->IsPlayerCompany() && ShipCandidate->GetCompany()->GetRetaliation() > 0));
+
+		Candidates.Add(Candidate);
+	}
+
+	// Count incoming missiles once for all candidates
+	for (AFlareBomb* Bomb : Sector->GetBombs())
+	{
+		if (!Bomb->IsActive() || !Bomb->GetTargetSpacecraft())
+		{
+			continue;
+		}
+
+		for (TargetCandidate& Candidate : Candidates)
+		{
+			if (Bomb->GetTargetSpacecraft() == Candidate.Spacecraft)
+			{
+				Candidate.IncomingBombCount++;
+				break;
+			}
+		}
+	}
+}
+
+PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct TargetPreferences const& Preferences, TArray<TargetCandidate> const& Candidates)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PilotHelper_GetBestTarget);
+
+	if (!Ship || !Ship->GetGame()->GetActiveSector())
+	{
+		return PilotHelper::PilotTarget();
+	}
+
+	PilotTarget BestTarget;
+	float BestScore = 0;
+
+	//FLOGV("GetBestTarget for %s", *Ship->GetImmatriculation().ToString());
+
+	for (TargetCandidate const& Candidate : Candidates)
+	{
+		AFlareSpacecraft* ShipCandidate = Candidate.Spacecraft;
+
+		if (Preferences.IgnoreList.Contains(PilotTarget(ShipCandidate)))
+		{
+			continue;
+		}
+
 		float Score;
 		float StateScore;
 		float AttackTargetScore;
@@ -376,21 +451,20 @@ PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, stru
 
 		StateScore = Preferences.TargetStateWeight;
 
-		if (ShipCandidate->GetParent()->GetSize() == EFlarePartSize::L)
+		if (Candidate.IsLarge)
 		{
 			StateScore *= Preferences.IsLarge;
 		}
 
-		if (ShipCandidate->GetParent()->GetSize() == EFlarePartSize::S)
+		if (Candidate.IsSmall)
 		{
 			StateScore *= Preferences.IsSmall;
 		}
 
-		if (ShipCandidate->GetParent()->IsStation())
+		if (Candidate.IsStation)
 		{
-			if (Ship->GetCompany()->IsPlayerCompany() || (ShipCandidate->GetCompany()->IsPlayerCompany() && ShipCandidate->GetCompany()->GetRetaliation() > 0))
+			if (Candidate.IsStationAllowed)
 			{
-				// All non player company, attack player station if there is retaliation
 				StateScore *= Preferences.IsStation;
 			}
 			else
@@ -403,7 +477,7 @@ PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, stru
 			StateScore *= Preferences.IsNotStation;
 		}
 
-		if (ShipCandidate->GetParent()->IsMilitary())
+		if (Candidate.IsMilitary)
 		{
 			StateScore *= Preferences.IsMilitary;
 		}
@@ -412,7 +486,7 @@ PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, stru
 			StateScore *= Preferences.IsNotMilitary;
 		}
 
-		if (IsTargetDangerous(PilotTarget(ShipCandidate)))
+		if (Candidate.IsDangerous)
 		{
 			StateScore *= Preferences.IsDangerous;
 		}
@@ -421,7 +495,7 @@ PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, stru
 			StateScore *= Preferences.IsNotDangerous;
 		}
 
-		if (ShipCandidate->GetParent()->GetDamageSystem()->IsStranded())
+		if (Candidate.IsStranded)
 		{
 			StateScore *= Preferences.IsStranded;
 		}
@@ -430,11 +504,11 @@ PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, stru
 			StateScore *= Preferences.IsNotStranded;
 		}
 
-		if (ShipCandidate->GetParent()->GetDamageSystem()->IsUncontrollable() && ShipCandidate->GetParent()->GetDamageSystem()->IsDisarmed())
+		if (Candidate.IsUncontrollable)
 		{
-			if (ShipCandidate->IsMilitary())
+			if (Candidate.IsMilitary)
 			{
-				if (ShipCandidate->GetSize() == EFlarePartSize::S)
+				if (Candidate.IsSmall)
 				{
 					StateScore *= Preferences.IsUncontrollableSmallMilitary;
 				}
@@ -454,24 +528,16 @@ PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, stru
 		}
 
 		// Divise by 25 the stateScore per current incoming missile
-		for (AFlareBomb* Bomb : Ship->GetGame()->GetActiveSector()->GetBombs())
+		for (int32 BombIndex = 0; BombIndex < Candidate.IncomingBombCount; BombIndex++)
 		{
-			if (Bomb->GetTargetSpacecraft() == ShipCandidate && Bomb->IsActive())
-			{
-				StateScore /= 25;
-			}
+			StateScore /= 25;
 		}
 
-		if(ShipCandidate->GetParent()->IsHarpooned()) {
-			if(ShipCandidate->GetParent()->GetDamageSystem()->IsUncontrollable())
-			{
-				// Never target harponned uncontrollable ships
-				continue;
-			}
+		if (Candidate.IsHarpooned)
+		{
 			StateScore *=  Preferences.IsHarpooned;
 		}
 
-
 		if(Preferences.LastTarget.Is(ShipCandidate)) {
 			StateScore *=  Preferences.LastTargetWeight;
 		}
@@ -486,7 +552,7 @@ PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, stru
 			DistanceScore = Preferences.DistanceWeight * (1.f - (Distance / Preferences.MaxDistance));
 		}
 
-		if (Preferences.AttackTarget && IsTargetDangerous(PilotTarget(ShipCandidate)) && ShipCandidate->GetPilot()->GetPilotTarget().Is(Preferences.AttackTarget))
+		if (Preferences.AttackTarget && Candidate.IsDangerous && ShipCandidate->GetPilot()->GetPilotTarget().Is(Preferences.AttackTarget))
 		{
 			AttackTargetScore = Preferences.AttackTargetWeight;
 		}
@@ -495,7 +561,7 @@ PilotHelper::PilotTarget PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, stru
 			AttackTargetScore = 0.0f;
 		}
 
-		if(IsTargetDangerous(PilotTarget(ShipCandidate)) && ShipCandidate->GetPilot()->GetPilotTarget().Is(Ship))
+		if(Candidate.IsDangerous && ShipCandidate->GetPilot()->GetPilotTarget().Is(Ship))
 		{
 			StateScore *= Preferences.AttackMeWeight;
 		}
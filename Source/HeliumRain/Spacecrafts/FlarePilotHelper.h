@@ -108,6 +108,22 @@ struct PilotHelper
 		TArray<PilotTarget> IgnoreList;
 	};
 
+	/** Hostile spacecraft with the state used for target scoring, shared by all the weapons of a ship */
+	struct TargetCandidate
+	{
+		AFlareSpacecraft* Spacecraft;
+		bool IsLarge;
+		bool IsSmall;
+		bool IsStation;
+		bool IsStationAllowed;
+		bool IsMilitary;
+		bool IsDangerous;
+		bool IsStranded;
+		bool IsHarpooned;
+		bool IsUncontrollable;
+		int32 IncomingBombCount;
+	};
+
 	static bool CheckFriendlyFire(UFlareSector* Sector, UFlareCompany* MyCompany, FVector FireBaseLocation, FVector FireBaseVelocity , float AmmoVelocity, FVector FireAxis, float MaxDelay, float AimRadius);
 
 	struct AnticollisionConfig
@@ -131,6 +147,12 @@ struct PilotHelper
 
 	static PilotTarget GetBestTarget(AFlareSpacecraft* Ship, struct TargetPreferences Preferences);
 
+	/** Score a list of candidates built with GetTargetCandidates, then the sector bombs and meteorites */
+	static PilotTarget GetBestTarget(AFlareSpacecraft* Ship, struct TargetPreferences const& Preferences, TArray<TargetCandidate> const& Candidates);
+
+	/** List the hostile spacecrafts that Ship can target */
+	static void GetTargetCandidates(AFlareSpacecraft* Ship, TArray<TargetCandidate>& Candidates);
+
 	static UFlareSpacecraftComponent* GetBestTargetComponent(AFlareSpacecraft* TargetSpacecraft);
 
 	/** Return true if the ship is dangerous */
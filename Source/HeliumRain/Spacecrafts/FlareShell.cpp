@@ -14,6 +14,8 @@
 #include "Components/StaticMeshComponent.h"
 #include "Engine.h"
 
+DECLARE_CYCLE_STAT(TEXT("FlareShell Tick"), STAT_FlareShell_Tick, STATGROUP_Flare);
+
 
 /*----------------------------------------------------
 	Constructor
@@ -89,6 +91,9 @@ void AFlareShell::Initialize(UFlareWeapon* Weapon, const FFlareSpacecraftCompone
 
 void AFlareShell::Tick(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_FlareShell_Tick);
+	FFlareSkirmishBatchScope BatchScope(EFlareSkirmishBatchSection::Shells);
+
 	Super::Tick(DeltaSeconds);
 	
 	FVector ActorLocation = GetActorLocation();
@@ -8,6 +8,7 @@
 
 #include "../Game/FlareCompany.h"
 #include "../Game/FlareGame.h"
+#include "../Game/FlareSkirmishManager.h"
 #include "../Game/AI/FlareCompanyAI.h"
 #include "../Quests/FlareQuest.h"
 #include "../Quests/FlareQuestStep.h"
@@ -63,6 +64,7 @@ UFlareShipPilot::UFlareShipPilot(const class FObjectInitializer& PCIP)
 void UFlareShipPilot::TickPilot(float DeltaSeconds)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareShipPilot_Tick);
+	FFlareSkirmishBatchScope BatchScope(EFlareSkirmishBatchSection::Pilots);
 
 	if (Ship->IsStation())
 	{
@@ -1366,6 +1368,7 @@ void UFlareShipPilot::FindBestHostileTarget(EFlareCombatTactic::Type Tactic)
 
 			PilotTarget = TargetCandidate;
 			Ship->SetCurrentTarget(PilotTarget);
+			Ship->GetGame()->GetPC()->NotifyPilotTargetChanged(Ship, PilotTarget.SpacecraftTarget);
 			LastPilotTarget = TargetCandidate;
 
 			NewTarget = true;
@@ -1448,11 +1451,7 @@ FVector UFlareShipPilot::ExitAvoidance(AFlareSpacecraft* TargetShip, FVector Ini
 
 		FVector CurrentVelocityAxis = CurrentVelocity.GetUnsafeNormal();
 
-		// TODO Cache
-		TArray<UActorComponent*> Engines = Ship->GetComponentsByClass(UFlareEngine::StaticClass());
-
-
-		FVector Acceleration = Ship->GetNavigationSystem()->GetTotalMaxThrustInAxis(Engines, CurrentVelocityAxis, false) / Ship->GetSpacecraftMass();
+		FVector Acceleration = Ship->GetNavigationSystem()->GetTotalMaxThrustInAxis(CurrentVelocityAxis, false) / Ship->GetSpacecraftMass();
 		float AccelerationInAngleAxis =  FMath::Abs(FVector::DotProduct(Acceleration, CurrentVelocityAxis));
 
 		TimeToStop= (CurrentVelocity.Size() / (AccelerationInAngleAxis));
@@ -1645,8 +1644,6 @@ AFlareSpacecraft* UFlareShipPilot::GetNearestShip(bool IgnoreDockingShip) const
 
 FVector UFlareShipPilot::GetAngularVelocityToAlignAxis(FVector LocalShipAxis, FVector TargetAxis, FVector TargetAngularVelocity, float DeltaSeconds) const
 {
-	TArray<UActorComponent*> Engines = Ship->GetComponentsByClass(UFlareEngine::StaticClass());
-
 	FVector AngularVelocity = Ship->Airframe->GetPhysicsAngularVelocityInDegrees();
 	FVector WorldShipAxis = Ship->Airframe->GetComponentToWorld().GetRotation().RotateVector(LocalShipAxis);
 
@@ -1671,7 +1668,7 @@ FVector UFlareShipPilot::GetAngularVelocityToAlignAxis(FVector LocalShipAxis, FV
 	else {
 		FVector SimpleAcceleration = DeltaVelocityAxis * Ship->GetNavigationSystem()->GetAngularAccelerationRate();
 	    // Scale with damages
-		float DamageRatio = Ship->GetNavigationSystem()->GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, true) / Ship->GetNavigationSystem()->GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, false);
+		float DamageRatio = Ship->GetNavigationSystem()->GetTotalMaxTorqueDamageRatioInAxis(DeltaVelocityAxis);
 	    FVector DamagedSimpleAcceleration = SimpleAcceleration * DamageRatio;
 
 	    FVector Acceleration = DamagedSimpleAcceleration;
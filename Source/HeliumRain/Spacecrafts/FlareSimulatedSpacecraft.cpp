@@ -189,6 +189,12 @@ void UFlareSimulatedSpacecraft::Load(const FFlareSpacecraftSave& Data)
 	}
 
 
+	// Factory changes affect which resources the station trades
+	if (CurrentSector && IsStation())
+	{
+		CurrentSector->InvalidateTradeStationIndex();
+	}
+
 	// Cargo bay init
 	if(SpacecraftData.AttachComplexStationName == NAME_None)
 	{
@@ -905,6 +911,11 @@ void UFlareSimulatedSpacecraft::SetIntercepted(bool Intercepted)
 
 void UFlareSimulatedSpacecraft::SetReserve(bool InReserve)
 {
+	if (SpacecraftData.IsReserve != InReserve && CurrentSector)
+	{
+		CurrentSector->InvalidateBattleState();
+	}
+
 	SpacecraftData.IsReserve = InReserve;
 }
 
@@ -1121,6 +1132,11 @@ void UFlareSimulatedSpacecraft::RemoveCapturePoint(FName CompanyIdentifier, int3
 		if(CapturePoint >= CurrentCapturePoint)
 		{
 			SpacecraftData.CapturePoints.Remove(CompanyIdentifier);
+
+			if (CurrentSector && !IsBeingCaptured())
+			{
+				CurrentSector->InvalidateBattleState();
+			}
 		}
 		else
 		{
@@ -1174,6 +1190,11 @@ bool UFlareSimulatedSpacecraft::TryCapture(UFlareCompany* OtherCompany, int32 Ca
 	else
 	{
 		SpacecraftData.CapturePoints.Add(CompanyIdentifier, CurrentCapturePoint);
+
+		if (CurrentSector)
+		{
+			CurrentSector->InvalidateBattleState();
+		}
 	}
 
 	if (CurrentCapturePoint > GetCapturePointThreshold())
@@ -85,6 +85,7 @@ AFlareSpacecraft::AFlareSpacecraft(const class FObjectInitializer& PCIP)
 	LoadedAndReady = false;
 	AttachedToParentActor = false;
 	TargetIndex = 0;
+	TargetCandidatesFrame = 0;
 	TimeSinceSelection = 0;
 	MaxTimeBeforeSelectionReset = 3.0;
 	ScanningTimerDuration = 5.0f;
@@ -701,6 +702,17 @@ PilotHelper::PilotTarget AFlareSpacecraft::GetCurrentTarget() const
 	}
 }
 
+TArray<PilotHelper::TargetCandidate> const& AFlareSpacecraft::GetTargetCandidates()
+{
+	if (TargetCandidatesFrame != GFrameCounter)
+	{
+		PilotHelper::GetTargetCandidates(this, TargetCandidates);
+		TargetCandidatesFrame = GFrameCounter;
+	}
+
+	return TargetCandidates;
+}
+
 bool AFlareSpacecraft::IsInScanningMode()
 {
 	const FFlarePlayerObjectiveData* Objective = GetPC()->GetCurrentObjective();
@@ -1303,11 +1315,16 @@ void AFlareSpacecraft::UpdateDynamicComponents()
 	}
 }
 
-UFlareInternalComponent* AFlareSpacecraft::GetInternalComponentAtLocation(FVector Location) const
+UFlareInternalComponent* AFlareSpacecraft::GetInternalComponentAtLocation(FVector Location, bool FullScan) const
 {
 	float MinDistance = 100000; // 1km
 	UFlareInternalComponent* ClosestComponent = NULL;
 
+	if (!FullScan && DamageSystem && DamageSystem->HasComponentTree())
+	{
+		return DamageSystem->GetInternalComponentAtLocation(Location, MinDistance);
+	}
+
 	TArray<UActorComponent*> Components = GetComponentsByClass(UFlareInternalComponent::StaticClass());
 	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
 	{
@@ -2193,10 +2210,7 @@ float AFlareSpacecraft::GetTimeToStop() const
 	{
 		FVector CurrentVelocityAxis = CurrentVelocity.GetUnsafeNormal();
 
-		// TODO Cache
-		TArray<UActorComponent*> Engines = GetComponentsByClass(UFlareEngine::StaticClass());
-
-		FVector Acceleration = GetNavigationSystem()->GetTotalMaxThrustInAxis(Engines, CurrentVelocityAxis, false) / GetSpacecraftMass();
+		FVector Acceleration = GetNavigationSystem()->GetTotalMaxThrustInAxis(CurrentVelocityAxis, false) / GetSpacecraftMass();
 		float AccelerationInAngleAxis =  FMath::Abs(FVector::DotProduct(Acceleration, CurrentVelocityAxis));
 
 		TimeToStopCache = (CurrentVelocity.Size() / (AccelerationInAngleAxis));
@@ -91,6 +91,9 @@ public:
 	/** Get the current target */
 	PilotHelper::PilotTarget GetCurrentTarget() const;
 
+	/** Get the hostile spacecrafts our pilot and turrets can target, built once per frame */
+	TArray<PilotHelper::TargetCandidate> const& GetTargetCandidates();
+
 	/** Are we scanning for a waypoint ? */
 	bool IsInScanningMode();
 
@@ -119,7 +122,8 @@ public:
 
 	virtual void SetOwnerCompany(UFlareCompany* Company);
 	
-	virtual UFlareInternalComponent* GetInternalComponentAtLocation(FVector Location) const;
+	/** Get the internal component closest to a location, FullScan ignores the component hierarchy */
+	virtual UFlareInternalComponent* GetInternalComponentAtLocation(FVector Location, bool FullScan = false) const;
 	
 	virtual UFlareSpacecraftDamageSystem* GetDamageSystem() const;
 
@@ -368,6 +372,10 @@ protected:
 	// Throttle memory
 	float                                          PreviousJoystickThrottle;
 
+	// Target candidates shared by the pilot and turrets
+	TArray<PilotHelper::TargetCandidate>           TargetCandidates;
+	uint64                                         TargetCandidatesFrame;
+
 	TArray<FFlareScreenTarget> Targets;
 
 	TArray<FFlareScreenTarget>& GetCurrentTargets();
@@ -0,0 +1,261 @@
+#include "FlareSpacecraftComponentTree.h"
+#include "../Flare.h"
+#include "FlareSpacecraftComponent.h"
+#include "FlareSpacecraftSubComponent.h"
+#include "FlareSpacecraftSpinningComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("FlareComponentTree Build"), STAT_FlareComponentTree_Build, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlareComponentTree Overlap"), STAT_FlareComponentTree_Overlap, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlareComponentTree Nearest"), STAT_FlareComponentTree_Nearest, STATGROUP_Flare);
+
+// Max component count in a leaf
+#define COMPONENT_TREE_LEAF_SIZE 4
+
+// Tolerance in cm for the tree tests, exact checks are done on the components themselves
+#define COMPONENT_TREE_MARGIN 10.f
+
+
+/*----------------------------------------------------
+	Build
+----------------------------------------------------*/
+
+void SpacecraftComponentTree::Build(USceneComponent* RootComponent, TArray<UActorComponent*> const& Components, UClass* ComponentClass)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlareComponentTree_Build);
+
+	Clear();
+	Root = RootComponent;
+	if (!Root)
+	{
+		return;
+	}
+
+	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	{
+		UFlareSpacecraftComponent* Component = Cast<UFlareSpacecraftComponent>(Components[ComponentIndex]);
+		if (!Component || (ComponentClass && !Component->IsA(ComponentClass)))
+		{
+			continue;
+		}
+
+		ComponentBounds Item;
+		Item.Component = Component;
+		Item.Index = ComponentIndex;
+		Component->GetBoundingSphere(Item.Center, Item.Radius);
+		Item.Center = GetLocalLocation(Item.Center);
+
+		// Turrets and spinners move relative to the root, don't index them
+		bool IsMobile = false;
+		for (USceneComponent* Parent = Component; Parent && Parent != Root; Parent = Parent->GetAttachParent())
+		{
+			if (Parent->IsA(UFlareSpacecraftSubComponent::StaticClass()) || Parent->IsA(UFlareSpacecraftSpinningComponent::StaticClass()))
+			{
+				IsMobile = true;
+				break;
+			}
+		}
+
+		if (IsMobile)
+		{
+			MobileBounds.Add(Item);
+		}
+		else
+		{
+			Bounds.Add(Item);
+		}
+	}
+
+	if (Bounds.Num() > 0)
+	{
+		Nodes.AddUninitialized(1);
+		BuildNode(0, 0, Bounds.Num());
+	}
+}
+
+void SpacecraftComponentTree::Clear()
+{
+	Root = NULL;
+	Bounds.Empty();
+	Nodes.Empty();
+	MobileBounds.Empty();
+}
+
+void SpacecraftComponentTree::BuildNode(int32 NodeIndex, int32 First, int32 Count)
+{
+	FBox SphereBox(ForceInit);
+	FBox CenterBox(ForceInit);
+	for (int32 Index = First; Index < First + Count; Index++)
+	{
+		SphereBox += Bounds[Index].Center - FVector(Bounds[Index].Radius);
+		SphereBox += Bounds[Index].Center + FVector(Bounds[Index].Radius);
+		CenterBox += Bounds[Index].Center;
+	}
+
+	Node NewNode;
+	NewNode.Center = SphereBox.GetCenter();
+	NewNode.Radius = 0;
+	NewNode.FirstChild = INDEX_NONE;
+	NewNode.FirstBounds = First;
+	NewNode.BoundsCount = Count;
+
+	for (int32 Index = First; Index < First + Count; Index++)
+	{
+		NewNode.Radius = FMath::Max(NewNode.Radius, (Bounds[Index].Center - NewNode.Center).Size() + Bounds[Index].Radius);
+	}
+
+	// Split along the largest axis at the median, children are contiguous
+	if (Count > COMPONENT_TREE_LEAF_SIZE)
+	{
+		FVector Extent = CenterBox.GetExtent();
+		int32 Axis = (Extent.X > Extent.Y) ? ((Extent.X > Extent.Z) ? 0 : 2) : ((Extent.Y > Extent.Z) ? 1 : 2);
+
+		Sort(Bounds.GetData() + First, Count, [Axis](const ComponentBounds& A, const ComponentBounds& B)
+		{
+			return A.Center[Axis] < B.Center[Axis];
+		});
+
+		int32 LeftCount = Count / 2;
+		NewNode.FirstChild = Nodes.AddUninitialized(2);
+		Nodes[NodeIndex] = NewNode;
+
+		BuildNode(NewNode.FirstChild, First, LeftCount);
+		BuildNode(NewNode.FirstChild + 1, First + LeftCount, Count - LeftCount);
+	}
+	else
+	{
+		Nodes[NodeIndex] = NewNode;
+	}
+}
+
+FVector SpacecraftComponentTree::GetLocalLocation(FVector Location) const
+{
+	return Root->GetComponentTransform().InverseTransformPositionNoScale(Location);
+}
+
+
+/*----------------------------------------------------
+	Queries
+----------------------------------------------------*/
+
+void SpacecraftComponentTree::GetOverlappingComponents(FVector Location, float Radius, TArray<int32>& Result) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlareComponentTree_Overlap);
+
+	Result.Reset();
+	if (!Root)
+	{
+		return;
+	}
+
+	if (Nodes.Num() > 0)
+	{
+		FVector LocalLocation = GetLocalLocation(Location);
+		TArray<int32, TInlineAllocator<32>> Stack;
+		Stack.Add(0);
+
+		while (Stack.Num())
+		{
+			const Node& CurrentNode = Nodes[Stack.Pop(false)];
+
+			if ((CurrentNode.Center - LocalLocation).Size() > CurrentNode.Radius + Radius + COMPONENT_TREE_MARGIN)
+			{
+				continue;
+			}
+
+			if (CurrentNode.FirstChild != INDEX_NONE)
+			{
+				Stack.Add(CurrentNode.FirstChild);
+				Stack.Add(CurrentNode.FirstChild + 1);
+				continue;
+			}
+
+			for (int32 Index = CurrentNode.FirstBounds; Index < CurrentNode.FirstBounds + CurrentNode.BoundsCount; Index++)
+			{
+				if ((Bounds[Index].Center - LocalLocation).Size() <= Bounds[Index].Radius + Radius + COMPONENT_TREE_MARGIN)
+				{
+					Result.Add(Bounds[Index].Index);
+				}
+			}
+		}
+	}
+
+	for (const ComponentBounds& Item : MobileBounds)
+	{
+		Result.Add(Item.Index);
+	}
+
+	// Keep the component order so that damage is applied in the same sequence as a full scan
+	Result.Sort();
+}
+
+UFlareSpacecraftComponent* SpacecraftComponentTree::GetNearestComponent(FVector Location, float MaxDistance) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlareComponentTree_Nearest);
+
+	float MinDistance = MaxDistance;
+	int32 ClosestIndex = INDEX_NONE;
+	UFlareSpacecraftComponent* ClosestComponent = NULL;
+
+	if (!Root)
+	{
+		return NULL;
+	}
+
+	// Distances are computed on the live bounding sphere, ties go to the first component
+	auto CheckComponent = [&](const ComponentBounds& Item)
+	{
+		FVector ComponentLocation;
+		float ComponentSize;
+		Item.Component->GetBoundingSphere(ComponentLocation, ComponentSize);
+
+		float Distance = (ComponentLocation - Location).Size() - ComponentSize;
+		if (Distance < MinDistance || (ClosestComponent && Distance == MinDistance && Item.Index < ClosestIndex))
+		{
+			ClosestComponent = Item.Component;
+			ClosestIndex = Item.Index;
+			MinDistance = Distance;
+		}
+	};
+
+	for (const ComponentBounds& Item : MobileBounds)
+	{
+		CheckComponent(Item);
+	}
+
+	if (Nodes.Num() > 0)
+	{
+		FVector LocalLocation = GetLocalLocation(Location);
+		TArray<int32, TInlineAllocator<32>> Stack;
+		Stack.Add(0);
+
+		while (Stack.Num())
+		{
+			const Node& CurrentNode = Nodes[Stack.Pop(false)];
+
+			// No component in this node can be closer than this
+			if ((CurrentNode.Center - LocalLocation).Size() - CurrentNode.Radius - COMPONENT_TREE_MARGIN > MinDistance)
+			{
+				continue;
+			}
+
+			if (CurrentNode.FirstChild != INDEX_NONE)
+			{
+				// Visit the closest child first
+				const Node& Left = Nodes[CurrentNode.FirstChild];
+				const Node& Right = Nodes[CurrentNode.FirstChild + 1];
+				bool LeftFirst = ((Left.Center - LocalLocation).Size() - Left.Radius) < ((Right.Center - LocalLocation).Size() - Right.Radius);
+
+				Stack.Add(LeftFirst ? CurrentNode.FirstChild + 1 : CurrentNode.FirstChild);
+				Stack.Add(LeftFirst ? CurrentNode.FirstChild : CurrentNode.FirstChild + 1);
+				continue;
+			}
+
+			for (int32 Index = CurrentNode.FirstBounds; Index < CurrentNode.FirstBounds + CurrentNode.BoundsCount; Index++)
+			{
+				CheckComponent(Bounds[Index]);
+			}
+		}
+	}
+
+	return ClosestComponent;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "EngineMinimal.h"
+
+class UFlareSpacecraftComponent;
+
+
+/** Bounding sphere hierarchy of spacecraft components, stored in the space of the actor root */
+struct SpacecraftComponentTree
+{
+	SpacecraftComponentTree()
+		: Root(NULL)
+	{}
+
+	/** Build the hierarchy from a list of components, keeping only those of ComponentClass if set */
+	void Build(USceneComponent* RootComponent, TArray<UActorComponent*> const& Components, UClass* ComponentClass = NULL);
+
+	/** Remove all components */
+	void Clear();
+
+	/** Return true if the tree was built */
+	bool IsBuilt() const
+	{
+		return Root != NULL;
+	}
+
+	/** List the indices of the components whose bounding sphere can touch a world sphere, in component order */
+	void GetOverlappingComponents(FVector Location, float Radius, TArray<int32>& Result) const;
+
+	/** Find the component whose bounding sphere surface is the nearest from a world location, within MaxDistance */
+	UFlareSpacecraftComponent* GetNearestComponent(FVector Location, float MaxDistance) const;
+
+
+protected:
+
+	struct ComponentBounds
+	{
+		UFlareSpacecraftComponent* Component;
+		int32 Index;
+		FVector Center;
+		float Radius;
+	};
+
+	struct Node
+	{
+		FVector Center;
+		float Radius;
+		int32 FirstChild;
+		int32 FirstBounds;
+		int32 BoundsCount;
+	};
+
+	/** Recursively build the node for Bounds[First, First + Count[ */
+	void BuildNode(int32 NodeIndex, int32 First, int32 Count);
+
+	FVector GetLocalLocation(FVector Location) const;
+
+
+	/*----------------------------------------------------
+		Data
+	----------------------------------------------------*/
+
+	USceneComponent*                       Root;
+
+	// Static components, in tree order
+	TArray<ComponentBounds>                Bounds;
+	TArray<Node>                           Nodes;
+
+	// Components moving relative to the root, always tested
+	TArray<ComponentBounds>                MobileBounds;
+
+};
@@ -5,6 +5,8 @@
 #include "FlareShell.h"
 #include "FlareSpacecraftSubComponent.h"
 
+#include "../Game/FlareSkirmishManager.h"
+
 DECLARE_CYCLE_STAT(TEXT("FlareTurret Tick"), STAT_FlareTurret_Tick, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareTurret Update"), STAT_FlareTurret_Update, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareTurret IsReacheableAxis"), STAT_FlareTurret_IsReacheableAxis, STATGROUP_Flare);
@@ -19,6 +21,8 @@ UFlareTurret::UFlareTurret(const class FObjectInitializer& PCIP)
 	: Super(PCIP)
 	, TurretComponent(NULL)
 	, BarrelComponent(NULL)
+	, TurretSlot(NULL)
+	, TurretSlotStepAngle(0)
 {
 	HasFlickeringLights = false;
 }
@@ -33,6 +37,27 @@ void UFlareTurret::Initialize(FFlareSpacecraftComponentSave* Data, UFlareCompany
 	Super::Initialize(Data, Company, OwnerShip, IsInMenu);
 	AimDirection = FVector::ZeroVector;
 
+	// Find our ship slot once
+	TurretSlot = NULL;
+	TurretSlotStepAngle = 0;
+	if (Spacecraft && ShipComponentData)
+	{
+		FFlareSpacecraftDescription* Desc = Spacecraft->GetParent()->GetDescription();
+		for (int32 i = 0; i < Desc->TurretSlots.Num(); i++)
+		{
+			if (Desc->TurretSlots[i].SlotIdentifier == ShipComponentData->ShipSlotIdentifier)
+			{
+				TurretSlot = &Desc->TurretSlots[i];
+				break;
+			}
+		}
+
+		if (TurretSlot && TurretSlot->TurretBarrelsAngleLimit.Num() > 0)
+		{
+			TurretSlotStepAngle = 360.f / (float) TurretSlot->TurretBarrelsAngleLimit.Num();
+		}
+	}
+
 	// Initialize pilot
 	Pilot = NewObject<UFlareTurretPilot>(this, UFlareTurretPilot::StaticClass());
 	Pilot->Initialize(&(Data->Pilot), Company, this);
@@ -134,6 +159,7 @@ void UFlareTurret::SetupComponentMesh()
 void UFlareTurret::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareTurret_Tick);
+	FFlareSkirmishBatchScope BatchScope(EFlareSkirmishBatchSection::Turrets);
 
 	FCHECK(Pilot);
 	if (!Spacecraft)
@@ -363,18 +389,7 @@ static inline int PositiveModulo(int i, int n)
 
 bool UFlareTurret::IsIgnoreManualAim() const
 {
-	FFlareSpacecraftDescription* Desc = Spacecraft->GetParent()->GetDescription();
-
-	for (int32 i = 0; i < Desc->TurretSlots.Num(); i++)
-	{
-		// TODO optimize and store that in cache
-		if (Desc->TurretSlots[i].SlotIdentifier == ShipComponentData->ShipSlotIdentifier)
-		{
-			return Desc->TurretSlots[i].IgnoreManualAim;
-		}
-	}
-
-	return false;
+	return TurretSlot && TurretSlot->IgnoreManualAim;
 }
 
 float UFlareTurret::GetMinLimitAtAngle(float Angle) const
@@ -382,44 +397,38 @@ float UFlareTurret::GetMinLimitAtAngle(float Angle) const
 	SCOPE_CYCLE_COUNTER(STAT_FlareTurret_GetMinLimitAtAngle);
 
 	float BarrelsMinAngle = ComponentDescription->WeaponCharacteristics.TurretCharacteristics.BarrelsMinAngle;
-	FFlareSpacecraftDescription* Desc = Spacecraft->GetParent()->GetDescription();
 
 	// Fine Local slot check
-	for (int32 i = 0; i < Desc->TurretSlots.Num(); i++)
+	if (TurretSlot)
 	{
-		// TODO optimize and store that in cache
-		if (Desc->TurretSlots[i].SlotIdentifier == ShipComponentData->ShipSlotIdentifier)
-		{
-			int LimitStepCount = Desc->TurretSlots[i].TurretBarrelsAngleLimit.Num();
+		const TArray<float>& Limits = TurretSlot->TurretBarrelsAngleLimit;
+		int LimitStepCount = Limits.Num();
 
+		if (LimitStepCount > 0)
+		{
+			float StepAngle = TurretSlotStepAngle;
 
-			if (LimitStepCount > 0)
+			float AngleInStep = Angle / StepAngle;
+			int NearestStep = FMath::FloorToInt(AngleInStep + 0.5f);
+			int SecondNearestStep;
+			if (AngleInStep > NearestStep)
 			{
-				float StepAngle = 360.f / (float) LimitStepCount;
-
-
-				float AngleInStep = Angle / StepAngle;
-				int NearestStep = FMath::FloorToInt(AngleInStep + 0.5f);
-				int SecondNearestStep;
-				if (AngleInStep > NearestStep)
-				{
-					SecondNearestStep = NearestStep+1;
-				}
-				else
-				{
-					SecondNearestStep = NearestStep-1;
-				}
+				SecondNearestStep = NearestStep+1;
+			}
+			else
+			{
+				SecondNearestStep = NearestStep-1;
+			}
 
-				float Ratio = FMath::Abs(Angle - NearestStep * StepAngle) /  StepAngle;
+			float Ratio = FMath::Abs(Angle - NearestStep * StepAngle) /  StepAngle;
 
-				float LocalMin = Desc->TurretSlots[i].TurretBarrelsAngleLimit[PositiveModulo(NearestStep, LimitStepCount)] * (1.f - Ratio)
-									+ Desc->TurretSlots[i].TurretBarrelsAngleLimit[PositiveModulo(SecondNearestStep,LimitStepCount)] * Ratio;
+			float LocalMin = Limits[PositiveModulo(NearestStep, LimitStepCount)] * (1.f - Ratio)
+								+ Limits[PositiveModulo(SecondNearestStep,LimitStepCount)] * Ratio;
 
-				BarrelsMinAngle = FMath::Max(BarrelsMinAngle, LocalMin);
-			}
+			BarrelsMinAngle = FMath::Max(BarrelsMinAngle, LocalMin);
 		}
-
 	}
+
 	return BarrelsMinAngle;
 }
 
@@ -69,6 +69,10 @@ protected:
 	// General data
 	FVector  								         AimDirection;
 
+	// Ship slot of this turret, resolved at initialization
+	const FFlareSpacecraftSlotDescription*           TurretSlot;
+	float                                            TurretSlotStepAngle;
+
 
 public:
 
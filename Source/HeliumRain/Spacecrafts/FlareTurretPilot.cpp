@@ -314,6 +314,11 @@ void UFlareTurretPilot::ProcessTurretTargetSelection()
 	{
 		PilotTarget = GetNearestHostileTarget(false, Tactic);
 	}
+
+	if (PilotTarget != OldPilotTargetShip)
+	{
+		Turret->GetSpacecraft()->GetGame()->GetPC()->NotifyPilotTargetChanged(Turret->GetSpacecraft(), PilotTarget.SpacecraftTarget);
+	}
 }
 
 PilotHelper::PilotTarget UFlareTurretPilot::GetNearestHostileTarget(bool ReachableOnly, EFlareCombatTactic::Type Tactic) const
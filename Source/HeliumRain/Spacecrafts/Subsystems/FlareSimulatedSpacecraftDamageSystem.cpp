@@ -8,6 +8,7 @@
 #include "../../Data/FlareSpacecraftComponentsCatalog.h"
 
 #include "../../Game/FlareGame.h"
+#include "../../Game/FlareFleet.h"
 #include "../../Game/FlareSkirmishManager.h"
 #include "../../Game/FlarePlanetarium.h"
 
@@ -49,6 +50,7 @@ void UFlareSimulatedSpacecraftDamageSystem::Initialize(UFlareSimulatedSpacecraft
 	DamageDirty = true;
 	AmmoDirty = true;
 	IsPoweredCacheIndex = 0;
+	DamageRevision = 0;
 
 	for (int32 Index = EFlareSubsystem::SYS_None; Index <= EFlareSubsystem::SYS_WeaponAndAmmo; Index++)
 	{
@@ -283,6 +285,14 @@ float UFlareSimulatedSpacecraftDamageSystem::Repair(FFlareSpacecraftComponentDes
 		//FLOGV("%s %s repair %f for %f fs (damage ratio: %f)",  *Spacecraft->GetImmatriculation().ToString(),  *ComponentData->ShipSlotIdentifier.ToString(), RepairRatio, RepairCost, GetDamageRatio(ComponentDescription, ComponentData));
 
 		Spacecraft->GetCompany()->InvalidateCompanyValueCache();
+		if (Spacecraft->GetCurrentFleet())
+		{
+			Spacecraft->GetCurrentFleet()->InvalidateCargoCache();
+		}
+		if (Spacecraft->GetCurrentSector())
+		{
+			Spacecraft->GetCurrentSector()->InvalidateBattleState();
+		}
 
 		if (Spacecraft->IsActive())
 		{
@@ -341,6 +351,14 @@ float UFlareSimulatedSpacecraftDamageSystem::Refill(FFlareSpacecraftComponentDes
 		FLOGV("ComponentData->Weapon.FiredAmmo %d,",ComponentData->Weapon.FiredAmmo);
 */
 		Spacecraft->GetCompany()->InvalidateCompanyValueCache();
+		if (Spacecraft->GetCurrentFleet())
+		{
+			Spacecraft->GetCurrentFleet()->InvalidateCargoCache();
+		}
+		if (Spacecraft->GetCurrentSector())
+		{
+			Spacecraft->GetCurrentSector()->InvalidateBattleState();
+		}
 
 		if (Spacecraft->IsActive())
 		{
@@ -467,6 +485,14 @@ float UFlareSimulatedSpacecraftDamageSystem::ApplyDamage(FFlareSpacecraftCompone
 		}
 
 		Spacecraft->GetCompany()->InvalidateCompanyValueCache();
+		if (Spacecraft->GetCurrentFleet())
+		{
+			Spacecraft->GetCurrentFleet()->InvalidateCargoCache();
+		}
+		if (Spacecraft->GetCurrentSector())
+		{
+			Spacecraft->GetCurrentSector()->InvalidateBattleState();
+		}
 	}
 
 	LastDamageCause = DamageCause(DamageSource, DamageType);
@@ -706,6 +732,7 @@ void UFlareSimulatedSpacecraftDamageSystem::SetPowerDirty()
 void UFlareSimulatedSpacecraftDamageSystem::SetDamageDirty(FFlareSpacecraftComponentDescription* ComponentDescription)
 {
 	DamageDirty = true;
+	DamageRevision++;
 	if(ComponentDescription->GeneralCharacteristics.ElectricSystem)
 	{
 		SetPowerDirty();
@@ -715,6 +742,7 @@ void UFlareSimulatedSpacecraftDamageSystem::SetDamageDirty(FFlareSpacecraftCompo
 void UFlareSimulatedSpacecraftDamageSystem::SetAmmoDirty()
 {
 	AmmoDirty = true;
+	DamageRevision++;
 }
 
 bool UFlareSimulatedSpacecraftDamageSystem::IsPowered(FFlareSpacecraftComponentSave* ComponentToPowerData) const
@@ -151,6 +151,7 @@ protected:
 
 	TArray<float>                                   SubsystemHealth;
 	int64                                           IsPoweredCacheIndex;
+	int32                                           DamageRevision;
 
 	bool                                            DamageDirty;
 	bool                                            AmmoDirty;
@@ -183,4 +184,10 @@ public:
 
 	static float GetArmor(FFlareSpacecraftComponentDescription* ComponentDescription);
 
+	/** Get a counter incremented each time damage or ammo changes */
+	inline int32 GetDamageRevision() const
+	{
+		return DamageRevision;
+	}
+
 };
@@ -13,6 +13,7 @@
 #include "../../Player/FlareMenuManager.h"
 
 #include "../FlareEngine.h"
+#include "../FlareInternalComponent.h"
 #include "../FlareOrbitalEngine.h"
 #include "../FlareShell.h"
 
@@ -231,6 +232,7 @@ void UFlareSpacecraftDamageSystem::Start()
 {
 	// Reload components
 	Components = Spacecraft->GetComponentsByClass(UFlareSpacecraftComponent::StaticClass());
+	UpdateComponentTree();
 	Parent->TickSystem();
 
 	// Init alive status
@@ -785,8 +787,11 @@ void UFlareSpacecraftDamageSystem::ApplyDamage(float Energy, float Radius, FVect
 
 	UFlareCompany* CompanyDamageSource = (DamageSource ? DamageSource->GetCompany() : NULL);
 
-	FVector LocalLocation = Spacecraft->GetRootComponent()->GetComponentTransform().InverseTransformPosition(Location) / 100.f;
-	CombatLog::SpacecraftDamaged(Spacecraft->GetParent(), Energy, Radius, LocalLocation, DamageType, CompanyDamageSource, DamageCauser);
+	if (CombatLog::IsEnabled())
+	{
+		FVector LocalLocation = Spacecraft->GetRootComponent()->GetComponentTransform().InverseTransformPosition(Location) / 100.f;
+		CombatLog::SpacecraftDamaged(Spacecraft->GetParent(), Energy, Radius, LocalLocation, DamageType, CompanyDamageSource, DamageCauser);
+	}
 
 #if! UE_BUILD_SHIPPING
 	
@@ -800,7 +805,31 @@ void UFlareSpacecraftDamageSystem::ApplyDamage(float Energy, float Radius, FVect
 
 #endif
 
-	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	// Only check the components whose bounds can touch the damage sphere
+	TArray<int32> HitComponentIndices;
+	if (ComponentTree.IsBuilt())
+	{
+		ComponentTree.GetOverlappingComponents(Location, Radius * 100, HitComponentIndices);
+
+		if (Spacecraft->IsStation())
+		{
+			int32 CockpitIndex = Components.Find(Spacecraft->GetCockpit());
+			if (CockpitIndex != INDEX_NONE && !HitComponentIndices.Contains(CockpitIndex))
+			{
+				HitComponentIndices.Add(CockpitIndex);
+				HitComponentIndices.Sort();
+			}
+		}
+	}
+	else
+	{
+		for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+		{
+			HitComponentIndices.Add(ComponentIndex);
+		}
+	}
+
+	for (int32 ComponentIndex : HitComponentIndices)
 	{
 		UFlareSpacecraftComponent* Component = Cast<UFlareSpacecraftComponent>(Components[ComponentIndex]);
 		bool IsStationCockpit = Spacecraft->IsStation() && Spacecraft->GetCockpit() == Component;
@@ -849,6 +878,85 @@ void UFlareSpacecraftDamageSystem::ApplyDamage(float Energy, float Radius, FVect
 	}
 }
 
+void UFlareSpacecraftDamageSystem::UpdateComponentTree()
+{
+	ComponentTree.Build(Spacecraft->GetRootComponent(), Components);
+	InternalComponentTree.Build(Spacecraft->GetRootComponent(), Components, UFlareInternalComponent::StaticClass());
+}
+
+UFlareInternalComponent* UFlareSpacecraftDamageSystem::GetInternalComponentAtLocation(FVector Location, float MaxDistance) const
+{
+	return Cast<UFlareInternalComponent>(InternalComponentTree.GetNearestComponent(Location, MaxDistance));
+}
+
+int32 UFlareSpacecraftDamageSystem::CheckComponentTree(int32 HitCount)
+{
+	if (!ComponentTree.IsBuilt())
+	{
+		return 0;
+	}
+
+	FVector Origin = Spacecraft->GetRootComponent()->Bounds.Origin;
+	float Extent = Spacecraft->GetRootComponent()->Bounds.SphereRadius;
+	int32 Mismatches = 0;
+
+	for (int32 HitIndex = 0; HitIndex < HitCount; HitIndex++)
+	{
+		FVector Location = Origin + FMath::VRand() * FMath::FRandRange(0, 1.5f * Extent);
+		float Radius = FMath::FRandRange(0.1f, 20.f);
+
+		// Components hit by a full scan
+		TArray<int32> ExpectedHits;
+		for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+		{
+			UFlareSpacecraftComponent* Component = Cast<UFlareSpacecraftComponent>(Components[ComponentIndex]);
+
+			float ComponentSize;
+			FVector ComponentLocation;
+			Component->GetBoundingSphere(ComponentLocation, ComponentSize);
+
+			if (Radius + ComponentSize / 100 - (ComponentLocation - Location).Size() / 100.0f > 0)
+			{
+				ExpectedHits.Add(ComponentIndex);
+			}
+		}
+
+		// Components hit through the hierarchy
+		TArray<int32> Candidates;
+		TArray<int32> Hits;
+		ComponentTree.GetOverlappingComponents(Location, Radius * 100, Candidates);
+		for (int32 ComponentIndex : Candidates)
+		{
+			UFlareSpacecraftComponent* Component = Cast<UFlareSpacecraftComponent>(Components[ComponentIndex]);
+
+			float ComponentSize;
+			FVector ComponentLocation;
+			Component->GetBoundingSphere(ComponentLocation, ComponentSize);
+
+			if (Radius + ComponentSize / 100 - (ComponentLocation - Location).Size() / 100.0f > 0)
+			{
+				Hits.Add(ComponentIndex);
+			}
+		}
+
+		if (Hits != ExpectedHits)
+		{
+			FLOGV("UFlareSpacecraftDamageSystem::CheckComponentTree : %s hit at %s (radius %f) touches %d components, expected %d",
+				*Spacecraft->GetImmatriculation().ToString(), *Location.ToString(), Radius, Hits.Num(), ExpectedHits.Num());
+			Mismatches++;
+		}
+
+		if (Spacecraft->GetInternalComponentAtLocation(Location, true) != Spacecraft->GetInternalComponentAtLocation(Location))
+		{
+			FLOGV("UFlareSpacecraftDamageSystem::CheckComponentTree : %s internal component mismatch at %s",
+				*Spacecraft->GetImmatriculation().ToString(), *Location.ToString());
+			Mismatches++;
+		}
+	}
+
+	return Mismatches;
+}
+
 void UFlareSpacecraftDamageSystem::OnElectricDamage(float DamageRatio)
 {
 	float MaxPower = 0.f;
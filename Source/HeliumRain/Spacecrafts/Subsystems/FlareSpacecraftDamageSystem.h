@@ -3,11 +3,13 @@
 #include "../FlareSpacecraftTypes.h"
 #include "../FlareSimulatedSpacecraft.h"
 #include "FlareSimulatedSpacecraftDamageSystem.h"
+#include "../FlareSpacecraftComponentTree.h"
 #include "FlareSpacecraftDamageSystem.generated.h"
 
 
 class AFlareSpacecraft;
 class UFlareSimulatedSpacecraftDamageSystem;
+class UFlareInternalComponent;
 struct FFlareSpacecraftSave;
 struct FFlareSpacecraftDescription;
 
@@ -63,6 +65,15 @@ public:
 
 	virtual void ApplyDamage(float Energy, float Radius, FVector Location, EFlareDamage::Type DamageType, UFlareSimulatedSpacecraft* DamageSource, FString DamageCauser);
 
+	/** Rebuild the component bounds hierarchy after components were added or removed */
+	void UpdateComponentTree();
+
+	/** Get the internal component closest to a location using the component hierarchy */
+	UFlareInternalComponent* GetInternalComponentAtLocation(FVector Location, float MaxDistance) const;
+
+	/** Compare the component hierarchy to a full scan for random hits, return the mismatch count */
+	int32 CheckComponentTree(int32 HitCount);
+
 
 
 protected:
@@ -89,6 +100,8 @@ protected:
 	FFlareSpacecraftDescription*                    Description;
 	UFlareSimulatedSpacecraftDamageSystem*          Parent;
 	TArray<UActorComponent*>                        Components;
+	SpacecraftComponentTree                         ComponentTree;
+	SpacecraftComponentTree                         InternalComponentTree;
 
 	bool                                            WasControllable; // True if was controllable at the last tick
 	bool                                            WasAlive;
@@ -105,4 +118,9 @@ public:
 	{
 		return TimeSinceLastExternalDamage;
 	}
+
+	inline bool HasComponentTree() const
+	{
+		return ComponentTree.IsBuilt();
+	}
 };
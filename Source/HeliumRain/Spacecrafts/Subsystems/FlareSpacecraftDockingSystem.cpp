@@ -25,6 +25,11 @@ UFlareSpacecraftDockingSystem::UFlareSpacecraftDockingSystem(const class FObject
 	, Spacecraft(NULL)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareDockingSystem_Tick);
+
+	for (int32 Size = 0; Size < EFlarePartSize::Num; Size++)
+	{
+		FreeSlotCount[Size] = 0;
+	}
 }
 
 
@@ -112,18 +117,13 @@ void UFlareSpacecraftDockingSystem::Start()
 			ConnectorCount++;
 		}
 	}
+
+	BuildDockIndex();
 }
 
 bool UFlareSpacecraftDockingSystem::HasCompatibleDock(AFlareSpacecraft* Ship) const
 {
-	for (int32 i = 0; i < DockingSlots.Num(); i++)
-	{
-		if (DockingSlots[i].DockSize == Ship->GetSize())
-		{
-			return true;
-		}
-	}
-	return false;
+	return SizeSlots[Ship->GetSize()].Num() > 0;
 }
 
 FFlareDockingInfo UFlareSpacecraftDockingSystem::RequestDock(AFlareSpacecraft* Ship, FVector PreferredLocation)
@@ -148,44 +148,12 @@ FFlareDockingInfo UFlareSpacecraftDockingSystem::RequestDock(AFlareSpacecraft* S
 		}
 	}
 
-	auto CheckDockingSlot = [&Ship, &PreferredLocation](FFlareDockingInfo const& Slot, float& DockDistance, bool OnlyFreeSlot)
-	{
-		if(OnlyFreeSlot && Slot.Granted)
-		{
-			return false;
-		}
-
-		if (Slot.DockSize == Ship->GetSize())
-		{
-			DockDistance = (Slot.Station->Airframe->GetComponentToWorld().TransformPosition(Slot.LocalLocation) - PreferredLocation).Size();
-			return true;
-		}
-
-		return false;
-	};
-
-	auto CheckDockingSlots = [&CheckDockingSlot](FFlareDockingInfo*& BestDockingSlot, float& BestDistance, TArray<FFlareDockingInfo>& Slots, bool OnlyFreeSlot)
-	{
-		for(FFlareDockingInfo& Slot : Slots)
-		{
-			float DockDistance = 0;
-			if(CheckDockingSlot(Slot, DockDistance, OnlyFreeSlot))
-			{
-				if(BestDockingSlot == nullptr || DockDistance < BestDistance)
-				{
-					BestDockingSlot = &Slot;
-					BestDistance = DockDistance;
-				}
-			}
-		}
-	};
-
-	auto FindBestDockingSlot = [this, &CheckDockingSlots](bool OnlyFreeSlot)
+	auto FindBestDockingSlot = [this, &Ship, &PreferredLocation](bool OnlyFreeSlot)
 	{
-		FFlareDockingInfo* BestDockingSlot = nullptr;
+		const FFlareDockingInfo* BestDockingSlot = nullptr;
 		float BestDistance = 0;
 
-		CheckDockingSlots(BestDockingSlot, BestDistance, DockingSlots, OnlyFreeSlot);
+		FindNearestDock(Ship->GetSize(), PreferredLocation, OnlyFreeSlot, BestDockingSlot, BestDistance);
 
 		if(Spacecraft->GetParent()->IsComplex())
 		{
@@ -193,19 +161,10 @@ FFlareDockingInfo UFlareSpacecraftDockingSystem::RequestDock(AFlareSpacecraft* S
 			{
 				if(MasterConnector.Occupied)
 				{
-					AFlareSpacecraft* ChildStation = NULL;
-					for(AFlareSpacecraft* StationCandidate : Spacecraft->GetGame()->GetActiveSector()->GetSpacecrafts())
-					{
-						if (StationCandidate->GetImmatriculation() == MasterConnector.ConnectedStationName)
-						{
-							ChildStation = StationCandidate;
-							break;
-						}
-					}
-
+					AFlareSpacecraft* ChildStation = Spacecraft->GetGame()->GetActiveSector()->FindSpacecraft(MasterConnector.ConnectedStationName);
 					if(ChildStation)
 					{
-						CheckDockingSlots(BestDockingSlot, BestDistance, ChildStation->GetDockingSystem()->GetDockingSlots(), OnlyFreeSlot);
+						ChildStation->GetDockingSystem()->FindNearestDock(Ship->GetSize(), PreferredLocation, OnlyFreeSlot, BestDockingSlot, BestDistance);
 					}
 				}
 			}
@@ -217,20 +176,21 @@ FFlareDockingInfo UFlareSpacecraftDockingSystem::RequestDock(AFlareSpacecraft* S
 
 
 	// Looking for nearest available slot
-	FFlareDockingInfo* BestDockingSlot = FindBestDockingSlot(true);
+	const FFlareDockingInfo* BestDockingSlot = FindBestDockingSlot(true);
 
-	auto GrantSlot = [](FFlareDockingInfo* Slot, AFlareSpacecraft* Ship)
+	// Slots may belong to a child station of a complex
+	auto GrantSlot = [](const FFlareDockingInfo* Slot, AFlareSpacecraft* Ship)
 	{
-		Slot->Granted = true;
-		Slot->Ship = Ship;
+		UFlareSpacecraftDockingSystem* SlotDockingSystem = Slot->Station->GetDockingSystem();
+		SlotDockingSystem->UpdateSlot(Slot->DockId, true, Slot->Occupied, Ship);
+		return SlotDockingSystem->GetDockInfo(Slot->DockId);
 	};
 
 
 	if(BestDockingSlot)
 	{
 		// Granted
-		GrantSlot(BestDockingSlot, Ship);
-		return *BestDockingSlot;
+		return GrantSlot(BestDockingSlot, Ship);
 	}
 	// Denied, but player ship, so undock an AI ship
 	else if (Ship->IsPlayerShip())
@@ -253,8 +213,7 @@ FFlareDockingInfo UFlareSpacecraftDockingSystem::RequestDock(AFlareSpacecraft* S
 			}
 
 			// Grant dock
-			GrantSlot(BestDockingSlot, Ship);
-			return *BestDockingSlot;
+			return GrantSlot(BestDockingSlot, Ship);
 		}
 	}
 
@@ -270,48 +229,50 @@ FFlareDockingInfo UFlareSpacecraftDockingSystem::RequestDock(AFlareSpacecraft* S
 void UFlareSpacecraftDockingSystem::ReleaseDock(AFlareSpacecraft* Ship, int32 DockId)
 {
 	FLOGV("UFlareSpacecraftDockingSystem::ReleaseDock %d ('%s')", DockId, *Ship->GetParent()->GetImmatriculation().ToString());
-	DockingSlots[DockId].Granted = false;
-	DockingSlots[DockId].Occupied = false;
-	DockingSlots[DockId].Ship = NULL;
+	UpdateSlot(DockId, false, false, NULL);
 }
 
 void UFlareSpacecraftDockingSystem::Dock(AFlareSpacecraft* Ship, int32 DockId)
 {
 	FLOGV("UFlareSpacecraftDockingSystem::Dock %d ('%s')", DockId, *Ship->GetParent()->GetImmatriculation().ToString());
-	DockingSlots[DockId].Granted = true;
-	DockingSlots[DockId].Occupied = true;
-	DockingSlots[DockId].Ship = Ship;
+	UpdateSlot(DockId, true, true, Ship);
 
 	Spacecraft->GetGame()->GetQuestManager()->OnShipDocked(Spacecraft->GetParent(), Ship->GetParent());
 }
 
-TArray<AFlareSpacecraft*> UFlareSpacecraftDockingSystem::GetDockedShips()
+bool UFlareSpacecraftDockingSystem::HasAvailableDock(AFlareSpacecraft* Ship) const
+{
+	return FreeSlotCount[Ship->GetSize()] > 0;
+}
+
+int UFlareSpacecraftDockingSystem::GetDockCount() const
+{
+	return DockingSlots.Num();
+}
+
+FFlareDockingInfo UFlareSpacecraftDockingSystem::GetDockInfo(int32 DockId)
 {
-	TArray<AFlareSpacecraft*> Result;
+	return DockingSlots[DockId];
+}
 
-	for (int32 i = 0; i < DockingSlots.Num(); i++)
+bool UFlareSpacecraftDockingSystem::IsGrantedShip(AFlareSpacecraft* ShipCanditate) const
+{
+	for (auto It = ShipSlots.CreateConstKeyIterator(ShipCanditate); It; ++It)
 	{
-		if (DockingSlots[i].Granted && DockingSlots[i].Occupied)
+		if (GrantedSlots[It.Value()])
 		{
-			//FLOGV("UFlareSpacecraftDockingSystem::GetDockedShips : found valid dock %d", i);
-			Result.AddUnique(DockingSlots[i].Ship);
+			return true;
 		}
 	}
 
-	return Result;
+	return false;
 }
 
-bool UFlareSpacecraftDockingSystem::HasAvailableDock(AFlareSpacecraft* Ship) const
+bool UFlareSpacecraftDockingSystem::IsDockedShip(AFlareSpacecraft* ShipCanditate) const
 {
-	// Looking for slot
-	for (int32 i = 0; i < DockingSlots.Num(); i++)
+	for (auto It = ShipSlots.CreateConstKeyIterator(ShipCanditate); It; ++It)
 	{
-		if (DockingSlots[i].DockSize != Ship->GetSize())
-		{
-			continue;
-		}
-
-		if (!DockingSlots[i].Granted)
+		if (OccupiedSlots[It.Value()])
 		{
 			return true;
 		}
@@ -320,40 +281,245 @@ bool UFlareSpacecraftDockingSystem::HasAvailableDock(AFlareSpacecraft* Ship) con
 	return false;
 }
 
-int UFlareSpacecraftDockingSystem::GetDockCount() const
+void UFlareSpacecraftDockingSystem::FindNearestDock(EFlarePartSize::Type Size, FVector PreferredLocation, bool OnlyFreeSlot, const FFlareDockingInfo*& BestSlot, float& BestDistance) const
 {
-	return DockingSlots.Num();
+	if (OnlyFreeSlot && FreeSlotCount[Size] == 0)
+	{
+		return;
+	}
+
+	// Compare distances in station space, with a single transform
+	const FTransform& StationTransform = Spacecraft->Airframe->GetComponentToWorld();
+	FVector LocalPreferredLocation = StationTransform.InverseTransformPosition(PreferredLocation);
+	float Scale = StationTransform.GetMaximumAxisScale();
+
+	for (int32 DockId : SizeSlots[Size])
+	{
+		if (OnlyFreeSlot && GrantedSlots[DockId])
+		{
+			continue;
+		}
+
+		float DockDistance = Scale * (DockingSlots[DockId].LocalLocation - LocalPreferredLocation).Size();
+		if (BestSlot == nullptr || DockDistance < BestDistance)
+		{
+			BestSlot = &DockingSlots[DockId];
+			BestDistance = DockDistance;
+		}
+	}
 }
 
-FFlareDockingInfo UFlareSpacecraftDockingSystem::GetDockInfo(int32 DockId)
+void UFlareSpacecraftDockingSystem::UpdateSlot(int32 DockId, bool Granted, bool Occupied, AFlareSpacecraft* Ship)
 {
-	return DockingSlots[DockId];
+	FFlareDockingInfo& Slot = DockingSlots[DockId];
+
+	if (Slot.Granted != Granted)
+	{
+		FreeSlotCount[Slot.DockSize] += (Granted ? -1 : 1);
+	}
+
+	if (Slot.Ship != Ship)
+	{
+		if (Slot.Ship)
+		{
+			ShipSlots.RemoveSingle(Slot.Ship, DockId);
+		}
+		if (Ship)
+		{
+			ShipSlots.Add(Ship, DockId);
+		}
+	}
+
+	Slot.Granted = Granted;
+	Slot.Occupied = Occupied;
+	Slot.Ship = Ship;
+	GrantedSlots[DockId] = Granted;
+	OccupiedSlots[DockId] = Occupied;
 }
 
-bool UFlareSpacecraftDockingSystem::IsGrantedShip(AFlareSpacecraft* ShipCanditate) const
+int32 UFlareSpacecraftDockingSystem::CheckDockIndex(const TArray<AFlareSpacecraft*>& Ships, int32 Iterations)
 {
-	for (int32 i = 0; i < DockingSlots.Num(); i++)
+	if (Ships.Num() == 0 || DockingSlots.Num() == 0)
 	{
-		if (DockingSlots[i].Granted && DockingSlots[i].Ship == ShipCanditate)
+		return 0;
+	}
+
+	TArray<FFlareDockingInfo> SavedSlots = DockingSlots;
+	int32 Mismatches = ValidateDockIndex();
+
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		AFlareSpacecraft* Ship = Ships[FMath::RandRange(0, Ships.Num() - 1)];
+		const int32* DockId = ShipSlots.Find(Ship);
+
+		// Grant the nearest free dock to a random location
+		if (!DockId)
 		{
-			return true;
+			const FFlareDockingInfo* BestSlot = nullptr;
+			float BestDistance = 0;
+			FVector Location = Spacecraft->GetActorLocation() + FMath::VRand() * Spacecraft->GetMeshScale();
+			FindNearestDock(Ship->GetSize(), Location, true, BestSlot, BestDistance);
+
+			if (BestSlot)
+			{
+				UpdateSlot(BestSlot->DockId, true, false, Ship);
+			}
 		}
+
+		// Dock or release
+		else if (!OccupiedSlots[*DockId] && FMath::RandBool())
+		{
+			UpdateSlot(*DockId, true, true, Ship);
+		}
+		else
+		{
+			UpdateSlot(*DockId, false, false, NULL);
+		}
+
+		Mismatches += ValidateDockIndex();
+
+		// Compare queries with a full scan
+		bool Granted = false;
+		bool Docked = false;
+		for (const FFlareDockingInfo& Slot : DockingSlots)
+		{
+			Granted |= (Slot.Granted && Slot.Ship == Ship);
+			Docked |= (Slot.Occupied && Slot.Ship == Ship);
+		}
+		Mismatches += (IsGrantedShip(Ship) != Granted) + (IsDockedShip(Ship) != Docked);
 	}
 
-	return false;
+	// Restore the docks
+	DockingSlots = SavedSlots;
+	BuildDockIndex();
+
+	return Mismatches;
 }
 
-bool UFlareSpacecraftDockingSystem::IsDockedShip(AFlareSpacecraft* ShipCanditate) const
+
+/*----------------------------------------------------
+	Dock index
+----------------------------------------------------*/
+
+void UFlareSpacecraftDockingSystem::BuildDockIndex()
 {
-	for (int32 i = 0; i < DockingSlots.Num(); i++)
+	GrantedSlots.Init(false, DockingSlots.Num());
+	OccupiedSlots.Init(false, DockingSlots.Num());
+	ShipSlots.Empty();
+
+	for (int32 Size = 0; Size < EFlarePartSize::Num; Size++)
+	{
+		SizeSlots[Size].Empty();
+		FreeSlotCount[Size] = 0;
+	}
+
+	for (int32 DockId = 0; DockId < DockingSlots.Num(); DockId++)
 	{
-		if (DockingSlots[i].Occupied && DockingSlots[i].Ship == ShipCanditate)
+		const FFlareDockingInfo& Slot = DockingSlots[DockId];
+
+		GrantedSlots[DockId] = Slot.Granted;
+		OccupiedSlots[DockId] = Slot.Occupied;
+		SizeSlots[Slot.DockSize].Add(DockId);
+
+		if (!Slot.Granted)
 		{
-			return true;
+			FreeSlotCount[Slot.DockSize]++;
+		}
+
+		if (Slot.Ship)
+		{
+			ShipSlots.Add(Slot.Ship, DockId);
 		}
 	}
+}
 
-	return false;
+int32 UFlareSpacecraftDockingSystem::ValidateDockIndex() const
+{
+	int32 Mismatches = 0;
+	int32 FreeCount[EFlarePartSize::Num] = {};
+	int32 ShipCount = 0;
+
+	for (int32 DockId = 0; DockId < DockingSlots.Num(); DockId++)
+	{
+		const FFlareDockingInfo& Slot = DockingSlots[DockId];
+
+		if (GrantedSlots[DockId] != Slot.Granted || OccupiedSlots[DockId] != Slot.Occupied || !SizeSlots[Slot.DockSize].Contains(DockId))
+		{
+			Mismatches++;
+		}
+
+		if (!Slot.Granted)
+		{
+			FreeCount[Slot.DockSize]++;
+		}
+
+		if (Slot.Ship)
+		{
+			ShipCount++;
+			if (!ShipSlots.FindPair(Slot.Ship, DockId))
+			{
+				Mismatches++;
+			}
+		}
+	}
+
+	for (int32 Size = 0; Size < EFlarePartSize::Num; Size++)
+	{
+		if (FreeCount[Size] != FreeSlotCount[Size])
+		{
+			Mismatches++;
+		}
+	}
+
+	if (ShipCount != ShipSlots.Num())
+	{
+		Mismatches++;
+	}
+
+	return Mismatches;
+}
+
+
+/*----------------------------------------------------
+	Docked ships iterator
+----------------------------------------------------*/
+
+FFlareDockedShips::FIterator::FIterator(const UFlareSpacecraftDockingSystem* InDockingSystem, int32 InDockId)
+	: DockingSystem(InDockingSystem)
+	, DockId(InDockId)
+{
+	SkipFreeSlots();
+}
+
+FFlareDockedShips::FIterator& FFlareDockedShips::FIterator::operator++()
+{
+	DockId++;
+	SkipFreeSlots();
+	return *this;
+}
+
+AFlareSpacecraft* FFlareDockedShips::FIterator::operator*() const
+{
+	return DockingSystem->GetDockingSlots()[DockId].Ship;
+}
+
+void FFlareDockedShips::FIterator::SkipFreeSlots()
+{
+	int32 DockCount = DockingSystem->GetDockCount();
+	while (DockId < DockCount && !DockingSystem->IsDockedSlot(DockId))
+	{
+		DockId++;
+	}
+}
+
+FFlareDockedShips::FIterator FFlareDockedShips::begin() const
+{
+	return FIterator(DockingSystem, 0);
+}
+
+FFlareDockedShips::FIterator FFlareDockedShips::end() const
+{
+	return FIterator(DockingSystem, DockingSystem->GetDockCount());
 }
 
 
@@ -4,6 +4,7 @@
 #include "FlareSpacecraftDockingSystem.generated.h"
 
 class AFlareSpacecraft;
+class UFlareSpacecraftDockingSystem;
 
 
 /** Docking data */
@@ -37,6 +38,48 @@ struct FFlareDockingInfo
 	{}
 };
 
+/** Ships docked at a station, iterated without allocation */
+class HELIUMRAIN_API FFlareDockedShips
+{
+public:
+
+	class FIterator
+	{
+	public:
+
+		FIterator(const UFlareSpacecraftDockingSystem* InDockingSystem, int32 InDockId);
+
+		FIterator& operator++();
+
+		AFlareSpacecraft* operator*() const;
+
+		bool operator!=(const FIterator& Other) const
+		{
+			return DockId != Other.DockId;
+		}
+
+	protected:
+
+		/** Move to the first docked slot at or after DockId */
+		void SkipFreeSlots();
+
+		const UFlareSpacecraftDockingSystem*        DockingSystem;
+		int32                                       DockId;
+	};
+
+	FFlareDockedShips(const UFlareSpacecraftDockingSystem* InDockingSystem)
+		: DockingSystem(InDockingSystem)
+	{}
+
+	FIterator begin() const;
+
+	FIterator end() const;
+
+protected:
+
+	const UFlareSpacecraftDockingSystem*            DockingSystem;
+};
+
 /** Spacecraft docking system class */
 UCLASS()
 class HELIUMRAIN_API UFlareSpacecraftDockingSystem : public UObject
@@ -65,8 +108,11 @@ public:
 		Docking API
 	----------------------------------------------------*/
 
-	/** Get the list of docked ships */
-	virtual TArray<AFlareSpacecraft*> GetDockedShips();
+	/** Get the docked ships, to use in a range-based for loop */
+	FFlareDockedShips GetDockedShips() const
+	{
+		return FFlareDockedShips(this);
+	}
 
 	/** Request a docking point */
 	virtual FFlareDockingInfo RequestDock(AFlareSpacecraft* Ship, FVector PreferredLocation);
@@ -90,13 +136,38 @@ public:
 
 	virtual bool IsDockedShip(AFlareSpacecraft* ShipCanditate) const;
 
-	TArray<FFlareDockingInfo>& GetDockingSlots()
+	/** Find the free (or any) dock of this size closest to a location, if closer than BestDistance */
+	void FindNearestDock(EFlarePartSize::Type Size, FVector PreferredLocation, bool OnlyFreeSlot, const FFlareDockingInfo*& BestSlot, float& BestDistance) const;
+
+	/** Change the state of a dock, keeping the dock index up to date */
+	void UpdateSlot(int32 DockId, bool Granted, bool Occupied, AFlareSpacecraft* Ship);
+
+	/** Grant, dock and release random docks for these ships, compare the index with a full scan and restore the docks. Return the mismatch count. */
+	int32 CheckDockIndex(const TArray<AFlareSpacecraft*>& Ships, int32 Iterations);
+
+	const TArray<FFlareDockingInfo>& GetDockingSlots() const
 	{
 		return DockingSlots;
 	}
 
+	inline bool IsDockedSlot(int32 DockId) const
+	{
+		return GrantedSlots[DockId] && OccupiedSlots[DockId];
+	}
+
 protected:
 
+	/*----------------------------------------------------
+		Dock index
+	----------------------------------------------------*/
+
+	/** Rebuild the occupancy bits, size buckets and ship map from the docks */
+	void BuildDockIndex();
+
+	/** Compare the dock index with the docks. Return the mismatch count. */
+	int32 ValidateDockIndex() const;
+
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -110,4 +181,11 @@ protected:
 	// Dock data
 	TArray<FFlareDockingInfo>                       DockingSlots;
 
+	// Dock index
+	TBitArray<>                                     GrantedSlots;
+	TBitArray<>                                     OccupiedSlots;
+	TArray<int32>                                   SizeSlots[EFlarePartSize::Num];
+	int32                                           FreeSlotCount[EFlarePartSize::Num];
+	TMultiMap<AFlareSpacecraft*, int32>             ShipSlots;
+
 };
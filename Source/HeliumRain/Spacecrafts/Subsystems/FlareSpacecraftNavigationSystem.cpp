@@ -5,6 +5,7 @@
 #include "../FlareSpacecraft.h"
 #include "../FlareEngine.h"
 #include "../../Game/FlareGame.h"
+#include "../../Game/FlareSkirmishManager.h"
 #include "../../Player/FlarePlayerController.h"
 #include "../FlareOrbitalEngine.h"
 #include "../FlarePilotHelper.h"
@@ -40,6 +41,8 @@ UFlareSpacecraftNavigationSystem::UFlareSpacecraftNavigationSystem(const class F
 	, LinearMaxDockingVelocity(10)
 	, NegligibleSpeedRatio(0.0005)
 	, HasUsedOrbitalBoost(false)
+	, EngineEnvelopeRevision(0)
+	, EngineEnvelopeValid(false)
 {
 	AnticollisionAngle = FMath::FRandRange(0, 360);
 	DockConstraint = NULL;
@@ -53,6 +56,7 @@ UFlareSpacecraftNavigationSystem::UFlareSpacecraftNavigationSystem(const class F
 void UFlareSpacecraftNavigationSystem::TickSystem(float DeltaSeconds)
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_Tick);
+	FFlareSkirmishBatchScope BatchScope(EFlareSkirmishBatchSection::Navigation);
 
 	UpdateCOM();
 
@@ -1102,8 +1106,6 @@ bool UFlareSpacecraftNavigationSystem::UpdateLinearAttitudeAuto(float DeltaSecon
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_UpdateLinearAttitudeAuto);
 
-	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
-
 	FVector DeltaPosition = (TargetLocation - Spacecraft->GetActorLocation()) / 100; // Distance in meters
 	FVector DeltaPositionDirection = DeltaPosition;
 	DeltaPositionDirection.Normalize();
@@ -1122,7 +1124,7 @@ bool UFlareSpacecraftNavigationSystem::UpdateLinearAttitudeAuto(float DeltaSecon
 	else
 	{
 
-		FVector Acceleration = GetTotalMaxThrustInAxis(Engines, DeltaVelocityAxis, false) / Spacecraft->GetSpacecraftMass();
+		FVector Acceleration = GetTotalMaxThrustInAxis(DeltaVelocityAxis, false) / Spacecraft->GetSpacecraftMass();
 		float AccelerationInAngleAxis =  FMath::Abs(FVector::DotProduct(Acceleration, DeltaPositionDirection));
 
 		// TODO: Fix security ratio engine flickering
@@ -1191,8 +1193,6 @@ bool UFlareSpacecraftNavigationSystem::UpdateAngularAttitudeAuto(FFlareShipComma
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_UpdateAngularAttitudeAuto);
 
-	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
-
 	// Rotation data
 	FVector TargetAxis = Command.RotationTarget;
 	FVector LocalShipAxis = Command.LocalShipAxis;
@@ -1226,7 +1226,7 @@ bool UFlareSpacecraftNavigationSystem::UpdateAngularAttitudeAuto(FFlareShipComma
 	else {
 		FVector SimpleAcceleration = DeltaVelocityAxis * AngularAccelerationRate;
 		// Scale with damages
-		float DamageRatio = GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, true) / GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, false);
+		float DamageRatio = GetTotalMaxTorqueDamageRatioInAxis(DeltaVelocityAxis);
 		FVector DamagedSimpleAcceleration = SimpleAcceleration * DamageRatio;
 
 		FVector Acceleration = DamagedSimpleAcceleration;
@@ -1271,8 +1271,6 @@ FVector UFlareSpacecraftNavigationSystem::GetAngularVelocityToAlignAxis(FVector
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_GetAngularVelocityToAlignAxis);
 
-	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
-
 	FVector AngularVelocity = Spacecraft->Airframe->GetPhysicsAngularVelocityInDegrees();
 	FVector WorldShipAxis = Spacecraft->Airframe->GetComponentToWorld().GetRotation().RotateVector(LocalShipAxis);
 
@@ -1297,7 +1295,7 @@ FVector UFlareSpacecraftNavigationSystem::GetAngularVelocityToAlignAxis(FVector
 	else {
 		FVector SimpleAcceleration = DeltaVelocityAxis * GetAngularAccelerationRate();
 		// Scale with damages
-		float DamageRatio = GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, true) / GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, false);
+		float DamageRatio = GetTotalMaxTorqueDamageRatioInAxis(DeltaVelocityAxis);
 		FVector DamagedSimpleAcceleration = SimpleAcceleration * DamageRatio;
 
 		FVector Acceleration = DamagedSimpleAcceleration;
@@ -1573,10 +1571,10 @@ void UFlareSpacecraftNavigationSystem::PhysicSubTick(float DeltaSeconds)
 		FVector SimpleAcceleration = DeltaAngularVAxis * AngularAccelerationRate;
 
 		// Scale with damages
-		float TotalMaxTorqueInAxis = GetTotalMaxTorqueInAxis(Engines, DeltaAngularVAxis, false);
+		float TotalMaxTorqueInAxis = GetTotalMaxTorqueInAxis(DeltaAngularVAxis, false);
 		if (!FMath::IsNearlyZero(TotalMaxTorqueInAxis))
 		{
-			float DamageRatio = GetTotalMaxTorqueInAxis(Engines, DeltaAngularVAxis, true) / TotalMaxTorqueInAxis;
+			float DamageRatio = GetTotalMaxTorqueDamageRatioInAxis(DeltaAngularVAxis);
 			FVector DamagedSimpleAcceleration = SimpleAcceleration * DamageRatio;
 			FVector ClampedSimplifiedAcceleration = DamagedSimpleAcceleration.GetClampedToMaxSize(DeltaAngularV.Size() / DeltaSeconds);
 
@@ -1624,36 +1622,26 @@ void UFlareSpacecraftNavigationSystem::UpdateCOM()
 		Getters (Attitude)
 ----------------------------------------------------*/
 
-FVector UFlareSpacecraftNavigationSystem::GetTotalMaxThrustInAxis(TArray<UActorComponent*>& Engines, FVector Axis, bool WithOrbitalEngines) const
+FVector UFlareSpacecraftNavigationSystem::GetTotalMaxThrustInAxis(FVector Axis, bool WithOrbitalEngines) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_GetTotalMaxThrustInAxis);
 
-	Axis.Normalize();
-	FVector TotalMaxThrust = FVector::ZeroVector;
-	for (int32 i = 0; i < Engines.Num(); i++)
-	{
-		UFlareEngine* Engine = Cast<UFlareEngine>(Engines[i]);
+	UpdateEngineEnvelope();
 
-		FVector WorldThrustAxis = Engine->GetThrustAxis();
-		float Ratio = FVector::DotProduct(WorldThrustAxis, Axis);
+	FQuat AirframeRotation = Spacecraft->Airframe->GetComponentToWorld().GetRotation();
+	FVector LocalAxis = AirframeRotation.UnrotateVector(Axis.GetSafeNormal());
+	FVector TotalMaxThrust = FVector::ZeroVector;
 
-		/*if (Engine->IsA(UFlareOrbitalEngine::StaticClass()))
+	for (const FFlareEngineEnvelope& Engine : EngineEnvelope)
+	{
+		float Ratio = FVector::DotProduct(Engine.ThrustAxis, LocalAxis);
+		if (Ratio > 0)
 		{
-			if(WithOrbitalEngines && Ratio + 0.2 > 0)
-			{
-				TotalMaxThrust += WorldThrustAxis * Engine->GetMaxThrust() * (Ratio + 0.2);
-			}
+			TotalMaxThrust += Engine.ThrustAxis * Engine.InitialMaxThrust * Engine.ComponentRatio * Ratio;
 		}
-		else
-		{*/
-			if (Ratio > 0)
-			{
-				TotalMaxThrust += WorldThrustAxis * Engine->GetMaxThrust() * Ratio;
-			}
-		/*}*/
 	}
 
-	return TotalMaxThrust;
+	return AirframeRotation.RotateVector(TotalMaxThrust) * GetEngineEnvelopeShipRatio();
 }
 
 float UFlareSpacecraftNavigationSystem::GetTotalMaxThrustWithEngines(TArray<UActorComponent*>& Engines, TArray<int>& UsefulEngines, bool WithOrbitalEngines)
@@ -1680,10 +1668,205 @@ float UFlareSpacecraftNavigationSystem::GetTotalMaxThrustWithEngines(TArray<UAct
 }
 
 
-float UFlareSpacecraftNavigationSystem::GetTotalMaxTorqueInAxis(TArray<UActorComponent*>& Engines, FVector TorqueAxis, bool WithDamages) const
+float UFlareSpacecraftNavigationSystem::GetTotalMaxTorqueInAxis(FVector TorqueAxis, bool WithDamages) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_GetTotalMaxTorqueInAxis);
 
+	UpdateEngineEnvelope();
+
+	FVector LocalAxis = Spacecraft->Airframe->GetComponentToWorld().GetRotation().UnrotateVector(TorqueAxis.GetSafeNormal());
+	float TotalMaxTorque = 0;
+
+	for (const FFlareEngineEnvelope& Engine : EngineEnvelope)
+	{
+		float Ratio = FVector::DotProduct(LocalAxis, Engine.TorqueAxis);
+		if (Ratio > 0 && !Engine.IsOrbital)
+		{
+			TotalMaxTorque += Engine.TorqueArm * Engine.InitialMaxThrust * (WithDamages ? Engine.ComponentRatio : 1.0f) * Ratio;
+		}
+	}
+
+	return TotalMaxTorque * (WithDamages ? GetEngineEnvelopeShipRatio() : 1.0f);
+}
+
+float UFlareSpacecraftNavigationSystem::GetTotalMaxTorqueDamageRatioInAxis(FVector TorqueAxis) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_GetTotalMaxTorqueInAxis);
+
+	UpdateEngineEnvelope();
+
+	FVector LocalAxis = Spacecraft->Airframe->GetComponentToWorld().GetRotation().UnrotateVector(TorqueAxis.GetSafeNormal());
+	float TotalMaxTorque = 0;
+	float TotalDamagedMaxTorque = 0;
+
+	for (const FFlareEngineEnvelope& Engine : EngineEnvelope)
+	{
+		float Ratio = FVector::DotProduct(LocalAxis, Engine.TorqueAxis);
+		if (Ratio > 0 && !Engine.IsOrbital)
+		{
+			float Torque = Engine.TorqueArm * Engine.InitialMaxThrust * Ratio;
+			TotalMaxTorque += Torque;
+			TotalDamagedMaxTorque += Torque * Engine.ComponentRatio;
+		}
+	}
+
+	if (TotalMaxTorque == 0)
+	{
+		return 0;
+	}
+
+	return GetEngineEnvelopeShipRatio() * TotalDamagedMaxTorque / TotalMaxTorque;
+}
+
+void UFlareSpacecraftNavigationSystem::UpdateEngineEnvelope() const
+{
+	int32 DamageRevision = Spacecraft->GetParent()->GetDamageSystem()->GetDamageRevision();
+	if (EngineEnvelopeValid && EngineEnvelopeRevision == DamageRevision)
+	{
+		return;
+	}
+
+	UFlareSpacecraftNavigationSystem* UnprotectedThis = const_cast<UFlareSpacecraftNavigationSystem*>(this);
+	UnprotectedThis->EngineEnvelope.Reset();
+	UnprotectedThis->EngineEnvelopeRevision = DamageRevision;
+	UnprotectedThis->EngineEnvelopeValid = true;
+
+	// Engines are fixed on the airframe, so their axes and offsets to the center of mass are constant in airframe space
+	// Arms use the cached COM, like the physics sub-tick and ComputeTotalMaxTorqueInAxis, then go to airframe space
+	FQuat AirframeRotation = Spacecraft->Airframe->GetComponentToWorld().GetRotation();
+	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
+
+	for (UActorComponent* Component : Engines)
+	{
+		UFlareEngine* Engine = Cast<UFlareEngine>(Component);
+
+		FVector WorldThrustAxis = Engine->GetThrustAxis().GetSafeNormal();
+		FVector EngineOffset = (Engine->GetComponentLocation() - COM) / 100;
+		FVector Torque = FVector::CrossProduct(EngineOffset, WorldThrustAxis);
+
+		FFlareEngineEnvelope Envelope;
+		Envelope.ThrustAxis = AirframeRotation.UnrotateVector(WorldThrustAxis);
+		Envelope.TorqueAxis = AirframeRotation.UnrotateVector(Torque.GetSafeNormal());
+		Envelope.TorqueArm = Torque.Size();
+		Envelope.InitialMaxThrust = Engine->GetInitialMaxThrust();
+		Envelope.ComponentRatio = (Engine->IsBroken() ? 0 : 1) * Engine->GetDamageRatio() * (Engine->IsPowered() ? 1 : 0);
+		Envelope.IsOrbital = Engine->IsA(UFlareOrbitalEngine::StaticClass());
+		UnprotectedThis->EngineEnvelope.Add(Envelope);
+	}
+}
+
+float UFlareSpacecraftNavigationSystem::GetEngineEnvelopeShipRatio() const
+{
+	if (Spacecraft->GetParent()->GetDamageSystem()->HasPowerOutage())
+	{
+		return 0;
+	}
+
+	return 1.0f - Spacecraft->GetDamageSystem()->GetOverheatRatio(0.05);
+}
+
+float UFlareSpacecraftNavigationSystem::CheckEngineEnvelope(int32 AxisCount)
+{
+	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
+	UFlareSimulatedSpacecraftDamageSystem* DamageSystem = Spacecraft->GetParent()->GetDamageSystem();
+	float MaxError = 0;
+
+	auto GetError = [](float Value, float Reference)
+	{
+		return FMath::Abs(Value - Reference) / FMath::Max(FMath::Abs(Reference), 1.0f);
+	};
+
+	// Save engine damages
+	TArray<float> SavedDamages;
+	for (UActorComponent* Component : Engines)
+	{
+		FFlareSpacecraftComponentSave* EngineData = Cast<UFlareEngine>(Component)->Save();
+		SavedDamages.Add(EngineData ? EngineData->Damage : 0);
+	}
+
+	for (int32 AxisIndex = 0; AxisIndex < AxisCount; AxisIndex++)
+	{
+		// Apply random damages on half of the tests
+		bool RandomDamages = (AxisIndex % 2 == 1);
+		for (int32 EngineIndex = 0; EngineIndex < Engines.Num(); EngineIndex++)
+		{
+			UFlareEngine* Engine = Cast<UFlareEngine>(Engines[EngineIndex]);
+			FFlareSpacecraftComponentSave* EngineData = Engine->Save();
+			if (EngineData)
+			{
+				float MaxHitPoints = DamageSystem->GetMaxHitPoints(Engine->GetDescription());
+				EngineData->Damage = RandomDamages ? FMath::FRand() * MaxHitPoints : SavedDamages[EngineIndex];
+				DamageSystem->SetDamageDirty(Engine->GetDescription());
+			}
+		}
+
+		FVector Axis = FMath::VRand();
+
+		FVector Thrust = GetTotalMaxThrustInAxis(Axis, false);
+		FVector ReferenceThrust = ComputeTotalMaxThrustInAxis(Engines, Axis);
+		MaxError = FMath::Max(MaxError, (Thrust - ReferenceThrust).Size() / FMath::Max(ReferenceThrust.Size(), 1.0f));
+
+		float Torque = GetTotalMaxTorqueInAxis(Axis, false);
+		float ReferenceTorque = ComputeTotalMaxTorqueInAxis(Engines, Axis, false);
+		MaxError = FMath::Max(MaxError, GetError(Torque, ReferenceTorque));
+
+		float DamagedTorque = GetTotalMaxTorqueInAxis(Axis, true);
+		float ReferenceDamagedTorque = ComputeTotalMaxTorqueInAxis(Engines, Axis, true);
+		MaxError = FMath::Max(MaxError, GetError(DamagedTorque, ReferenceDamagedTorque));
+
+		if (ReferenceTorque > 0)
+		{
+			MaxError = FMath::Max(MaxError, GetError(GetTotalMaxTorqueDamageRatioInAxis(Axis), ReferenceDamagedTorque / ReferenceTorque));
+		}
+	}
+
+	// Restore engine damages
+	for (int32 EngineIndex = 0; EngineIndex < Engines.Num(); EngineIndex++)
+	{
+		UFlareEngine* Engine = Cast<UFlareEngine>(Engines[EngineIndex]);
+		FFlareSpacecraftComponentSave* EngineData = Engine->Save();
+		if (EngineData)
+		{
+			EngineData->Damage = SavedDamages[EngineIndex];
+			DamageSystem->SetDamageDirty(Engine->GetDescription());
+		}
+	}
+
+	return MaxError;
+}
+
+FVector UFlareSpacecraftNavigationSystem::ComputeTotalMaxThrustInAxis(TArray<UActorComponent*>& Engines, FVector Axis) const
+{
+	Axis.Normalize();
+	FVector TotalMaxThrust = FVector::ZeroVector;
+	for (int32 i = 0; i < Engines.Num(); i++)
+	{
+		UFlareEngine* Engine = Cast<UFlareEngine>(Engines[i]);
+
+		FVector WorldThrustAxis = Engine->GetThrustAxis();
+		float Ratio = FVector::DotProduct(WorldThrustAxis, Axis);
+
+		/*if (Engine->IsA(UFlareOrbitalEngine::StaticClass()))
+		{
+			if(WithOrbitalEngines && Ratio + 0.2 > 0)
+			{
+				TotalMaxThrust += WorldThrustAxis * Engine->GetMaxThrust() * (Ratio + 0.2);
+			}
+		}
+		else
+		{*/
+			if (Ratio > 0)
+			{
+				TotalMaxThrust += WorldThrustAxis * Engine->GetMaxThrust() * Ratio;
+			}
+		/*}*/
+	}
+
+	return TotalMaxThrust;
+}
+
+float UFlareSpacecraftNavigationSystem::ComputeTotalMaxTorqueInAxis(TArray<UActorComponent*>& Engines, FVector TorqueAxis, bool WithDamages) const
+{
 	TorqueAxis.Normalize();
 	float TotalMaxTorque = 0;
 
@@ -1724,6 +1907,4 @@ float UFlareSpacecraftNavigationSystem::GetTotalMaxTorqueInAxis(TArray<UActorCom
 }
 
 
-
-
 #undef LOCTEXT_NAMESPACE
@@ -115,6 +115,17 @@ struct FFlareDockingParameters
 	FVector ShipDockSelfRotationInductedLinearVelocity;
 };
 
+/** Engine data for thrust and torque queries, in airframe space */
+struct FFlareEngineEnvelope
+{
+	FVector ThrustAxis;
+	FVector TorqueAxis;
+	float TorqueArm;
+	float InitialMaxThrust;
+	float ComponentRatio;
+	bool IsOrbital;
+};
+
 /** Spacecraft navigation system class */
 UCLASS()
 class HELIUMRAIN_API UFlareSpacecraftNavigationSystem : public UObject
@@ -256,8 +267,23 @@ public:
 	/** Update the ship's center of mass */
 	void UpdateCOM();
 
+	/** Compare the engine envelope with the per-engine computation for random axes and engine damages. Return the max relative error. */
+	float CheckEngineEnvelope(int32 AxisCount);
+
 protected:
 
+	/** Rebuild the engine envelope if the damage system changed */
+	void UpdateEngineEnvelope() const;
+
+	/** Damage ratio shared by all engines : heat and power outage */
+	float GetEngineEnvelopeShipRatio() const;
+
+	/** Reference per-engine computation of GetTotalMaxThrustInAxis */
+	FVector ComputeTotalMaxThrustInAxis(TArray<UActorComponent*>& Engines, FVector Axis) const;
+
+	/** Reference per-engine computation of GetTotalMaxTorqueInAxis */
+	float ComputeTotalMaxTorqueInAxis(TArray<UActorComponent*>& Engines, FVector TorqueAxis, bool WithDamages) const;
+
 
 	/*----------------------------------------------------
 		Protected data
@@ -300,6 +326,11 @@ protected:
 	TPair<TArray<int>, TArray<int>> YEngines;
 	TPair<TArray<int>, TArray<int>> ZEngines;
 
+	// Engine envelope, rebuilt when the damage revision changes
+	TArray<FFlareEngineEnvelope>             EngineEnvelope;
+	int32                                    EngineEnvelopeRevision;
+	bool                                     EngineEnvelopeValid;
+
 public:
 
 	/*----------------------------------------------------
@@ -308,11 +339,10 @@ public:
 
 	/**
 	 * Return the maximum current (with damages) trust the ship can provide in a specific axis.
-	 * Engines : List of engine to use to compute the max thrust
 	 * Axis : Axis of the thurst
 	 * WithObitalEngines : if false, ignore orbitals engines
 	 */
-	FVector GetTotalMaxThrustInAxis(TArray<UActorComponent*>& Engines, FVector Axis, bool WithOrbitalEngines) const;
+	FVector GetTotalMaxThrustInAxis(FVector Axis, bool WithOrbitalEngines) const;
 
 
 	/**
@@ -325,11 +355,16 @@ public:
 
 	/**
 	 * Return the maximum torque the ship can provide in a specific axis.
-	 * Engines : List of engine to use to compute the max thrust
 	 * TorqueDirection : Axis of the torque
 	 * WithDamages : if true, use current thrust value and not theorical thrust value
 	 */
-	float GetTotalMaxTorqueInAxis(TArray<UActorComponent*>& Engines, FVector TorqueDirection, bool WithDamages) const;
+	float GetTotalMaxTorqueInAxis(FVector TorqueDirection, bool WithDamages) const;
+
+	/**
+	 * Return the ratio of current to theorical torque in a specific axis, in a single pass.
+	 * TorqueDirection : Axis of the torque
+	 */
+	float GetTotalMaxTorqueDamageRatioInAxis(FVector TorqueDirection) const;
 
 
 	/*----------------------------------------------------
@@ -9,6 +9,9 @@
 
 #include "../../Spacecrafts/Subsystems/FlareSimulatedSpacecraftWeaponsSystem.h"
 
+DECLARE_CYCLE_STAT(TEXT("FlareList Refresh"), STAT_FlareList_Refresh, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlareList Filter"), STAT_FlareList_Filter, STATGROUP_Flare);
+
 #define LOCTEXT_NAMESPACE "FlareList"
 
 
@@ -152,52 +155,90 @@ void SFlareList::Construct(const FArguments& InArgs)
 
 void SFlareList::AddFleet(UFlareFleet* Fleet)
 {
-	ObjectList.AddUnique(FInterfaceContainer::New(Fleet));
+	ObjectList.Add(FInterfaceContainer::New(Fleet));
 }
 
 void SFlareList::AddShip(UFlareSimulatedSpacecraft* Ship)
 {
 	HasShips = true;
-	ObjectList.AddUnique(FInterfaceContainer::New(Ship));
+	ObjectList.Add(FInterfaceContainer::New(Ship));
 }
 
 void SFlareList::RefreshList()
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlareList_Refresh);
+
+	UpdateSortKeys();
+	UpdateFilteredList();
+	SlatePrepass(FSlateApplicationBase::Get().GetApplicationScale());
+}
+
+void SFlareList::UpdateSortKeys()
+{
+	SortKeys.Reset(ObjectList.Num());
+	FleetGroupKeys.Reset();
+
+	for (auto Object : ObjectList)
+	{
+		SortKeys.Add(GetSortKey(Object));
+	}
+}
+
+FFlareListSortKey SFlareList::GetSortKey(TSharedPtr<FInterfaceContainer> Item) const
+{
+	FFlareListSortKey Key;
+	Key.Item = Item;
+
+	if (Item->FleetPtr)
+	{
+		Key.IsFleet = true;
+		Key.IsPlayerFleet = (Item->FleetPtr == MenuManager->GetPC()->GetPlayerFleet());
+		Key.CombatPoints = Item->FleetPtr->GetCombatPoints(true);
+		Key.FleetName = Item->FleetPtr->GetFleetName().ToString();
+	}
+
+	if (Item->SpacecraftPtr)
+	{
+		UFlareSimulatedSpacecraft* Spacecraft = Item->SpacecraftPtr;
+		Key.IsPlayerShip = Spacecraft->IsPlayerShip();
+		Key.IsStation = Spacecraft->IsStation();
+		Key.IsSubstation = Spacecraft->GetDescription()->IsSubstation;
+		Key.Capacity = Spacecraft->GetDescription()->GetCapacity();
+		Key.Mass = Spacecraft->GetDescription()->Mass;
+		Key.Size = Spacecraft->GetSize();
+		Key.IsMilitary = Spacecraft->IsMilitary();
+		Key.WeaponGroupCount = Key.IsMilitary ? Spacecraft->GetWeaponsSystem()->GetWeaponGroupCount() : 0;
+	}
+
+	return Key;
+}
+
+void SFlareList::UpdateFilteredList()
 {
 	struct FSortBySize
 	{
-		FORCEINLINE bool operator()(const TSharedPtr<FInterfaceContainer> PtrA, const TSharedPtr<FInterfaceContainer> PtrB) const
+		FORCEINLINE bool operator()(const FFlareListSortKey& A, const FFlareListSortKey& B) const
 		{
-			FCHECK(PtrA.IsValid());
-			FCHECK(PtrB.IsValid());
-
 			// Fleets
-			if (PtrA->FleetPtr)
+			if (A.IsFleet)
 			{
-				if (PtrB->FleetPtr)
+				if (B.IsFleet)
 				{
-					UFlareFleet* PlayerFleet = PtrA->FleetPtr->GetGame()->GetPC()->GetPlayerFleet();
-
-					if (PtrA->FleetPtr == PlayerFleet)
+					if (A.IsPlayerFleet)
 					{
 						return true;
 					}
-					else if (PtrB->FleetPtr == PlayerFleet)
+					else if (B.IsPlayerFleet)
 					{
 						return false;
 					}
+					else if (A.CombatPoints != B.CombatPoints)
+					{
+						return A.CombatPoints > B.CombatPoints;
+					}
 					else
 					{
-						int32 ValueA = PtrA->FleetPtr->GetCombatPoints(true);
-						int32 ValueB = PtrB->FleetPtr->GetCombatPoints(true);
-
-						if (ValueA != ValueB)
-						{
-							return ValueA > ValueB;
-						}
-						else
-						{
-							return PtrA->FleetPtr->GetFleetName().ToString().Compare(PtrB->FleetPtr->GetFleetName().ToString()) < 0;
-						}
+						return A.FleetName.Compare(B.FleetName) < 0;
 					}
 				}
 				else
@@ -205,108 +246,117 @@ void SFlareList::RefreshList()
 					return true;
 				}
 			}
-			else if (PtrB->FleetPtr)
+			else if (B.IsFleet)
 			{
 				return false;
 			}
 
 			// Stations
-			else
+			else if (A.IsPlayerShip != B.IsPlayerShip)
 			{
-				UFlareSimulatedSpacecraft* A = PtrA->SpacecraftPtr;
-				UFlareSimulatedSpacecraft* B = PtrB->SpacecraftPtr;
-
-				if (A->IsPlayerShip() != B->IsPlayerShip())
-				{
-					return A->IsPlayerShip();
-				}
-				else if (A->IsStation() && B->IsStation())
-				{
-					if (A->GetDescription()->IsSubstation && !B->GetDescription()->IsSubstation)
-					{
-						return true;
-					}
-					else if (!A->GetDescription()->IsSubstation && B->GetDescription()->IsSubstation)
-					{
-						return false;
-					}
-					else if (A->GetDescription()->GetCapacity() != B->GetDescription()->GetCapacity())
-					{
-						return A->GetDescription()->GetCapacity() > B->GetDescription()->GetCapacity();
-					}
-					else
-					{
-						return A->GetDescription()->Mass > B->GetDescription()->Mass;
-					}
-				}
-				else if (A->IsStation() && !B->IsStation())
+				return A.IsPlayerShip;
+			}
+			else if (A.IsStation && B.IsStation)
+			{
+				if (A.IsSubstation && !B.IsSubstation)
 				{
 					return true;
 				}
-				else if (!A->IsStation() && B->IsStation())
+				else if (!A.IsSubstation && B.IsSubstation)
 				{
 					return false;
 				}
-
-				// Ships
-				else if (A->GetSize() > B->GetSize())
+				else if (A.Capacity != B.Capacity)
 				{
-					return true;
+					return A.Capacity > B.Capacity;
 				}
-				else if (A->GetSize() < B->GetSize())
+				else
 				{
-					return false;
+					return A.Mass > B.Mass;
 				}
-				else if (A->IsMilitary())
+			}
+			else if (A.IsStation && !B.IsStation)
+			{
+				return true;
+			}
+			else if (!A.IsStation && B.IsStation)
+			{
+				return false;
+			}
+
+			// Ships
+			else if (A.Size > B.Size)
+			{
+				return true;
+			}
+			else if (A.Size < B.Size)
+			{
+				return false;
+			}
+			else if (A.IsMilitary)
+			{
+				if (!B.IsMilitary)
 				{
-					if (!B->IsMilitary())
-					{
-						return true;
-					}
-					else
-					{
-						return A->GetWeaponsSystem()->GetWeaponGroupCount() > B->GetWeaponsSystem()->GetWeaponGroupCount();
-					}
+					return true;
 				}
 				else
 				{
-					return false;
+					return A.WeaponGroupCount > B.WeaponGroupCount;
 				}
 			}
-			return false;
+			else
+			{
+				return false;
+			}
 		}
 	};
 
+	SCOPE_CYCLE_COUNTER(STAT_FlareList_Filter);
+
+	// Entries were added without a refresh
+	if (SortKeys.Num() != ObjectList.Num())
+	{
+		UpdateSortKeys();
+	}
 
 	// Apply filters
-	FilteredObjectList.Empty();
-	TArray<UFlareFleet*> FilteredFleets;
-	for (auto Object : ObjectList)
+	TArray<FFlareListSortKey> FilteredKeys;
+	TSet<UFlareFleet*> FilteredFleets;
+	FilteredKeys.Reserve(ObjectList.Num());
+
+	for (int32 Index = 0; Index < ObjectList.Num(); Index++)
 	{
+		const FFlareListSortKey& Key = SortKeys[Index];
+
 		// Ships have three filters
-		if (Object->SpacecraftPtr)
+		if (Key.Item->SpacecraftPtr)
 		{
-			bool IsStation = Object->SpacecraftPtr->IsStation();
-			bool IsMilitary = Object->SpacecraftPtr->IsMilitary();
-
-			if ((IsStation && ShowStationsButton->IsActive())
-			 || (IsMilitary && ShowMilitaryButton->IsActive())
-			 || (!IsStation && !IsMilitary && ShowFreightersButton->IsActive()))
+			if ((Key.IsStation && ShowStationsButton->IsActive())
+			 || (Key.IsMilitary && ShowMilitaryButton->IsActive())
+			 || (!Key.IsStation && !Key.IsMilitary && ShowFreightersButton->IsActive()))
 			{
-				UFlareFleet* ObjectFleet = Object->SpacecraftPtr->GetCurrentFleet();
+				UFlareFleet* ObjectFleet = Key.Item->SpacecraftPtr->GetCurrentFleet();
 
-				// Create a new fleet pointer if we're grouping by fleets
-				if (GroupFleetsButton->IsActive() && !IsStation)
+				// Use a fleet entry if we're grouping by fleets
+				if (GroupFleetsButton->IsActive() && !Key.IsStation)
 				{
-					if (FilteredFleets.Find(ObjectFleet) == INDEX_NONE)
+					bool IsAlreadyFiltered = false;
+					FilteredFleets.Add(ObjectFleet, &IsAlreadyFiltered);
+
+					if (!IsAlreadyFiltered)
 					{
-						FilteredFleets.AddUnique(ObjectFleet);
-						FilteredObjectList.AddUnique(FInterfaceContainer::New(ObjectFleet));
+						FFlareListSortKey* FleetKey = FleetGroupKeys.Find(ObjectFleet);
+						if (!FleetKey)
+						{
+							FleetKey = &FleetGroupKeys.Add(ObjectFleet, GetSortKey(FInterfaceContainer::New(ObjectFleet)));
+						}
+
+						FilteredKeys.Add(*FleetKey);
 					}
 				}
 				else
 				{
-					FilteredObjectList.Add(Object);
+					FilteredKeys.Add(Key);
 				}
 			}
 		}
@@ -314,14 +364,18 @@ void SFlareList::RefreshList()
 		// Fleets have no filters
 		else
 		{
-			FilteredObjectList.Add(Object);
+			FilteredKeys.Add(Key);
 		}
 	}
 
 	// Sort and update
-	FilteredObjectList.Sort(FSortBySize());
+	FilteredKeys.Sort(FSortBySize());
+	FilteredObjectList.Reset(FilteredKeys.Num());
+	for (const FFlareListSortKey& Key : FilteredKeys)
+	{
+		FilteredObjectList.Add(Key.Item);
+	}
 	WidgetList->RequestListRefresh();
-	SlatePrepass(FSlateApplicationBase::Get().GetApplicationScale());
 
 	ClearSelection();
 }
@@ -362,6 +416,8 @@ void SFlareList::Reset()
 
 	ObjectList.Empty();
 	FilteredObjectList.Empty();
+	SortKeys.Empty();
+	FleetGroupKeys.Empty();
 
 	WidgetList->ClearSelection();
 	WidgetList->RequestListRefresh();
@@ -502,7 +558,8 @@ void SFlareList::OnTargetSelected(TSharedPtr<FInterfaceContainer> Item, ESelectI
 
 void SFlareList::OnToggleShowFlags()
 {
-	RefreshList();
+	// Only the filters changed, keep the current sort data
+	UpdateFilteredList();
 }
 
 void SFlareList::OnShipRemoved(UFlareSimulatedSpacecraft* Ship)
@@ -8,6 +8,43 @@
 DECLARE_DELEGATE_OneParam(FFlareListItemSelected, TSharedPtr<FInterfaceContainer>)
 
 
+/** Sort data of a list entry, computed once per refresh */
+struct FFlareListSortKey
+{
+	TSharedPtr<FInterfaceContainer> Item;
+
+	// Fleet data
+	bool                                             IsFleet;
+	bool                                             IsPlayerFleet;
+	int32                                            CombatPoints;
+	FString                                          FleetName;
+
+	// Spacecraft data
+	bool                                             IsPlayerShip;
+	bool                                             IsStation;
+	bool                                             IsSubstation;
+	int32                                            Capacity;
+	float                                            Mass;
+	int32                                            Size;
+	bool                                             IsMilitary;
+	int32                                            WeaponGroupCount;
+
+	FFlareListSortKey()
+		: IsFleet(false)
+		, IsPlayerFleet(false)
+		, CombatPoints(0)
+		, IsPlayerShip(false)
+		, IsStation(false)
+		, IsSubstation(false)
+		, Capacity(0)
+		, Mass(0)
+		, Size(0)
+		, IsMilitary(false)
+		, WeaponGroupCount(0)
+	{}
+};
+
+
 class SFlareList : public SCompoundWidget
 {
 	/*----------------------------------------------------
@@ -69,6 +106,15 @@ protected:
 		Callbacks
 	----------------------------------------------------*/
 
+	/** Compute the sort data of all entries */
+	void UpdateSortKeys();
+
+	/** Compute the sort data of an entry */
+	FFlareListSortKey GetSortKey(TSharedPtr<FInterfaceContainer> Item) const;
+
+	/** Filter, group and sort entries using the current sort data */
+	void UpdateFilteredList();
+
 	/** Show a "no objects" text when the data is empty */
 	EVisibility GetNoObjectsVisibility() const;
 
@@ -109,6 +155,10 @@ protected:
 	TSharedPtr<FInterfaceContainer>                              SelectedObject;
 	TSharedPtr<SFlareListItem>                                   PreviousWidget;
 
+	// Sort data, aligned with ObjectList, and fleet groups created so far
+	TArray<FFlareListSortKey>                                    SortKeys;
+	TMap<UFlareFleet*, FFlareListSortKey>                        FleetGroupKeys;
+
 	// Filters
 	TSharedPtr<SFlareButton>                                     ShowStationsButton;
 	TSharedPtr<SFlareButton>                                     ShowMilitaryButton;
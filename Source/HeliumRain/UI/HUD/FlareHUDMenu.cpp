@@ -399,18 +399,16 @@ FText SFlareHUDMenu::GetWarningText() const
 	if (CurrentSector)
 	{
 		// Get player threats
-		bool Targeted, FiredUpon, CollidingSoon, ExitingSoon, LowHealth;
-		UFlareSimulatedSpacecraft* Threat;
-		MenuManager->GetPC()->GetPlayerShipThreatStatus(Targeted, FiredUpon, CollidingSoon, ExitingSoon, LowHealth, Threat);
+		const FFlarePlayerThreatStatus& ThreatStatus = MenuManager->GetPC()->GetPlayerShipThreatStatus();
 
 		// Fired on ?
-		if (FiredUpon)
+		if (ThreatStatus.IsFiredUpon)
 		{
-			if (Threat)
+			if (ThreatStatus.Threat)
 			{
 				FText WarningText = FText::Format(LOCTEXT("ThreatFiredUponFormat", "UNDER FIRE FROM {0} ({1})"),
-					UFlareGameTools::DisplaySpacecraftName(Threat),
-					FText::FromString(Threat->GetCompany()->GetShortName().ToString()));
+					UFlareGameTools::DisplaySpacecraftName(ThreatStatus.Threat),
+					FText::FromString(ThreatStatus.Threat->GetCompany()->GetShortName().ToString()));
 				Info = WarningText.ToString();
 			}
 			else
@@ -421,30 +419,30 @@ FText SFlareHUDMenu::GetWarningText() const
 		}
 
 		// Collision ?
-		else if (CollidingSoon)
+		else if (ThreatStatus.CollidingSoon)
 		{
 			FText WarningText = LOCTEXT("ThreatCollisionFormat", "IMMINENT COLLISION");
 			Info = WarningText.ToString();
 		}
 
 		// Leaving sector ?
-		else if (ExitingSoon)
+		else if (ThreatStatus.ExitingSoon)
 		{
 			FText WarningText = LOCTEXT("ThreatLeavingFormat", "LEAVING SECTOR");
 			Info = WarningText.ToString();
 		}
 
 		// Targeted ?
-		else if (Targeted)
+		else if (ThreatStatus.IsTargeted)
 		{
 			FText WarningText = FText::Format(LOCTEXT("ThreatTargetFormat", "TARGETED BY {0} ({1})"),
-				UFlareGameTools::DisplaySpacecraftName(Threat),
-				FText::FromString(Threat->GetCompany()->GetShortName().ToString()));
+				UFlareGameTools::DisplaySpacecraftName(ThreatStatus.Threat),
+				FText::FromString(ThreatStatus.Threat->GetCompany()->GetShortName().ToString()));
 			Info = WarningText.ToString();
 		}
 
 		// Low health
-		else if (LowHealth)
+		else if (ThreatStatus.LowHealth)
 		{
 			FText WarningText = LOCTEXT("ThreatHealthFormat", "LIFE SUPPORT COMPROMISED");
 			Info = WarningText.ToString();
@@ -765,12 +765,13 @@ void SFlareCompanyMenu::ShowCompanyAccounting(UFlareCompany* Target)
 		Balances.Add(0);
 	}
 
-	// Compute balances
-	for (const FFlareTransactionLogEntry& Entry : Target->GetTransactionLog())
+	// Get balances
+	const FFlareTransactionLogSummary* Summary = Target->GetTransactionSummary(CurrentAccountingYear);
+	if (Summary)
 	{
-		if (UFlareGameTools::GetYearFromDate(Entry.Date) == CurrentAccountingYear)
+		for (int32 Type = 0; Type < Summary->Amounts.Num() && Type < Balances.Num(); Type++)
 		{
-			Balances[Entry.Type] += Entry.Amount;
+			Balances[Type] = Summary->Amounts[Type];
 		}
 	}
 
@@ -28,7 +28,10 @@ void SFlareOrbitalMenu::Construct(const FArguments& InArgs)
 
 	// FF setup
 	FastForwardPeriod = 0.5f;
+	FastForwardFrameBudget = 0.05f;
 	FastForwardStopRequested = false;
+	FastForwardBatchEndRequested = false;
+	FastForwardDays = 0;
 
 	// Build structure
 	ChildSlot
@@ -312,6 +315,7 @@ void SFlareOrbitalMenu::Exit()
 void SFlareOrbitalMenu::StopFastForward()
 {
 	TimeSinceFastForward = 0;
+	FastForwardDays = 0;
 	FastForwardStopRequested = false;
 	FastForwardAuto->SetActive(false);
 
@@ -329,24 +333,40 @@ void SFlareOrbitalMenu::RequestStopFastForward()
 	FastForwardStopRequested = true;
 }
 
+void SFlareOrbitalMenu::RequestEndFastForwardBatch()
+{
+	FastForwardBatchEndRequested = true;
+}
+
 void SFlareOrbitalMenu::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
 	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
 
 	if (IsEnabled() && MenuManager.IsValid())
 	{
-		for(UFlareSimulatedSector* Sector : MenuManager->GetPC()->GetCompany()->GetKnownSectors())
-		{
-			MenuManager->GetPC()->CheckSectorStateChanges(Sector);
-		}
+		CheckSectorStateChanges();
 
 		// Fast forward every FastForwardPeriod
 		TimeSinceFastForward += InDeltaTime;
 		if (FastForwardActive)
 		{
-			if (!FastForwardStopRequested && (TimeSinceFastForward > FastForwardPeriod || UFlareGameTools::FastFastForward))
+			if (!FastForwardStopRequested && UFlareGameTools::FastFastForward)
+			{
+				// Simulate as many days as the frame budget allows, checking sectors after each day like the one-day mode does,
+				// and ending the batch on the day a notification is posted so that it is displayed on time
+				FastForwardBatchEndRequested = false;
+				FastForwardDays += MenuManager->GetGame()->GetGameWorld()->FastForward(MAX_int32, FastForwardFrameBudget,
+					[this]()
+					{
+						CheckSectorStateChanges();
+						return FastForwardStopRequested || FastForwardBatchEndRequested;
+					});
+				TimeSinceFastForward = 0;
+			}
+			else if (!FastForwardStopRequested && TimeSinceFastForward > FastForwardPeriod)
 			{
 				MenuManager->GetGame()->GetGameWorld()->FastForward();
+				FastForwardDays++;
 				TimeSinceFastForward = 0;
 			}
 
@@ -359,6 +379,14 @@ void SFlareOrbitalMenu::Tick(const FGeometry& AllottedGeometry, const double InC
 	}
 }
 
+void SFlareOrbitalMenu::CheckSectorStateChanges()
+{
+	for(UFlareSimulatedSector* Sector : MenuManager->GetPC()->GetCompany()->GetKnownSectors())
+	{
+		MenuManager->GetPC()->CheckSectorStateChanges(Sector);
+	}
+}
+
 void SFlareOrbitalMenu::UpdateMap()
 {
 	TArray<FFlareSectorCelestialBodyDescription>& OrbitalBodies = Game->GetOrbitalBodies()->OrbitalBodies;
@@ -518,7 +546,15 @@ FText SFlareOrbitalMenu::GetFastForwardText() const
 	}
 	else
 	{
-		return LOCTEXT("FastForwardingText", "Fast forwarding...");
+		if (FastForwardDays > 0)
+		{
+			return FText::Format(LOCTEXT("FastForwardingDaysFormat", "Fast forwarding... ({0})"),
+				UFlareGameTools::FormatDate(FastForwardDays, 1));
+		}
+		else
+		{
+			return LOCTEXT("FastForwardingText", "Fast forwarding...");
+		}
 	}
 }
 
@@ -667,6 +703,7 @@ void SFlareOrbitalMenu::OnFastForwardConfirmed(bool Automatic)
 		// Mark FF
 		FastForwardActive = true;
 		FastForwardStopRequested = false;
+		FastForwardDays = 0;
 
 		// Prepare for FF
 		Game->SaveGame(MenuManager->GetPC(), true);
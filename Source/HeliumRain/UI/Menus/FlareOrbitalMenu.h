@@ -58,6 +58,9 @@ public:
 	/** A notification was received, stop */
 	void RequestStopFastForward();
 
+	/** A notification was received during fast-fast-forward, end the current batch of days */
+	void RequestEndFastForwardBatch();
+
 	/** Get the display mode */
 	EFlareOrbitalMode::Type GetDisplayMode() const;
 
@@ -73,6 +76,9 @@ protected:
 		Drawing
 	----------------------------------------------------*/
 	
+	/** Report battle and sector state changes in the known sectors */
+	void CheckSectorStateChanges();
+
 	/** Update the map with new data from the planetarium */
 	void UpdateMap();
 
@@ -142,8 +148,11 @@ protected:
 	// Fast forward
 	bool                                        FastForwardActive;
 	bool                                        FastForwardStopRequested;
+	bool                                        FastForwardBatchEndRequested;
 	float                                       FastForwardPeriod;
+	float                                       FastForwardFrameBudget;
 	float                                       TimeSinceFastForward;
+	int32                                       FastForwardDays;
 
 	TEnumAsByte<EFlareOrbitalMode::Type>        DisplayMode;
 
@@ -447,18 +447,15 @@ void SFlareShipMenu::Enter(UFlareSimulatedSpacecraft* Target, bool IsEditable)
 	{
 		ShipList->SetVisibility(EVisibility::Visible);
 
-		TArray<AFlareSpacecraft*> DockedShips = DockSystem->GetDockedShips();
-		for (int32 i = 0; i < DockedShips.Num(); i++)
+		for (AFlareSpacecraft* Spacecraft : DockSystem->GetDockedShips())
 		{
-			AFlareSpacecraft* Spacecraft = DockedShips[i];
-
 			if (Spacecraft)
 			{
 				FLOGV("SFlareShipMenu::Enter : Found docked ship %s", *Spacecraft->GetName());
 			}
-			if (DockedShips[i]->GetParent()->GetDamageSystem()->IsAlive())
+			if (Spacecraft->GetParent()->GetDamageSystem()->IsAlive())
 			{
-				ShipList->AddShip(DockedShips[i]->GetParent());
+				ShipList->AddShip(Spacecraft->GetParent());
 			}
 		}
 
@@ -1492,26 +1492,7 @@ bool SFlareSkirmishSetupMenu::CanStartPlaying(FText& Reason) const
 
 void SFlareSkirmishSetupMenu::SetOrderDefaults(TSharedPtr<FFlareSkirmishSpacecraftOrder> Order)
 {
-	if (Order->Description->Size == EFlarePartSize::S)
-	{
-		Order->EngineType = FName("engine-thresher");
-		Order->RCSType = FName("rcs-coral");
-
-		for (auto& Slot : Order->Description->WeaponGroups)
-		{
-			Order->WeaponTypes.Add(FName("weapon-eradicator"));
-		}
-	}
-	else
-	{
-		Order->EngineType = FName("pod-thera");
-		Order->RCSType = FName("rcs-rift");
-
-		for (auto& Slot : Order->Description->WeaponGroups)
-		{
-			Order->WeaponTypes.Add(FName("weapon-artemis"));
-		}
-	}
+	UFlareSkirmishManager::SetOrderDefaults(*Order.Get());
 }
 
 